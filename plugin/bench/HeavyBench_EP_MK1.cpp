@@ -0,0 +1,315 @@
+/**
+ * Copyright (c) 2014-2018 Enzien Audio Ltd.
+ *
+ * Permission to use, copy, modify, and/or distribute this software for any
+ * purpose with or without fee is hereby granted, provided that the above
+ * copyright notice and this permission notice appear in all copies.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL WARRANTIES WITH
+ * REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED WARRANTIES OF MERCHANTABILITY
+ * AND FITNESS. IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR ANY SPECIAL, DIRECT,
+ * INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES WHATSOEVER RESULTING FROM
+ * LOSS OF USE, DATA OR PROFITS, WHETHER IN AN ACTION OF CONTRACT, NEGLIGENCE OR
+ * OTHER TORTIOUS ACTION, ARISING OUT OF OR IN CONNECTION WITH THE USE OR
+ * PERFORMANCE OF THIS SOFTWARE.
+ */
+
+/**
+ * Measures the cost of messages and voices of EP_MK1 in a few playing scenarios.
+ *
+ *   EP_MK1-bench [-b block size] [-t seconds] [-r sample rate] [scenario ...]
+ *
+ * Each scenario is rendered once for each way of sending the same notes to the context:
+ *
+ *   format   hv_sendMessageToReceiverV(), which builds each message in the input queue from
+ *            its format string
+ *   copied   hv_sendMessageToReceiver(), which copies a message built beforehand
+ *   floats   hv_sendFloats3(), which writes the floats into the input queue directly
+ *
+ * For each it prints the messages per second, the ingest time per message, the render time per
+ * block including the dispatch of the messages, and the real-time load. Every message is copied
+ * from the input queue into the message pool once and then handed to the objects by reference,
+ * so the ingest time is the part of the cost of a message that depends on how it is sent. All
+ * renders of a scenario must produce the same output.
+ *
+ * The scenarios are:
+ *
+ *   notes    a single note at a time
+ *   chords   chords of four notes
+ *   steal    overlapping chords of six notes, such that voices are stolen
+ *   release  short notes with long releases
+ *   storm    32 random note-ons and note-offs per 64 frames, at any frame
+ *
+ * Built with HV_RT_AUDIT=1, as by `make audit`, the notes are sent and the blocks rendered as
+ * realtime code, see HvRtAudit.h, and the benchmark fails if any of them made a blocking call.
+ */
+
+#include "Heavy_EP_MK1.h"
+#include "HvRtAudit.h"
+
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <vector>
+
+#if HV_SIMD_AVX
+#define HV_BENCH_SIMD "AVX"
+#elif HV_SIMD_SSE
+#define HV_BENCH_SIMD "SSE"
+#elif HV_SIMD_NEON
+#define HV_BENCH_SIMD "NEON"
+#else
+#define HV_BENCH_SIMD "none"
+#endif
+
+#define HV_BENCH_HASH_NOTEIN 0x67E37CA3 // __hv_notein
+#define HV_BENCH_MAX_FRAMES 8192
+
+struct BenchNote
+{
+  hv_uint64_t frame;
+  float pitch;
+  float velocity;
+};
+
+struct BenchScenario
+{
+  const char *name;
+  void (*makeNotes)(std::vector<BenchNote> &notes, double sampleRate, hv_uint64_t numFrames);
+};
+
+enum BenchSend
+{
+  kSendFormat,
+  kSendCopied,
+  kSendFloats,
+  kNumSends
+};
+
+static const char *const kSendNames[kNumSends] = {"format", "copied", "floats"};
+
+struct BenchResult
+{
+  double ingestNs; // per message
+  double renderUs; // per block
+  hv_uint64_t hash; // of the output
+};
+
+static hv_uint32_t benchSeed = 1;
+
+static hv_uint32_t nextRandom()
+{
+  benchSeed = benchSeed*1664525 + 1013904223;
+  return benchSeed >> 8;
+}
+
+// notes of the given length, every period seconds, each a chord of the given size
+static void makeChords(std::vector<BenchNote> &notes, double sampleRate, hv_uint64_t numFrames,
+                       double period, double length, int size)
+{
+  const hv_uint64_t step = (hv_uint64_t) (period*sampleRate);
+  const hv_uint64_t hold = (hv_uint64_t) (length*sampleRate);
+  for (hv_uint64_t f = 0, k = 0; f + hold < numFrames; f += step, ++k)
+  {
+    for (int j = 0; j < size; ++j)
+    {
+      const float pitch = (float) (36 + (k*5 + j*4) % 48);
+      notes.push_back({f, pitch, (float) (40 + (k*7 + j*11) % 80)});
+      notes.push_back({f + hold, pitch, 0.0f});
+    }
+  }
+}
+
+static void makeNotes(std::vector<BenchNote> &notes, double sampleRate, hv_uint64_t numFrames)
+{
+  makeChords(notes, sampleRate, numFrames, 0.25, 0.2, 1);
+}
+
+static void makeChords(std::vector<BenchNote> &notes, double sampleRate, hv_uint64_t numFrames)
+{
+  makeChords(notes, sampleRate, numFrames, 0.5, 0.4, 4);
+}
+
+static void makeSteal(std::vector<BenchNote> &notes, double sampleRate, hv_uint64_t numFrames)
+{
+  makeChords(notes, sampleRate, numFrames, 0.25, 1.0, 6);
+}
+
+static void makeRelease(std::vector<BenchNote> &notes, double sampleRate, hv_uint64_t numFrames)
+{
+  makeChords(notes, sampleRate, numFrames, 2.0, 0.1, 2);
+}
+
+static void makeStorm(std::vector<BenchNote> &notes, double sampleRate, hv_uint64_t numFrames)
+{
+  for (hv_uint64_t f = 0; f < numFrames; f += 64)
+  {
+    for (int i = 0; i < 32; ++i)
+    {
+      const float pitch = (float) (48 + nextRandom() % 24);
+      const float velocity = (nextRandom() % 5 < 2) ? 0.0f : (float) (1 + nextRandom() % 127);
+      notes.push_back({f + nextRandom() % 64, pitch, velocity});
+    }
+  }
+}
+
+static const BenchScenario kScenarios[] = {
+  {"notes", makeNotes},
+  {"chords", makeChords},
+  {"steal", makeSteal},
+  {"release", makeRelease},
+  {"storm", makeStorm},
+};
+
+// FNV-1a of the bytes of the output
+static hv_uint64_t hashOutput(hv_uint64_t h, const float *const *outputs, int numChannels, int n)
+{
+  for (int k = 0; k < numChannels; ++k)
+  {
+    const unsigned char *const p = (const unsigned char *) outputs[k];
+    for (int i = 0; i < n*(int) sizeof(float); ++i) h = (h ^ p[i]) * 0x100000001B3ULL;
+  }
+  return h;
+}
+
+static BenchResult render(const std::vector<BenchNote> &notes, BenchSend send, double sampleRate,
+                          int blockSize, hv_uint64_t numFrames)
+{
+  typedef std::chrono::steady_clock Clock;
+  HeavyContextInterface *const context = hv_EP_MK1_new_with_options(sampleRate, 64, 64, 2);
+  hv_warmUp(context);
+  float *outputs[2] = {
+    (float *) hv_malloc(blockSize*sizeof(float)),
+    (float *) hv_malloc(blockSize*sizeof(float))
+  };
+  HvMessage *const m = (HvMessage *) hv_malloc(hv_msg_getByteSize(3));
+
+  BenchResult r = {0.0, 0.0, 0xCBF29CE484222325ULL};
+  Clock::duration ingest(0), rendering(0);
+  size_t next = 0;
+  hv_uint64_t numBlocks = 0;
+  for (hv_uint64_t f = 0; f < numFrames; f += blockSize, ++numBlocks)
+  {
+    HV_RT_AUDIT_ENTER(); // a host sends the notes of a block from its audio thread
+    if (next < notes.size() && notes[next].frame < f + blockSize)
+    {
+      const Clock::time_point t0 = Clock::now();
+      for (; next < notes.size() && notes[next].frame < f + blockSize; ++next)
+      {
+        const BenchNote &n = notes[next];
+        const hv_uint32_t offset = (hv_uint32_t) (n.frame - f);
+        const double delayMs = 1000.0*(offset + 0.5)/sampleRate; // rounds down to the same frame
+        switch (send)
+        {
+          case kSendFormat:
+            hv_sendMessageToReceiverV(context, HV_BENCH_HASH_NOTEIN, delayMs, "fff", n.pitch, n.velocity, 0.0f);
+            break;
+          case kSendCopied:
+            hv_msg_init(m, 3, 0);
+            hv_msg_setFloat(m, 0, n.pitch);
+            hv_msg_setFloat(m, 1, n.velocity);
+            hv_msg_setFloat(m, 2, 0.0f);
+            hv_sendMessageToReceiver(context, HV_BENCH_HASH_NOTEIN, delayMs, m);
+            break;
+          default:
+            hv_sendFloats3(context, HV_BENCH_HASH_NOTEIN, offset, n.pitch, n.velocity, 0.0f);
+            break;
+        }
+      }
+      ingest += Clock::now() - t0;
+    }
+    const Clock::time_point t1 = Clock::now();
+    hv_process(context, nullptr, outputs, blockSize);
+    rendering += Clock::now() - t1;
+    HV_RT_AUDIT_LEAVE();
+    r.hash = hashOutput(r.hash, outputs, 2, blockSize);
+  }
+
+  r.ingestNs = std::chrono::duration<double, std::nano>(ingest).count()/(double) std::max<size_t>(notes.size(), 1);
+  r.renderUs = std::chrono::duration<double, std::micro>(rendering).count()/(double) numBlocks;
+  hv_free(m);
+  hv_free(outputs[0]);
+  hv_free(outputs[1]);
+  hv_delete(context);
+  return r;
+}
+
+int main(int argc, char* argv[])
+{
+  int blockSize = 64;
+  double seconds = 10.0;
+  double sampleRate = 48000.0;
+  std::vector<const BenchScenario *> scenarios;
+
+  for (int i = 1; i < argc; ++i)
+  {
+    if (std::strcmp(argv[i], "-b") == 0 && i+1 < argc) blockSize = std::atoi(argv[++i]);
+    else if (std::strcmp(argv[i], "-t") == 0 && i+1 < argc) seconds = std::atof(argv[++i]);
+    else if (std::strcmp(argv[i], "-r") == 0 && i+1 < argc) sampleRate = std::atof(argv[++i]);
+    else if (argv[i][0] != '-')
+    {
+      const BenchScenario *s = nullptr;
+      for (const BenchScenario &k : kScenarios) if (std::strcmp(argv[i], k.name) == 0) s = &k;
+      if (s == nullptr)
+      {
+        std::fprintf(stderr, "%s: unknown scenario %s\n", argv[0], argv[i]);
+        return 1;
+      }
+      scenarios.push_back(s);
+    }
+    else
+    {
+      std::fprintf(stderr, "usage: %s [-b block size] [-t seconds] [-r sample rate] [scenario ...]\n", argv[0]);
+      return 1;
+    }
+  }
+  if (blockSize <= 0 || blockSize > HV_BENCH_MAX_FRAMES || (blockSize % HV_N_SIMD) != 0 || seconds <= 0.0 || sampleRate <= 0.0)
+  {
+    std::fprintf(stderr, "%s: the block size must be a multiple of %d of at most %d, the time and sample rate positive\n",
+                 argv[0], HV_N_SIMD, HV_BENCH_MAX_FRAMES);
+    return 1;
+  }
+  if (scenarios.empty()) for (const BenchScenario &k : kScenarios) scenarios.push_back(&k);
+
+  const hv_uint64_t numFrames = (hv_uint64_t) (seconds*sampleRate);
+  const double blockUs = 1e6*blockSize/sampleRate;
+  std::printf("EP_MK1 bench, SIMD %s (HV_N_SIMD %d), %g Hz, block %d, %g s per scenario\n",
+              HV_BENCH_SIMD, HV_N_SIMD, sampleRate, blockSize, seconds);
+  std::printf("  %-8s %-7s %8s %10s %12s %7s\n", "", "send", "msg/s", "ingest ns", "render us/b", "load");
+
+  bool failed = false;
+  for (const BenchScenario *s : scenarios)
+  {
+    std::vector<BenchNote> notes;
+    benchSeed = 1;
+    s->makeNotes(notes, sampleRate, numFrames);
+    std::stable_sort(notes.begin(), notes.end(),
+                     [](const BenchNote &a, const BenchNote &b) { return a.frame < b.frame; });
+    const double rate = (double) notes.size()/seconds;
+
+    BenchResult results[kNumSends];
+    for (int k = 0; k < kNumSends; ++k)
+    {
+      const BenchResult &r = results[k] = render(notes, (BenchSend) k, sampleRate, blockSize, numFrames);
+      std::printf("  %-8s %-7s %8.0f %10.1f %12.2f %6.1f%%\n", (k == 0) ? s->name : "", kSendNames[k], rate,
+                  r.ingestNs, r.renderUs, 100.0*r.renderUs/blockUs);
+      if (r.hash != results[0].hash)
+      {
+        std::printf("  %-8s the output differs from the first\n", "");
+        failed = true;
+      }
+    }
+  }
+
+#if HV_RT_AUDIT
+  if (hRt_getNumViolations() > 0)
+  {
+    std::printf("  %u blocking calls in realtime code, reported at exit\n", hRt_getNumViolations());
+    failed = true;
+  }
+#endif
+
+  return failed ? 1 : 0;
+}
@@ -0,0 +1,241 @@
+/**
+ * Copyright (c) 2014-2018 Enzien Audio Ltd.
+ *
+ * Permission to use, copy, modify, and/or distribute this software for any
+ * purpose with or without fee is hereby granted, provided that the above
+ * copyright notice and this permission notice appear in all copies.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL WARRANTIES WITH
+ * REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED WARRANTIES OF MERCHANTABILITY
+ * AND FITNESS. IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR ANY SPECIAL, DIRECT,
+ * INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES WHATSOEVER RESULTING FROM
+ * LOSS OF USE, DATA OR PROFITS, WHETHER IN AN ACTION OF CONTRACT, NEGLIGENCE OR
+ * OTHER TORTIOUS ACTION, ARISING OUT OF OR IN CONNECTION WITH THE USE OR
+ * PERFORMANCE OF THIS SOFTWARE.
+ */
+
+/**
+ * Measures the latency from a note-on to the first sound of EP_MK1, through the MIDI input of the
+ * DPF plugin, for each block size.
+ *
+ *   EP_MK1-latency [-n events] [-d ms] [-r sample rate] [-s seed] [block size ...]
+ *
+ * The harness hosts the plugin as a DPF wrapper does. For each event a new instance renders a few
+ * silent blocks, the note-on arrives at a random frame of a block and is delivered with the next
+ * block, and the latency is the number of samples from its arrival to the first non-zero output
+ * sample. Each instance plays a single note, so that sample belongs to its voice. The latency is
+ * split into:
+ *
+ *   host   from the arrival to the frame the event is delivered at, one block for a host that
+ *          keeps the frame of each event ("frame"), up to one block for a host that delivers all
+ *          events at the start of the block ("start")
+ *   simd   from that frame to the start of its HV_N_SIMD step, where the context handles it
+ *   patch  from there to the first sound, the intentional delay of the patch of -d ms
+ *          followed by the onset of the voice, which is also shown on its own. The first
+ *          sound of a voice waits for the 3 ms [del] objects of its envelope, the 2 ms ones
+ *          only delay retriggers.
+ *
+ * Any spread of the patch part comes from the scheduling of the MIDI input and message queue. The
+ * SIMD backend is the one the harness is built with, see the Makefile.
+ */
+
+#include "src/DistrhoPlugin.cpp"
+#if __has_include("src/DistrhoUtils.cpp")
+#include "src/DistrhoUtils.cpp"
+#endif
+
+#include "HvUtils.h"
+
+#include <algorithm>
+#include <cmath>
+#include <vector>
+
+#if HV_SIMD_AVX
+#define HV_LATENCY_SIMD "AVX"
+#elif HV_SIMD_SSE
+#define HV_LATENCY_SIMD "SSE"
+#elif HV_SIMD_NEON
+#define HV_LATENCY_SIMD "NEON"
+#else
+#define HV_LATENCY_SIMD "none"
+#endif
+
+// the largest block size
+#define HV_LATENCY_MAX_FRAMES 8192
+
+// silent blocks rendered before an event arrives, at least
+#define HV_LATENCY_LEAD_BLOCKS 2
+
+// blocks rendered after an event is delivered before the note counts as silent
+#define HV_LATENCY_MAX_BLOCKS 64
+
+USE_NAMESPACE_DISTRHO
+
+struct LatencyEvent
+{
+  int host;
+  int simd;
+  int patch;
+};
+
+// xorshift, such that each run with the same seed injects the same events
+static uint32_t nextRandom(uint32_t *state)
+{
+  uint32_t x = *state;
+  x ^= x << 13;
+  x ^= x >> 17;
+  x ^= x << 5;
+  *state = x;
+  return x;
+}
+
+// renders one block, returns the frame of the first non-zero sample or -1 if the block is silent
+static int renderBlock(PluginExporter& plugin, float** outputs, uint32_t frames, const MidiEvent* events, uint32_t count)
+{
+  plugin.run(nullptr, outputs, frames, events, count);
+  for (uint32_t i = 0; i < frames; ++i)
+  {
+    for (uint32_t k = 0; k < DISTRHO_PLUGIN_NUM_OUTPUTS; ++k)
+    {
+      if (outputs[k][i] != 0.0f) return (int) i;
+    }
+  }
+  return -1;
+}
+
+// plays one note on a new instance, returns false if it stays silent or sounds before it arrives
+static bool measureEvent(uint32_t frames, bool keepFrame, uint32_t* seed, float** outputs, LatencyEvent* e)
+{
+  d_nextBufferSize = frames;
+  PluginExporter plugin(nullptr, nullptr, nullptr, nullptr);
+  plugin.activate();
+
+  const uint32_t numLeadBlocks = HV_LATENCY_LEAD_BLOCKS + nextRandom(seed) % 4;
+  for (uint32_t b = 0; b < numLeadBlocks; ++b)
+  {
+    if (renderBlock(plugin, outputs, frames, nullptr, 0) >= 0) return false;
+  }
+
+  // the note arrives while the last lead block is rendered
+  const uint32_t arrival = nextRandom(seed) % frames;
+  MidiEvent event;
+  std::memset(&event, 0, sizeof(event));
+  event.frame = keepFrame ? arrival : 0;
+  event.size = 3;
+  event.data[0] = 0x90;
+  event.data[1] = (uint8_t) (36 + nextRandom(seed) % 60); // pitch
+  event.data[2] = (uint8_t) (1 + nextRandom(seed) % 127); // velocity
+
+  // the blocks start at multiples of HV_N_SIMD
+  e->host = (int) (frames - arrival + event.frame);
+  e->simd = -(int) (event.frame & HV_N_SIMD_MASK);
+  for (uint32_t b = 0; b < HV_LATENCY_MAX_BLOCKS; ++b)
+  {
+    const int first = renderBlock(plugin, outputs, frames, &event, (b == 0) ? 1 : 0);
+    if (first >= 0)
+    {
+      e->patch = (int) (b*frames) + first - (int) event.frame - e->simd;
+      plugin.deactivate();
+      return true;
+    }
+  }
+  plugin.deactivate();
+  return false;
+}
+
+static void printStats(const char* label, std::vector<int>& x, double sampleRate)
+{
+  double sum = 0.0, sum2 = 0.0;
+  for (int v : x) { sum += v; sum2 += (double) v*v; }
+  const double mean = sum/x.size();
+  const double std = std::sqrt(std::max(0.0, sum2/x.size() - mean*mean));
+  std::sort(x.begin(), x.end());
+  std::printf("  %-6s %6d %8.1f %6d %6d %6d %7.1f %8.3f\n", label, x.front(), mean, x[x.size()/2],
+      x[(x.size()*99)/100], x.back(), std, mean*1000.0/sampleRate);
+}
+
+int main(int argc, char* argv[])
+{
+  int numEvents = 500;
+  double delayMs = 3.0;
+  double sampleRate = 48000.0;
+  uint32_t seed = 1;
+  std::vector<uint32_t> blockSizes;
+  for (int i = 1; i < argc; ++i)
+  {
+    if (std::strcmp(argv[i], "-n") == 0 && i+1 < argc) numEvents = std::atoi(argv[++i]);
+    else if (std::strcmp(argv[i], "-d") == 0 && i+1 < argc) delayMs = std::atof(argv[++i]);
+    else if (std::strcmp(argv[i], "-r") == 0 && i+1 < argc) sampleRate = std::atof(argv[++i]);
+    else if (std::strcmp(argv[i], "-s") == 0 && i+1 < argc) seed = (uint32_t) std::atoi(argv[++i]);
+    else if (argv[i][0] != '-') blockSizes.push_back((uint32_t) std::atoi(argv[i]));
+    else
+    {
+      std::fprintf(stderr, "usage: %s [-n events] [-d ms] [-r sample rate] [-s seed] [block size ...]\n", argv[0]);
+      return 1;
+    }
+  }
+  if (blockSizes.empty()) blockSizes = { 16, 32, 64, 128, 256, 512, 1024 };
+  for (uint32_t frames : blockSizes)
+  {
+    if (frames < HV_N_SIMD || frames > HV_LATENCY_MAX_FRAMES || (frames & HV_N_SIMD_MASK))
+    {
+      std::fprintf(stderr, "%s: block sizes must be multiples of %d of at most %d\n", argv[0],
+          HV_N_SIMD, HV_LATENCY_MAX_FRAMES);
+      return 1;
+    }
+  }
+  if (numEvents < 1 || sampleRate <= 0.0 || seed == 0)
+  {
+    std::fprintf(stderr, "%s: the number of events, the sample rate and the seed must be positive\n", argv[0]);
+    return 1;
+  }
+
+  float* outputs[DISTRHO_PLUGIN_NUM_OUTPUTS];
+  for (uint32_t k = 0; k < DISTRHO_PLUGIN_NUM_OUTPUTS; ++k)
+  {
+    outputs[k] = (float*) hv_malloc(HV_LATENCY_MAX_FRAMES*sizeof(float));
+  }
+
+  // the same conversion as the control delays of the patch
+  const int delay = (int) (hv_max_f(0.0f, (float) delayMs)*sampleRate/1000.0);
+  d_nextSampleRate = sampleRate;
+
+  std::printf("EP_MK1 note-on latency, SIMD %s (HV_N_SIMD %d), %g Hz, %d events per row\n",
+      HV_LATENCY_SIMD, HV_N_SIMD, sampleRate, numEvents);
+  std::printf("All columns are in samples but the last. The patch part includes a delay of %g ms (%d samples).\n",
+      delayMs, delay);
+  for (uint32_t frames : blockSizes)
+  {
+    for (int keepFrame = 1; keepFrame >= 0; --keepFrame)
+    {
+      std::vector<int> host, simd, patch, onset, total;
+      int numFailed = 0;
+      for (int i = 0; i < numEvents; ++i)
+      {
+        LatencyEvent e;
+        if (!measureEvent(frames, keepFrame != 0, &seed, outputs, &e))
+        {
+          ++numFailed;
+          continue;
+        }
+        host.push_back(e.host);
+        simd.push_back(e.simd);
+        patch.push_back(e.patch);
+        onset.push_back(e.patch - delay);
+        total.push_back(e.host + e.simd + e.patch);
+      }
+      std::printf("\nblock %u, %s host\n", frames, keepFrame ? "frame" : "start");
+      if (numFailed > 0) std::printf("  %d of %d notes were silent or sounded early\n", numFailed, numEvents);
+      if (total.empty()) continue;
+      std::printf("  %-6s %6s %8s %6s %6s %6s %7s %8s\n", "", "min", "mean", "p50", "p99", "max", "std", "mean ms");
+      printStats("host", host, sampleRate);
+      printStats("simd", simd, sampleRate);
+      printStats("patch", patch, sampleRate);
+      printStats("onset", onset, sampleRate);
+      printStats("total", total, sampleRate);
+    }
+  }
+
+  for (uint32_t k = 0; k < DISTRHO_PLUGIN_NUM_OUTPUTS; ++k) hv_free(outputs[k]);
+  return 0;
+}
@@ -0,0 +1,261 @@
+/**
+ * Copyright (c) 2014-2018 Enzien Audio Ltd.
+ *
+ * Permission to use, copy, modify, and/or distribute this software for any
+ * purpose with or without fee is hereby granted, provided that the above
+ * copyright notice and this permission notice appear in all copies.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL WARRANTIES WITH
+ * REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED WARRANTIES OF MERCHANTABILITY
+ * AND FITNESS. IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR ANY SPECIAL, DIRECT,
+ * INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES WHATSOEVER RESULTING FROM
+ * LOSS OF USE, DATA OR PROFITS, WHETHER IN AN ACTION OF CONTRACT, NEGLIGENCE OR
+ * OTHER TORTIOUS ACTION, ARISING OUT OF OR IN CONNECTION WITH THE USE OR
+ * PERFORMANCE OF THIS SOFTWARE.
+ */
+
+/**
+ * Compares rendering EP_MK1 through a render server with rendering it in process.
+ *
+ *   EP_MK1-server-bench [-n blocks] [-b block size] [-c clients] [-r sample rate]
+ *
+ * The benchmark forks a server, renders the same note pattern with one context in process and
+ * with each client, and prints the time per block of both, the round-trip overhead of the server
+ * and the throughput of all clients together. The output of every client must match the output
+ * rendered in process.
+ */
+
+#include "Heavy_EP_MK1.h"
+#include "HvRenderClient.h"
+
+#include <pthread.h>
+#include <signal.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/wait.h>
+#include <time.h>
+#include <unistd.h>
+
+#define HV_HASH_NOTEIN 0x67E37CA3
+
+typedef struct Bench {
+  int numBlocks;
+  int blockSize;
+  double sampleRate;
+  const char *name;
+} Bench;
+
+typedef struct BenchRun {
+  const Bench *bench;
+  hv_uint64_t *times; // ns of each block
+  hv_uint64_t hash; // of the output
+  hv_uint64_t start, end; // ns
+  bool failed;
+} BenchRun;
+
+static hv_uint64_t getClockNs(void) {
+  struct timespec t;
+  clock_gettime(CLOCK_MONOTONIC, &t);
+  return (hv_uint64_t) t.tv_sec*1000000000 + (hv_uint64_t) t.tv_nsec;
+}
+
+// FNV-1a of the bytes of the output
+static hv_uint64_t hashOutput(hv_uint64_t h, const float *const *outputs, int numChannels, int n) {
+  for (int k = 0; k < numChannels; ++k) {
+    const unsigned char *const p = (const unsigned char *) outputs[k];
+    for (int i = 0; i < n*(int) sizeof(float); ++i) h = (h ^ p[i]) * 0x100000001B3ULL;
+  }
+  return h;
+}
+
+// a chord of four notes every 16 blocks, released 8 blocks later, in the middle of the block
+static int getNotes(int block, float *pitches, float *velocity) {
+  if ((block & 7) != 0) return 0;
+  const int chord = block >> 4;
+  for (int j = 0; j < 4; ++j) pitches[j] = (float) (48 + (chord*5 + j*4) % 36);
+  *velocity = (block & 8) ? 0.0f : (float) (60 + (chord*7) % 60);
+  return 4;
+}
+
+static void runInProcess(BenchRun *r) {
+  const Bench *const b = r->bench;
+  HeavyContextInterface *const c = hv_EP_MK1_new(b->sampleRate);
+  hv_warmUp(c);
+  const int numChannels = hv_getNumOutputChannels(c);
+  float *outputs[HV_RENDER_MAX_CHANNELS];
+  for (int k = 0; k < numChannels; ++k) outputs[k] = (float *) hv_malloc(b->blockSize*sizeof(float));
+
+  r->hash = 0xCBF29CE484222325ULL;
+  r->start = getClockNs();
+  for (int i = 0; i < b->numBlocks; ++i) {
+    const hv_uint64_t t = getClockNs();
+    float pitches[4], velocity;
+    const int numNotes = getNotes(i, pitches, &velocity);
+    for (int j = 0; j < numNotes; ++j) {
+      hv_sendFloats3(c, HV_HASH_NOTEIN, (hv_uint32_t) b->blockSize/2, pitches[j], velocity, 0.0f);
+    }
+    hv_process(c, NULL, outputs, b->blockSize);
+    r->times[i] = getClockNs() - t;
+    r->hash = hashOutput(r->hash, (const float *const *) outputs, numChannels, b->blockSize);
+  }
+  r->end = getClockNs();
+
+  for (int k = 0; k < numChannels; ++k) hv_free(outputs[k]);
+  hv_EP_MK1_free(c);
+}
+
+static void *runClient(void *x) {
+  BenchRun *const r = (BenchRun *) x;
+  const Bench *const b = r->bench;
+  HvRenderClient client;
+  r->failed = !hRc_open(&client, b->name, 1000);
+  if (r->failed) return NULL;
+
+  r->hash = 0xCBF29CE484222325ULL;
+  r->start = getClockNs();
+  for (int i = 0; i < b->numBlocks && !r->failed; ++i) {
+    const hv_uint64_t t = getClockNs();
+    float pitches[4], velocity;
+    const int numNotes = getNotes(i, pitches, &velocity);
+    for (int j = 0; j < numNotes; ++j) {
+      hRc_sendFloats(&client, HV_HASH_NOTEIN, (hv_uint32_t) b->blockSize/2, 3, pitches[j], velocity, 0.0f);
+    }
+    r->failed = (hRc_process(&client, b->blockSize) != b->blockSize);
+    r->times[i] = getClockNs() - t;
+    r->hash = hashOutput(r->hash, client.outputs, client.numChannels, b->blockSize);
+  }
+  r->end = getClockNs();
+
+  hRc_close(&client);
+  return NULL;
+}
+
+static int compareTimes(const void *a, const void *b) {
+  const hv_uint64_t x = *(const hv_uint64_t *) a;
+  const hv_uint64_t y = *(const hv_uint64_t *) b;
+  return (x > y) - (x < y);
+}
+
+// sorts the times and prints their statistics in us, returns the mean
+static double printTimes(const char *label, hv_uint64_t *times, int n) {
+  double sum = 0.0;
+  for (int i = 0; i < n; ++i) sum += (double) times[i];
+  qsort(times, (size_t) n, sizeof(hv_uint64_t), &compareTimes);
+  const double mean = sum/n;
+  printf("%-12s mean %8.2f us  p50 %8.2f us  p99 %8.2f us  max %8.2f us\n", label, mean*1.0e-3,
+      times[n/2]*1.0e-3, times[(n*99)/100]*1.0e-3, times[n-1]*1.0e-3);
+  return mean;
+}
+
+// runs a render server until it receives SIGTERM
+static int serve(const Bench *b, int numSlots) {
+  sigset_t signals;
+  sigemptyset(&signals);
+  sigaddset(&signals, SIGTERM);
+  pthread_sigmask(SIG_BLOCK, &signals, NULL);
+  HvRenderServer server;
+  if (!hRs_open(&server, b->name, numSlots, b->sampleRate, 0, &hv_EP_MK1_new, &hv_EP_MK1_free)) return 1;
+  int signal = 0;
+  sigwait(&signals, &signal);
+  hRs_close(&server);
+  return 0;
+}
+
+int main(int argc, char **argv) {
+  Bench b;
+  b.numBlocks = 20000;
+  b.blockSize = 64;
+  b.sampleRate = 48000.0;
+  int numClients = 1;
+  int opt;
+  while ((opt = getopt(argc, argv, "n:b:c:r:")) != -1) {
+    switch (opt) {
+      case 'n': b.numBlocks = atoi(optarg); break;
+      case 'b': b.blockSize = atoi(optarg); break;
+      case 'c': numClients = atoi(optarg); break;
+      case 'r': b.sampleRate = atof(optarg); break;
+      default: {
+        fprintf(stderr, "usage: %s [-n blocks] [-b block size] [-c clients] [-r sample rate]\n", argv[0]);
+        return 1;
+      }
+    }
+  }
+  if (b.numBlocks < 1 || numClients < 1 || b.sampleRate <= 0.0
+      || b.blockSize < HV_N_SIMD || b.blockSize > HV_RENDER_MAX_FRAMES || (b.blockSize & HV_N_SIMD_MASK)) {
+    fprintf(stderr, "%s: the block size must be a multiple of %d of at most %d\n", argv[0],
+        HV_N_SIMD, HV_RENDER_MAX_FRAMES);
+    return 1;
+  }
+  char name[64];
+  hv_snprintf(name, sizeof(name), "EP_MK1-bench-%d", (int) getpid());
+  b.name = name;
+
+  const pid_t server = fork();
+  if (server == 0) return serve(&b, numClients);
+
+  BenchRun local;
+  local.bench = &b;
+  local.times = (hv_uint64_t *) malloc(b.numBlocks*sizeof(hv_uint64_t));
+  runInProcess(&local);
+
+  // the server is up by now, or soon
+  BenchRun *const runs = (BenchRun *) malloc(numClients*sizeof(BenchRun));
+  HvRenderClient probe;
+  for (int i = 0; i < 500 && !hRc_open(&probe, b.name, 1000); ++i) usleep(10000);
+  if (!hRc_isOpen(&probe)) {
+    fprintf(stderr, "%s: could not connect to the render server\n", argv[0]);
+    kill(server, SIGTERM);
+    waitpid(server, NULL, 0);
+    return 1;
+  }
+  hRc_close(&probe);
+
+  pthread_t *const threads = (pthread_t *) malloc(numClients*sizeof(pthread_t));
+  for (int i = 0; i < numClients; ++i) {
+    runs[i].bench = &b;
+    runs[i].times = (hv_uint64_t *) malloc(b.numBlocks*sizeof(hv_uint64_t));
+    pthread_create(threads+i, NULL, &runClient, runs+i);
+  }
+  for (int i = 0; i < numClients; ++i) pthread_join(threads[i], NULL);
+  kill(server, SIGTERM);
+  waitpid(server, NULL, 0);
+
+  bool ok = true;
+  hv_uint64_t start = runs[0].start, end = runs[0].end;
+  for (int i = 0; i < numClients; ++i) {
+    if (runs[i].failed) {
+      fprintf(stderr, "%s: client %d failed\n", argv[0], i);
+      ok = false;
+    } else if (runs[i].hash != local.hash) {
+      fprintf(stderr, "%s: the output of client %d differs from the output in process\n", argv[0], i);
+      ok = false;
+    }
+    if (runs[i].start < start) start = runs[i].start;
+    if (runs[i].end > end) end = runs[i].end;
+  }
+
+  const double blockMs = 1000.0*b.blockSize/b.sampleRate;
+  printf("%d blocks of %d frames (%.3f ms) at %g Hz, %d client(s)\n", b.numBlocks, b.blockSize, blockMs,
+      b.sampleRate, numClients);
+  const double localMean = printTimes("in process", local.times, b.numBlocks);
+  double remoteMean = 0.0;
+  if (ok) {
+    // the times of all clients together
+    hv_uint64_t *const all = (hv_uint64_t *) malloc(numClients*b.numBlocks*sizeof(hv_uint64_t));
+    for (int i = 0; i < numClients; ++i) memcpy(all + i*b.numBlocks, runs[i].times, b.numBlocks*sizeof(hv_uint64_t));
+    remoteMean = printTimes("server", all, numClients*b.numBlocks);
+    free(all);
+    const double localSeconds = (local.end-local.start)*1.0e-9;
+    const double remoteSeconds = (end-start)*1.0e-9;
+    printf("round trip overhead %.2f us per block\n", (remoteMean-localMean)*1.0e-3);
+    printf("throughput in process %.0f blocks/s (%.1fx realtime), server %.0f blocks/s (%.1fx realtime)\n",
+        b.numBlocks/localSeconds, b.numBlocks*blockMs*1.0e-3/localSeconds,
+        numClients*b.numBlocks/remoteSeconds, numClients*b.numBlocks*blockMs*1.0e-3/remoteSeconds);
+  }
+
+  for (int i = 0; i < numClients; ++i) free(runs[i].times);
+  free(runs);
+  free(threads);
+  free(local.times);
+  return ok ? 0 : 1;
+}
@@ -0,0 +1,79 @@
+/**
+ * Copyright (c) 2014-2018 Enzien Audio Ltd.
+ *
+ * Permission to use, copy, modify, and/or distribute this software for any
+ * purpose with or without fee is hereby granted, provided that the above
+ * copyright notice and this permission notice appear in all copies.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL WARRANTIES WITH
+ * REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED WARRANTIES OF MERCHANTABILITY
+ * AND FITNESS. IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR ANY SPECIAL, DIRECT,
+ * INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES WHATSOEVER RESULTING FROM
+ * LOSS OF USE, DATA OR PROFITS, WHETHER IN AN ACTION OF CONTRACT, NEGLIGENCE OR
+ * OTHER TORTIOUS ACTION, ARISING OUT OF OR IN CONNECTION WITH THE USE OR
+ * PERFORMANCE OF THIS SOFTWARE.
+ */
+
+/**
+ * Hosts EP_MK1 contexts for clients in other processes, see HvRenderServer.h.
+ *
+ *   EP_MK1-server [-s slots] [-r sample rate] [-p priority] [-m] [name]
+ *
+ * The server runs until it receives SIGINT or SIGTERM. -p runs the slot threads SCHED_FIFO at the
+ * given priority and -m locks all memory of the process.
+ */
+
+#include "Heavy_EP_MK1.h"
+#include "HvRenderServer.h"
+
+#include <errno.h>
+#include <signal.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/mman.h>
+#include <unistd.h>
+
+int main(int argc, char **argv) {
+  int numSlots = 16;
+  double sampleRate = 48000.0;
+  int priority = 0;
+  bool lock = false;
+  int opt;
+  while ((opt = getopt(argc, argv, "s:r:p:m")) != -1) {
+    switch (opt) {
+      case 's': numSlots = atoi(optarg); break;
+      case 'r': sampleRate = atof(optarg); break;
+      case 'p': priority = atoi(optarg); break;
+      case 'm': lock = true; break;
+      default: {
+        fprintf(stderr, "usage: %s [-s slots] [-r sample rate] [-p priority] [-m] [name]\n", argv[0]);
+        return 1;
+      }
+    }
+  }
+  const char *const name = (optind < argc) ? argv[optind] : "EP_MK1";
+  if (numSlots < 1 || sampleRate <= 0.0) {
+    fprintf(stderr, "%s: the number of slots and the sample rate must be positive\n", argv[0]);
+    return 1;
+  }
+
+  // the signals are taken by sigwait() below, the slot threads inherit the mask
+  sigset_t signals;
+  sigemptyset(&signals);
+  sigaddset(&signals, SIGINT);
+  sigaddset(&signals, SIGTERM);
+  pthread_sigmask(SIG_BLOCK, &signals, NULL);
+
+  if (lock && mlockall(MCL_CURRENT | MCL_FUTURE) != 0) {
+    fprintf(stderr, "%s: could not lock memory: %s\n", argv[0], strerror(errno));
+  }
+
+  HvRenderServer server;
+  if (!hRs_open(&server, name, numSlots, sampleRate, priority, &hv_EP_MK1_new, &hv_EP_MK1_free)) return 1;
+  fprintf(stderr, "%s: serving /%s with %d slots at %g Hz\n", argv[0], name, numSlots, sampleRate);
+
+  int signal = 0;
+  sigwait(&signals, &signal);
+  hRs_close(&server);
+  return 0;
+}
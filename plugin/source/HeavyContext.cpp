@@ -16,6 +16,28 @@
 
 #include "HeavyContext.hpp"
 #include "HvTable.h"
+#include "HvWorkerPool.hpp"
+
+#include <chrono>
+
+static_assert(hv_string_to_hash_k("flush") == HV_MSG_HASH_FLUSH, "hash mismatch");
+static_assert(hv_string_to_hash_k("clear") == HV_MSG_HASH_CLEAR, "hash mismatch");
+static_assert(hv_string_to_hash_k("stop") == HV_MSG_HASH_STOP, "hash mismatch");
+static_assert(hv_string_to_hash_k("resize") == HV_MSG_HASH_RESIZE, "hash mismatch");
+static_assert(hv_string_to_hash_k("mirror") == HV_MSG_HASH_MIRROR, "hash mismatch");
+static_assert(hv_string_to_hash_k("samplerate") == HV_MSG_HASH_SAMPLERATE, "hash mismatch");
+static_assert(hv_string_to_hash_k("numInputChannels") == HV_MSG_HASH_NUMINPUTCHANNELS, "hash mismatch");
+static_assert(hv_string_to_hash_k("numOutputChannels") == HV_MSG_HASH_NUMOUTPUTCHANNELS, "hash mismatch");
+static_assert(hv_string_to_hash_k("currentTime") == HV_MSG_HASH_CURRENTTIME, "hash mismatch");
+static_assert(hv_string_to_hash_k("table") == HV_MSG_HASH_TABLE, "hash mismatch");
+static_assert(hv_string_to_hash_k(HV_LOAD_TIER_SEND_NAME) == HV_LOAD_TIER_SEND_HASH, "hash mismatch");
+static_assert(hv_string_to_hash_k("length") == HV_MSG_HASH_LENGTH, "hash mismatch");
+static_assert(hv_string_to_hash_k("size") == HV_MSG_HASH_SIZE, "hash mismatch");
+static_assert(hv_string_to_hash_k("head") == HV_MSG_HASH_HEAD, "hash mismatch");
+#if defined(__BYTE_ORDER__) && !HV_EMSCRIPTEN
+// hv_string_to_hash() reads native words, the constants above and in the generated code are little-endian
+static_assert(__BYTE_ORDER__ == __ORDER_LITTLE_ENDIAN__, "hv_string_to_hash() assumes a little-endian target");
+#endif
 
 void defaultSendHook(HeavyContextInterface *context,
     const char *sendName, hv_uint32_t sendHash, const HvMessage *msg) {
@@ -42,6 +64,18 @@ HeavyContext::HeavyContext(double sampleRate, int poolKb, int inQueueKb, int out
   hv_assert(outQueueKb >= 0);
 
   blockStartTimestamp = 0;
+  numSilentBlocks = 0;
+  silentBlocksBeforeSleep = HV_SILENT_BLOCKS_BEFORE_SLEEP;
+  isAsleep = false;
+  cpuBudget = 0.0f;
+  cpuLoad = 0.0f;
+  loadTier = 0;
+  numLoadTiers = 0;
+  numBlocksOverBudget = 0;
+  numBlocksUnderBudget = 0;
+  numBlocksSinceRaise = 0;
+  renderPool = nullptr;
+  renderMinBlockSize = 0;
   printHook = nullptr;
   userData = nullptr;
 
@@ -60,6 +94,7 @@ HeavyContext::HeavyContext(double sampleRate, int poolKb, int inQueueKb, int out
 }
 
 HeavyContext::~HeavyContext() {
+  delete renderPool;
   mq_free(&mq);
   hLp_free(&inQueue);
   hLp_free(&outQueue);
@@ -93,21 +128,8 @@ bool HeavyContext::sendMessageToReceiverV(hv_uint32_t receiverHash, double delay
 
   va_list ap;
   va_start(ap, format);
-  const int numElem = (int) hv_strlen(format);
-  HvMessage *m = HV_MESSAGE_ON_STACK(numElem);
-  msg_init(m, numElem, blockStartTimestamp + (hv_uint32_t) (hv_max_d(0.0, delayMs)*getSampleRate()/1000.0));
-  for (int i = 0; i < numElem; i++) {
-    switch (format[i]) {
-      case 'b': msg_setBang(m, i); break;
-      case 'f': msg_setFloat(m, i, (float) va_arg(ap, double)); break;
-      case 'h': msg_setHash(m, i, (int) va_arg(ap, int)); break;
-      case 's': msg_setSymbol(m, i, (char *) va_arg(ap, char *)); break;
-      default: break;
-    }
-  }
+  bool success = enqueueMessageV(receiverHash, timestampForDelay(delayMs), format, ap);
   va_end(ap);
-
-  bool success = sendMessageToReceiver(receiverHash, delayMs, m);
   return success;
 }
 
@@ -115,9 +137,56 @@ bool HeavyContext::sendMessageToReceiver(hv_uint32_t receiverHash, double delayM
   hv_assert(delayMs >= 0.0);
   hv_assert(m != nullptr);
 
-  const hv_uint32_t timestamp = blockStartTimestamp +
-      (hv_uint32_t) (hv_max_d(0.0, delayMs)*(getSampleRate()/1000.0));
+  return enqueueMessage(receiverHash, timestampForDelay(delayMs), m);
+}
+
+bool HeavyContext::sendMessageAtSampleV(hv_uint32_t receiverHash, hv_uint64_t sample, const char *format, ...) {
+  hv_assert(format != nullptr);
+
+  va_list ap;
+  va_start(ap, format);
+  bool success = enqueueMessageV(receiverHash, timestampForSample(sample), format, ap);
+  va_end(ap);
+  return success;
+}
+
+bool HeavyContext::sendMessageAtSample(hv_uint32_t receiverHash, hv_uint64_t sample, HvMessage *m) {
+  hv_assert(m != nullptr);
+
+  return enqueueMessage(receiverHash, timestampForSample(sample), m);
+}
+
+bool HeavyContext::enqueueMessageV(hv_uint32_t receiverHash, hv_uint32_t timestamp, const char *format, va_list ap) {
+  const int numElem = (int) hv_strlen(format);
 
+  // the message is built directly in the input queue, rather than on the stack and then copied
+  ReceiverMessagePair *p = nullptr;
+  HV_SPINLOCK_ACQUIRE(inQueueLock);
+  const hv_uint32_t numBytes = sizeof(ReceiverMessagePair) + msg_getCoreSize(numElem) - sizeof(HvMessage);
+  p = (ReceiverMessagePair *) hLp_getWriteBuffer(&inQueue, numBytes);
+  if (p != nullptr) {
+    p->receiverHash = receiverHash;
+    HvMessage *m = msg_init(&p->msg, numElem, timestamp);
+    for (int i = 0; i < numElem; i++) {
+      switch (format[i]) {
+        case 'b': msg_setBang(m, i); break;
+        case 'f': msg_setFloat(m, i, (float) va_arg(ap, double)); break;
+        case 'h': msg_setHash(m, i, (int) va_arg(ap, int)); break;
+        case 's': msg_setSymbol(m, i, (char *) va_arg(ap, char *)); break;
+        default: break;
+      }
+    }
+    hLp_produce(&inQueue, numBytes);
+  } else {
+    hv_assert(false &&
+        "::sendMessageToReceiverV - The input message queue is full and cannot accept more messages until they "
+        "have been processed. Try increasing the inQueueKb size in the new_with_options() constructor.");
+  }
+  HV_SPINLOCK_RELEASE(inQueueLock);
+  return (p != nullptr);
+}
+
+bool HeavyContext::enqueueMessage(hv_uint32_t receiverHash, hv_uint32_t timestamp, const HvMessage *m) {
   ReceiverMessagePair *p = nullptr;
   HV_SPINLOCK_ACQUIRE(inQueueLock);
   const hv_uint32_t numBytes = sizeof(ReceiverMessagePair) + msg_getSize(m) - sizeof(HvMessage);
@@ -136,15 +205,188 @@ bool HeavyContext::sendMessageToReceiver(hv_uint32_t receiverHash, double delayM
   return (p != nullptr);
 }
 
+bool HeavyContext::sendFloats1(hv_uint32_t receiverHash, hv_uint32_t sampleOffset, float a) {
+  return enqueueFloats(receiverHash, sampleOffset, &a, 1);
+}
+
+bool HeavyContext::sendFloats2(hv_uint32_t receiverHash, hv_uint32_t sampleOffset, float a, float b) {
+  const float f[2] = {a, b};
+  return enqueueFloats(receiverHash, sampleOffset, f, 2);
+}
+
+bool HeavyContext::sendFloats3(hv_uint32_t receiverHash, hv_uint32_t sampleOffset, float a, float b, float c) {
+  const float f[3] = {a, b, c};
+  return enqueueFloats(receiverHash, sampleOffset, f, 3);
+}
+
+int HeavyContext::sendFloatEvents(const HvFloatEvent *events, int numEvents) {
+  hv_assert(events != nullptr || numEvents == 0);
+
+  int i = 0;
+  HV_SPINLOCK_ACQUIRE(inQueueLock);
+  for (; i < numEvents; ++i) {
+    const HvFloatEvent *const e = events+i;
+    hv_assert(e->numFloats >= 1 && e->numFloats <= 3);
+    if (!writeFloats(e->receiverHash, timestampForOffset(e->sampleOffset), e->f, (int) e->numFloats)) break;
+  }
+  HV_SPINLOCK_RELEASE(inQueueLock);
+  hv_assert(i == numEvents &&
+      "::sendFloatEvents - The input message queue is full and cannot accept more messages until they "
+      "have been processed. Try increasing the inQueueKb size in the new_with_options() constructor.");
+  return i;
+}
+
+bool HeavyContext::enqueueFloats(hv_uint32_t receiverHash, hv_uint32_t sampleOffset, const float *f, int numFloats) {
+  HV_SPINLOCK_ACQUIRE(inQueueLock);
+  const bool success = writeFloats(receiverHash, timestampForOffset(sampleOffset), f, numFloats);
+  HV_SPINLOCK_RELEASE(inQueueLock);
+  hv_assert(success &&
+      "::sendFloats - The input message queue is full and cannot accept more messages until they "
+      "have been processed. Try increasing the inQueueKb size in the new_with_options() constructor.");
+  return success;
+}
+
+bool HeavyContext::writeFloats(hv_uint32_t receiverHash, hv_uint32_t timestamp, const float *f, int numFloats) {
+  const hv_uint32_t numBytes = sizeof(ReceiverMessagePair) + msg_getCoreSize(numFloats) - sizeof(HvMessage);
+  ReceiverMessagePair *p = (ReceiverMessagePair *) hLp_getWriteBuffer(&inQueue, numBytes);
+  if (p == nullptr) return false;
+  p->receiverHash = receiverHash;
+  HvMessage *m = msg_init(&p->msg, numFloats, timestamp);
+  for (int i = 0; i < numFloats; ++i) msg_setFloat(m, i, f[i]);
+  hLp_produce(&inQueue, numBytes);
+  return true;
+}
+
 bool HeavyContext::cancelMessage(HvMessage *m, void (*sendMessage)(HeavyContextInterface *, int, const HvMessage *)) {
   return mq_removeMessage(&mq, m, sendMessage);
 }
 
-HvMessage *HeavyContext::scheduleMessageForObject(const HvMessage *m,
-    void (*sendMessage)(HeavyContextInterface *, int, const HvMessage *),
-    int letIndex) {
-  HvMessage *n = mq_addMessageByTimestamp(&mq, m, letIndex, sendMessage);
-  return n;
+void HeavyContext::setSilentBlocksBeforeSleep(int numBlocks) {
+  hv_assert(numBlocks >= 0);
+  silentBlocksBeforeSleep = (hv_uint32_t) hv_max_i(numBlocks, 0);
+  numSilentBlocks = 0;
+  isAsleep = false;
+}
+
+bool HeavyContext::processAsleep(float **outputBuffers, int numChannels, int n4) {
+  if (isAsleep) {
+    if (!mq_hasMessageBefore(&mq, (hv_uint32_t) blockStartTimestamp + n4)) {
+      for (int i = 0; i < numChannels; ++i) {
+        hv_memclear(outputBuffers[i], n4*sizeof(float));
+      }
+      blockStartTimestamp += n4;
+      return true;
+    }
+    isAsleep = false; // a message is due, wake up
+    numSilentBlocks = 0;
+  }
+  return false;
+}
+
+void HeavyContext::updateSilence(float **outputBuffers, int numChannels, int n4, bool voicesIdle) {
+  if (silentBlocksBeforeSleep == 0) return;
+  if (!voicesIdle) {
+    numSilentBlocks = 0;
+    return;
+  }
+  for (int i = 0; i < numChannels; ++i) {
+    const float *const b = outputBuffers[i];
+    for (int j = 0; j < n4; ++j) {
+      if (hv_abs_f(b[j]) >= HV_SILENCE_THRESHOLD) {
+        numSilentBlocks = 0;
+        return;
+      }
+    }
+  }
+  if (++numSilentBlocks >= silentBlocksBeforeSleep) {
+    isAsleep = true;
+  }
+}
+
+void HeavyContext::setCpuBudget(float fraction) {
+  hv_assert(fraction >= 0.0f);
+  // only the audio thread changes the tier, the next block restores full quality if disabled
+  cpuBudget = hv_max_f(fraction, 0.0f);
+}
+
+#if HV_LOAD_SHEDDING
+hv_uint64_t HeavyContext::getLoadClockNs() {
+  return (hv_uint64_t) std::chrono::duration_cast<std::chrono::nanoseconds>(
+      std::chrono::steady_clock::now().time_since_epoch()).count();
+}
+
+void HeavyContext::updateLoad(hv_uint64_t startNs, int n4) {
+  const hv_uint64_t endNs = getLoadClockNs();
+  const double blockNs = 1.0e9*n4/sampleRate;
+  const float load = (float) ((endNs-startNs)/blockNs);
+
+  // one-pole smoothing over about eight blocks rides out single preempted blocks
+  cpuLoad += 0.125f * (load - cpuLoad);
+
+  ++numBlocksSinceRaise;
+  if (cpuLoad > cpuBudget) {
+    numBlocksUnderBudget = 0;
+    if (++numBlocksOverBudget >= HV_LOAD_BLOCKS_BEFORE_SHEDDING
+        && numBlocksSinceRaise >= HV_LOAD_BLOCKS_BETWEEN_RAISES
+        && loadTier < numLoadTiers) {
+      setLoadTier(loadTier+1);
+      numBlocksSinceRaise = 0;
+    }
+  } else {
+    numBlocksOverBudget = 0;
+    // restore with hysteresis, a lower tier must not immediately exceed the budget again
+    if (cpuLoad < HV_LOAD_RESTORE_RATIO*cpuBudget) {
+      if (++numBlocksUnderBudget >= HV_LOAD_BLOCKS_BEFORE_RESTORE && loadTier > 0) {
+        setLoadTier(loadTier-1);
+      }
+    } else {
+      numBlocksUnderBudget = 0;
+    }
+  }
+}
+#endif
+
+void HeavyContext::setLoadTier(int tier) {
+  hv_assert(tier >= 0 && tier <= numLoadTiers);
+  loadTier = tier;
+  numBlocksOverBudget = 0;
+  numBlocksUnderBudget = 0;
+  applyLoadTier(tier);
+  if (sendHook != nullptr) {
+    HvMessage *m = HV_MESSAGE_ON_STACK(2);
+    msg_init(m, 2, (hv_uint32_t) blockStartTimestamp);
+    msg_setFloat(m, 0, (float) tier);
+    msg_setFloat(m, 1, cpuLoad);
+    sendHook(this, HV_LOAD_TIER_SEND_NAME, HV_LOAD_TIER_SEND_HASH, m);
+  }
+}
+
+bool HeavyContext::setRenderPool(int numThreads, int minBlockSize) {
+  hv_assert(numThreads >= 0);
+  hv_assert(minBlockSize >= 0);
+  delete renderPool;
+  renderPool = (numThreads > 0) ? new HvWorkerPool(numThreads) : nullptr;
+  renderMinBlockSize = minBlockSize;
+  return (renderPool != nullptr);
+}
+
+void HeavyContext::warmUp() {
+  mq_reserve(&mq);
+  HV_SPINLOCK_ACQUIRE(inQueueLock); // other threads may be writing messages
+  hv_prefault(inQueue.buffer, inQueue.len);
+  HV_SPINLOCK_RELEASE(inQueueLock);
+  hv_prefault(outQueue.buffer, outQueue.len);
+}
+
+void HeavyContext::clearMessages() {
+  // drain the input queue without dispatching it
+  while (hLp_hasData(&inQueue)) {
+    hv_uint32_t numBytes = 0;
+    hLp_getReadBuffer(&inQueue, &numBytes);
+    hLp_consume(&inQueue);
+  }
+  // the queue is only cleared once processing has started, it holds the loadbangs until then
+  if (blockStartTimestamp > 0) mq_clear(&mq);
 }
 
 float *HeavyContext::getBufferForTable(hv_uint32_t tableHash) {
@@ -164,8 +406,21 @@ int HeavyContext::getLengthForTable(hv_uint32_t tableHash) {
 bool HeavyContext::setLengthForTable(hv_uint32_t tableHash, hv_uint32_t newSampleLength) {
   HvTable *t = getTableForHash(tableHash);
   if (t != nullptr) {
-    hTable_resize(t, newSampleLength);
-    return true;
+    return hTable_publishResize(t, newSampleLength);
+  } else return false;
+}
+
+float *HeavyContext::prepareTableUpdate(hv_uint32_t tableHash, hv_uint32_t newSampleLength) {
+  HvTable *t = getTableForHash(tableHash);
+  if (t != nullptr) {
+    return hTable_prepareUpdate(t, newSampleLength);
+  } else return nullptr;
+}
+
+bool HeavyContext::publishTableUpdate(hv_uint32_t tableHash) {
+  HvTable *t = getTableForHash(tableHash);
+  if (t != nullptr) {
+    return hTable_publishUpdate(t);
   } else return false;
 }
 
@@ -232,15 +487,6 @@ void _hv_scheduleMessageForReceiver(HeavyContextInterface *c, hv_uint32_t receiv
   reinterpret_cast<HeavyContext *>(c)->scheduleMessageForReceiver(receiverHash, m);
 }
 
-HvMessage *_hv_scheduleMessageForObject(HeavyContextInterface *c, const HvMessage *m,
-    void (*sendMessage)(HeavyContextInterface *, int, const HvMessage *),
-    int letIndex) {
-  hv_assert(c != nullptr);
-  HvMessage *n = reinterpret_cast<HeavyContext *>(c)->scheduleMessageForObject(
-      m, sendMessage, letIndex);
-  return n;
-}
-
 #ifdef __cplusplus
 extern "C" {
 #endif
@@ -253,12 +499,6 @@ void hv_scheduleMessageForReceiver(HeavyContextInterface *c, hv_uint32_t receive
   _hv_scheduleMessageForReceiver(c, receiverHash, m);
 }
 
-HvMessage *hv_scheduleMessageForObject(HeavyContextInterface *c, const HvMessage *m,
-    void (*sendMessage)(HeavyContextInterface *, int, const HvMessage *),
-    int letIndex) {
-  return _hv_scheduleMessageForObject(c, m, sendMessage, letIndex);
-}
-
 #ifdef __cplusplus
 }
 #endif
@@ -21,8 +21,38 @@
 #include "HvLightPipe.h"
 #include "HvMessageQueue.h"
 #include "HvMath.h"
+#include "HvHeavyInternal.h"
+
+// output level below which a block counts as silent (-120 dBFS)
+#define HV_SILENCE_THRESHOLD 1.0e-6f
+
+// default number of consecutive silent blocks after which the context sleeps
+#define HV_SILENT_BLOCKS_BEFORE_SLEEP 16
+
+// load shedding measures the time of every block while a cpu budget is set, build with
+// HV_LOAD_SHEDDING=0 to compile the measurement out entirely
+#ifndef HV_LOAD_SHEDDING
+#define HV_LOAD_SHEDDING 1
+#endif
+
+// number of consecutive blocks over the cpu budget after which the load tier is raised
+#define HV_LOAD_BLOCKS_BEFORE_SHEDDING 4
+
+// minimum number of blocks between two raises of the load tier, so that the effect of a tier is measured
+#define HV_LOAD_BLOCKS_BETWEEN_RAISES 32
+
+// number of consecutive blocks below HV_LOAD_RESTORE_RATIO of the budget after which the tier is lowered
+#define HV_LOAD_BLOCKS_BEFORE_RESTORE 1000
+#define HV_LOAD_RESTORE_RATIO 0.5f
+
+// number of frames per voice that are rendered in parallel between two reductions
+#define HV_RENDER_BUFFER_LENGTH 1024
+
+// sub-blocks shorter than this are rendered on the calling thread only
+#define HV_RENDER_MIN_JOB_LENGTH 64
 
 struct HvTable;
+class HvWorkerPool;
 
 class HeavyContext : public HeavyContextInterface {
 
@@ -32,11 +62,12 @@ class HeavyContext : public HeavyContextInterface {
 
   int getSize() override { return (int) numBytes; }
 
-  double getSampleRate() override { return sampleRate; }
+  double getSampleRate() final { return sampleRate; }
 
-  hv_uint32_t getCurrentSample() override { return blockStartTimestamp; }
-  float samplesToMilliseconds(hv_uint32_t numSamples) override { return (float) (1000.0*numSamples/sampleRate); }
-  hv_uint32_t millisecondsToSamples(float ms) override { return (hv_uint32_t) (hv_max_f(0.0f,ms)*sampleRate/1000.0); }
+  hv_uint32_t getCurrentSample() final { return (hv_uint32_t) blockStartTimestamp; }
+  hv_uint64_t getCurrentSample64() final { return blockStartTimestamp; }
+  float samplesToMilliseconds(hv_uint32_t numSamples) final { return (float) (1000.0*numSamples/sampleRate); }
+  hv_uint32_t millisecondsToSamples(float ms) final { return hv_millisecondsToSamples_r(sampleRate, ms); }
 
   void setUserData(void *x) override { userData = x; }
   void *getUserData() override { return userData; }
@@ -48,18 +79,45 @@ class HeavyContext : public HeavyContextInterface {
   void setPrintHook(HvPrintHook_t *f) override { printHook = f; }
   HvPrintHook_t *getPrintHook() override { return printHook; }
 
+  // sleep management
+  bool isOutputSilent() override { return isAsleep; }
+  void setSilentBlocksBeforeSleep(int numBlocks) override;
+
+  // load shedding, without effect unless the patch sets numLoadTiers
+  void setCpuBudget(float fraction) override;
+  float getCpuLoad() override { return cpuLoad; }
+  int getLoadTier() override { return loadTier; }
+
+  // parallel rendering, unsupported unless the patch overrides it
+  bool setRenderThreads(int numThreads, int minBlockSize) override { return false; }
+
+  // activation, patches extend these with their own state
+  void warmUp() override;
+  void clearMessages() override;
+
   // message scheduling
-  bool sendMessageToReceiver(hv_uint32_t receiverHash, double delayMs, HvMessage *m) override;
+  bool sendMessageToReceiver(hv_uint32_t receiverHash, double delayMs, HvMessage *m) final;
   bool sendMessageToReceiverV(hv_uint32_t receiverHash, double delayMs, const char *fmt, ...) override;
+  bool sendMessageAtSample(hv_uint32_t receiverHash, hv_uint64_t sample, HvMessage *m) final;
+  bool sendMessageAtSampleV(hv_uint32_t receiverHash, hv_uint64_t sample, const char *fmt, ...) override;
+  bool sendFloats1(hv_uint32_t receiverHash, hv_uint32_t sampleOffset, float a) final;
+  bool sendFloats2(hv_uint32_t receiverHash, hv_uint32_t sampleOffset, float a, float b) final;
+  bool sendFloats3(hv_uint32_t receiverHash, hv_uint32_t sampleOffset, float a, float b, float c) final;
+  int sendFloatEvents(const HvFloatEvent *events, int numEvents) final;
   bool sendFloatToReceiver(hv_uint32_t receiverHash, float f) override;
   bool sendBangToReceiver(hv_uint32_t receiverHash) override;
   bool sendSymbolToReceiver(hv_uint32_t receiverHash, const char *symbol) override;
-  bool cancelMessage(HvMessage *m, void (*sendMessage)(HeavyContextInterface *, int, const HvMessage *)) override;
+  bool cancelMessage(HvMessage *m, void (*sendMessage)(HeavyContextInterface *, int, const HvMessage *)) final;
+
+  /** The queue of scheduled messages. Objects such as [delay] keep it and schedule into it directly. */
+  HvMessageQueue *getMessageQueue() { return &mq; }
 
   // table manipulation
   float *getBufferForTable(hv_uint32_t tableHash) override;
   int getLengthForTable(hv_uint32_t tableHash) override;
   bool setLengthForTable(hv_uint32_t tableHash, hv_uint32_t newSampleLength) override;
+  float *prepareTableUpdate(hv_uint32_t tableHash, hv_uint32_t newSampleLength) override;
+  bool publishTableUpdate(hv_uint32_t tableHash) override;
 
   // lock control
   void lockAcquire() override;
@@ -81,18 +139,97 @@ class HeavyContext : public HeavyContextInterface {
   virtual void scheduleMessageForReceiver(hv_uint32_t receiverHash, HvMessage *m) = 0;
   friend void _hv_scheduleMessageForReceiver(HeavyContextInterface *, hv_uint32_t, HvMessage *);
 
-  HvMessage *scheduleMessageForObject(const HvMessage *,
-      void (*sendMessage)(HeavyContextInterface *, int, const HvMessage *),
-      int);
-  friend HvMessage *_hv_scheduleMessageForObject(HeavyContextInterface *, const HvMessage *,
-      void (*sendMessage)(HeavyContextInterface *, int, const HvMessage *),
-      int);
-
   friend void defaultSendHook(HeavyContextInterface *, const char *, hv_uint32_t, const HvMessage *);
 
+  /**
+   * Called at the start of process(), after the input queue has been drained.
+   * Returns true if the context is asleep and no message is due in this block, in
+   * which case the outputs have been zero-filled and the block timestamp advanced.
+   */
+  bool processAsleep(float **outputBuffers, int numChannels, int n4);
+
+  /**
+   * Called at the end of process(). Tracks output silence and decides whether to sleep. A
+   * context only sleeps once its voices are idle too, a held note never puts it to sleep.
+   */
+  void updateSilence(float **outputBuffers, int numChannels, int n4, bool voicesIdle);
+
+  /**
+   * Called at the start of process(), after processAsleep(). Returns the time at which the
+   * block starts in nanoseconds, or zero if no cpu budget is set.
+   */
+  hv_uint64_t beginLoadMeasure() {
+#if HV_LOAD_SHEDDING
+    if (cpuBudget > 0.0f && numLoadTiers > 0) return getLoadClockNs();
+    if (loadTier != 0) setLoadTier(0);
+    cpuLoad = 0.0f;
+#endif
+    return 0;
+  }
+
+  /** Called at the end of process(). Updates the load with the time taken by the block and steps the tier. */
+  void endLoadMeasure(hv_uint64_t startNs, int n4) {
+#if HV_LOAD_SHEDDING
+    if (startNs != 0 && n4 > 0) updateLoad(startNs, n4);
+#endif
+  }
+
+#if HV_LOAD_SHEDDING
+  static hv_uint64_t getLoadClockNs();
+  void updateLoad(hv_uint64_t startNs, int n4);
+#endif
+
+  /** Applies a load tier between zero and numLoadTiers. Called from process() only. */
+  virtual void applyLoadTier(int tier) {}
+
+  /**
+   * Sets and applies the load tier, and reports it to the send hook as [tier load( to
+   * HV_LOAD_TIER_SEND_NAME.
+   */
+  void setLoadTier(int tier);
+
+  /**
+   * Starts a worker pool of numThreads threads, replacing any previous one.
+   * Zero threads stops the pool. Returns true if a pool is running.
+   */
+  bool setRenderPool(int numThreads, int minBlockSize);
+
+  /**
+   * Returns the timestamp of a message due the given number of samples after the start of the
+   * current block. Offsets past HV_MAX_TIMESTAMP_OFFSET are clamped to it, as the queue could not
+   * order them.
+   */
+  hv_uint32_t timestampForOffset(hv_uint64_t offset) const {
+    return (hv_uint32_t) blockStartTimestamp + (hv_uint32_t) ((offset < HV_MAX_TIMESTAMP_OFFSET) ? offset : HV_MAX_TIMESTAMP_OFFSET);
+  }
+
+  /** Returns the timestamp of a message sent with the given delay from the start of the current block. */
+  hv_uint32_t timestampForDelay(double delayMs) const {
+    const double offset = hv_min_d(hv_max_d(0.0, delayMs)*(sampleRate/1000.0), (double) HV_MAX_TIMESTAMP_OFFSET);
+    return (hv_uint32_t) blockStartTimestamp + (hv_uint32_t) offset;
+  }
+
+  /** Returns the timestamp of a message sent at the given sample, which is no earlier than the current block. */
+  hv_uint32_t timestampForSample(hv_uint64_t sample) const {
+    const hv_uint64_t now = blockStartTimestamp;
+    return timestampForOffset((sample > now) ? sample-now : 0);
+  }
+
+  /** Copies a message into the input queue with the given timestamp. */
+  bool enqueueMessage(hv_uint32_t receiverHash, hv_uint32_t timestamp, const HvMessage *m);
+
+  /** Builds a formatted message directly in the input queue with the given timestamp. */
+  bool enqueueMessageV(hv_uint32_t receiverHash, hv_uint32_t timestamp, const char *format, va_list ap);
+
+  /** Writes a message of floats directly into the input queue. The caller must hold inQueueLock. */
+  bool writeFloats(hv_uint32_t receiverHash, hv_uint32_t timestamp, const float *f, int numFloats);
+
+  /** Takes the input queue lock and writes a message of floats. */
+  bool enqueueFloats(hv_uint32_t receiverHash, hv_uint32_t sampleOffset, const float *f, int numFloats);
+
   // object state
   double sampleRate;
-  hv_uint32_t blockStartTimestamp;
+  hv_uint64_t blockStartTimestamp; // message timestamps are its low 32 bits
   hv_size_t numBytes;
   HvMessageQueue mq;
   HvSendHook_t *sendHook;
@@ -102,6 +239,18 @@ class HeavyContext : public HeavyContextInterface {
   HvLightPipe outQueue;
   hv_atomic_bool inQueueLock;
   hv_atomic_bool outQueueLock;
+  hv_uint32_t numSilentBlocks;
+  hv_uint32_t silentBlocksBeforeSleep;
+  bool isAsleep;
+  float cpuBudget;
+  float cpuLoad;
+  int loadTier;
+  int numLoadTiers; // set by patches that implement applyLoadTier()
+  hv_uint32_t numBlocksOverBudget;
+  hv_uint32_t numBlocksUnderBudget;
+  hv_uint32_t numBlocksSinceRaise;
+  HvWorkerPool *renderPool;
+  int renderMinBlockSize;
 };
 
 #endif // _HEAVY_CONTEXT_H_
@@ -41,6 +41,13 @@ typedef struct HvParameterInfo {
   float defaultVal;     // the default value of this parameter
 } HvParameterInfo;
 
+typedef struct HvFloatEvent {
+  hv_uint32_t receiverHash; // the hash of the receiver, as from hv_stringToHash()
+  hv_uint32_t sampleOffset; // the number of samples after the start of the next processed block
+  hv_uint32_t numFloats;    // the number of values, from 1 to 3
+  float f[3];               // the message values
+} HvFloatEvent;
+
 typedef void (HvSendHook_t) (HeavyContextInterface *context, const char *sendName, hv_uint32_t sendHash, const HvMessage *msg);
 typedef void (HvPrintHook_t) (HeavyContextInterface *context, const char *printName, const char *str, const HvMessage *msg);
 
@@ -72,8 +79,14 @@ class HeavyContextInterface {
   /** Returns the sample rate with which this context has been configured. */
   virtual double getSampleRate() = 0;
 
-  /** Returns the current patch time in samples. This value is always exact. */
+  /**
+   * Returns the current patch time in samples. This value is always exact, but it wraps
+   * after 2^32 samples (about 24.8 hours at 48kHz). See getCurrentSample64().
+   */
   virtual hv_uint32_t getCurrentSample() = 0;
+
+  /** Returns the current patch time in samples on the 64-bit timeline, which does not wrap. */
+  virtual hv_uint64_t getCurrentSample64() = 0;
   virtual float samplesToMilliseconds(hv_uint32_t numSamples) = 0;
 
   /** Converts milliseconds to samples. Input is limited to non-negative range. */
@@ -140,6 +153,64 @@ class HeavyContextInterface {
    */
   virtual int processInlineInterleaved(float *inputBuffers, float *outputBuffer, int n) = 0;
 
+  /**
+   * Returns true if the most recently processed block was skipped because the context is asleep.
+   * The output buffers of that block have been zero-filled and need not be mixed downstream.
+   */
+  virtual bool isOutputSilent() = 0;
+
+  /**
+   * Sets the number of consecutive blocks whose output must stay below -120 dBFS before the
+   * context goes to sleep. While asleep, process() zero-fills the outputs and skips the signal
+   * graph until a message is due in the current block. Zero disables sleeping.
+   */
+  virtual void setSilentBlocksBeforeSleep(int numBlocks) = 0;
+
+  /**
+   * Sets the share of the real-time duration of a block that processing it may take, e.g. 0.7.
+   * While the measured load stays above the budget, the patch degrades its quality one tier at a
+   * time, and restores it one tier at a time once the load stays well below the budget.
+   * Zero disables load shedding and restores full quality.
+   */
+  virtual void setCpuBudget(float fraction) = 0;
+
+  /** Returns the smoothed processing time of recent blocks as a share of their real-time duration. */
+  virtual float getCpuLoad() = 0;
+
+  /** Returns the current load tier. Zero is full quality, higher tiers are cheaper to render. */
+  virtual int getLoadTier() = 0;
+
+  /**
+   * Renders independent voices of blocks of at least minBlockSize frames on numThreads worker threads,
+   * in addition to the calling thread. Messages are still dispatched in timestamp order. Smaller blocks
+   * are rendered on the calling thread only. Zero threads disables parallel rendering.
+   * The output matches rendering on the calling thread to within rounding, not bit for bit, see
+   * hv_setRenderThreads().
+   * Returns false if the patch does not support parallel rendering.
+   *
+   * Worker synchronisation may block, so this is intended for offline rendering.
+   * This function is NOT thread-safe. It must not be called while processing.
+   */
+  virtual bool setRenderThreads(int numThreads, int minBlockSize) = 0;
+
+  /**
+   * Removes first-use costs from the next blocks: reserves the message queue to the capacity of
+   * its pool, maps all memory of the context and runs the message and signal paths of the patch
+   * on a scratch instance, such that the state of this context is unchanged.
+   *
+   * This allocates and may take a few milliseconds, so it is intended for plugin activation.
+   * This function is NOT thread-safe. It must not be called while processing.
+   */
+  virtual void warmUp() = 0;
+
+  /**
+   * Drops all pending messages, both those sent from other threads and those scheduled by the patch.
+   * The messages that the patch scheduled for itself before the first block, such as its loadbangs, are kept.
+   *
+   * This function is NOT thread-safe. It must not be called while processing.
+   */
+  virtual void clearMessages() = 0;
+
   /**
    * Sends a formatted message to a receiver that can be scheduled for the future.
    * The receiver is addressed with its hash, which can also be determined using hv_stringToHash().
@@ -160,6 +231,51 @@ class HeavyContextInterface {
    */
   virtual bool sendMessageToReceiverV(hv_uint32_t receiverHash, double delayMs, const char *fmt, ...) = 0;
 
+  /**
+   * Sends a message to a receiver, to be processed at the given sample of the 64-bit timeline
+   * (see getCurrentSample64()). A sample that has already passed is processed at the start of the
+   * next block. A sample 2^31 or more samples ahead of the current time is processed 2^31-1
+   * samples ahead instead, as the queue could not order it.
+   * No unit conversion is involved, so this is the cheapest way to schedule sample-accurate events.
+   * This function is thread-safe.
+   *
+   * @return  True if the message was accepted. False if the message could not fit onto
+   *          the message queue to be processed this block.
+   */
+  virtual bool sendMessageAtSample(hv_uint32_t receiverHash, hv_uint64_t sample, HvMessage *m) = 0;
+
+  /**
+   * As sendMessageAtSample(), with a formatted message as in sendMessageToReceiverV().
+   * This function is thread-safe.
+   *
+   * @return  True if the message was accepted. False if the message could not fit onto
+   *          the message queue to be processed this block.
+   */
+  virtual bool sendMessageAtSampleV(hv_uint32_t receiverHash, hv_uint64_t sample, const char *fmt, ...) = 0;
+
+  /**
+   * Sends a message of one, two or three floats to a receiver, to be processed sampleOffset samples
+   * after the start of the next processed block. These are the fast path for fixed-shape events such
+   * as MIDI, which are written directly into the input queue without interpreting a format string.
+   * Offsets past 2^31-1 are clamped to it.
+   * This function is thread-safe.
+   *
+   * @return  True if the message was accepted. False if the message could not fit onto
+   *          the message queue to be processed this block.
+   */
+  virtual bool sendFloats1(hv_uint32_t receiverHash, hv_uint32_t sampleOffset, float a) = 0;
+  virtual bool sendFloats2(hv_uint32_t receiverHash, hv_uint32_t sampleOffset, float a, float b) = 0;
+  virtual bool sendFloats3(hv_uint32_t receiverHash, hv_uint32_t sampleOffset, float a, float b, float c) = 0;
+
+  /**
+   * Sends a batch of float events, taking the input queue lock only once.
+   * This function is thread-safe.
+   *
+   * @return  The number of events accepted, in order. Fewer than numEvents if the
+   *          message queue filled up.
+   */
+  virtual int sendFloatEvents(const HvFloatEvent *events, int numEvents) = 0;
+
   /**
    * A convenience function to send a float to a receiver to be processed immediately.
    * The receiver is addressed with its hash, which can also be determined using hv_stringToHash().
@@ -208,7 +324,13 @@ class HeavyContextInterface {
    */
   virtual int getParameterInfo(int index, HvParameterInfo *info) = 0;
 
-  /** Returns a pointer to the raw buffer backing this table. DO NOT free it. */
+  /**
+   * Returns a pointer to the raw buffer backing this table. DO NOT free it.
+   * The audio thread may replace the buffer at the start of each block, so other threads
+   * must use prepareTableUpdate() and publishTableUpdate() to change a table while processing.
+   * The pointer is invalid once a buffer published by publishTableUpdate() or setLengthForTable()
+   * has been swapped in, i.e. after the next block, and must then be fetched again.
+   */
   virtual float *getBufferForTable(hv_uint32_t tableHash) = 0;
 
   /** Returns the length of this table in samples. */
@@ -217,8 +339,9 @@ class HeavyContextInterface {
   /**
    * Resizes the table to the given length.
    *
-   * Existing contents are copied to the new table. Remaining space is cleared
-   * if the table is longer than the original, truncated otherwise.
+   * Existing contents are copied to the new table, including those written by the patch until
+   * the audio thread swaps it in. Remaining space is cleared if the table is longer than the
+   * original, truncated otherwise. The new table is published as by publishTableUpdate().
    *
    * @param tableHash  The table identifier.
    * @param newSampleLength  The new length of the table, in samples.
@@ -227,6 +350,33 @@ class HeavyContextInterface {
    */
   virtual bool setLengthForTable(hv_uint32_t tableHash, hv_uint32_t newSampleLength) = 0;
 
+  /**
+   * Returns a new buffer for the table, to be filled and then published with
+   * publishTableUpdate(). It holds newSampleLength samples, starting with the
+   * contents that the table had when it was last published.
+   *
+   * Table updates are lock-free. They may be made from any one thread at a time
+   * while another thread processes, but never from the audio thread.
+   *
+   * @param tableHash  The table identifier.
+   * @param newSampleLength  The new length of the table, in samples.
+   *
+   * @return  The buffer, or NULL if the table could not be found.
+   */
+  virtual float *prepareTableUpdate(hv_uint32_t tableHash, hv_uint32_t newSampleLength) = 0;
+
+  /**
+   * Publishes the buffer returned by the last call to prepareTableUpdate().
+   *
+   * The audio thread swaps it in at the start of the next block without allocating,
+   * and the buffer that it replaces is freed by a later update from the writer thread.
+   *
+   * @param tableHash  The table identifier.
+   *
+   * @return  False if the table could not be found or no buffer was prepared. True otherwise.
+   */
+  virtual bool publishTableUpdate(hv_uint32_t tableHash) = 0;
+
   /**
    * Acquire the input message queue lock.
    *
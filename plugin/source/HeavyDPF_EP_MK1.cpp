@@ -32,6 +32,7 @@
 
 #include "Heavy_EP_MK1.h"
 #include "HeavyDPF_EP_MK1.hpp"
+#include "HvRtAudit.h"
 #include <set>
 
 
@@ -106,15 +107,21 @@ HeavyDPF_EP_MK1::HeavyDPF_EP_MK1()
 {
   
 
+  _numEvents = 0;
   _context = hv_EP_MK1_new_with_options(getSampleRate(), 10, 2, 2);
   _context->setUserData(this);
   _context->setSendHook(&hvSendHookFunc);
   _context->setPrintHook(&hvPrintHookFunc);
 
-  
+#if HV_SERVICE
+  hSv_init(&_service, getSampleRate(), DISTRHO_PLUGIN_NUM_OUTPUTS);
+#endif
 }
 
 HeavyDPF_EP_MK1::~HeavyDPF_EP_MK1() {
+#if HV_SERVICE
+  hSv_free(&_service);
+#endif
   hv_EP_MK1_free(_context);
 }
 
@@ -144,15 +151,19 @@ void HeavyDPF_EP_MK1::setParameterValue(uint32_t index, float value)
 // -------------------------------------------------------------------
 // Process
 
-// void HeavyDPF_EP_MK1::activate()
-// {
-
-// }
-
-// void HeavyDPF_EP_MK1::deactivate()
-// {
+void HeavyDPF_EP_MK1::activate()
+{
+  // the first note after loading would otherwise pay for page faults and cold caches
+  _context->warmUp();
+#if HV_SERVICE
+  hSv_activate(&_service, getSampleRate());
+#endif
+}
 
-// }
+void HeavyDPF_EP_MK1::deactivate()
+{
+  _context->clearMessages();
+}
 
 #if DISTRHO_PLUGIN_WANT_MIDI_INPUT
 // -------------------------------------------------------------------
@@ -160,6 +171,8 @@ void HeavyDPF_EP_MK1::setParameterValue(uint32_t index, float value)
 
 void HeavyDPF_EP_MK1::handleMidiInput(uint32_t frames, const MidiEvent* midiEvents, uint32_t midiEventCount)
 {
+  _numEvents = 0;
+
   // Realtime events
   const TimePosition& timePos(getTimePosition());
   bool reset = false;
@@ -168,8 +181,7 @@ void HeavyDPF_EP_MK1::handleMidiInput(uint32_t frames, const MidiEvent* midiEven
   {
     if (timePos.frame == 0)
     {
-      _context->sendMessageToReceiverV(HV_HASH_MIDIREALTIMEIN, 0,
-        "ff", (float) MIDI_RT_RESET);
+      addFloatEvent(HV_HASH_MIDIREALTIMEIN, 0, 2, (float) MIDI_RT_RESET, 0.0f);
       reset = true;
     }
 
@@ -177,20 +189,17 @@ void HeavyDPF_EP_MK1::handleMidiInput(uint32_t frames, const MidiEvent* midiEven
     {
       if (timePos.frame == 0)
       {
-        _context->sendMessageToReceiverV(HV_HASH_MIDIREALTIMEIN, 0,
-          "ff", (float) MIDI_RT_START);
+        addFloatEvent(HV_HASH_MIDIREALTIMEIN, 0, 2, (float) MIDI_RT_START, 0.0f);
       }
       if (! reset)
       {
-        _context->sendMessageToReceiverV(HV_HASH_MIDIREALTIMEIN, 0,
-          "ff", (float) MIDI_RT_CONTINUE);
+        addFloatEvent(HV_HASH_MIDIREALTIMEIN, 0, 2, (float) MIDI_RT_CONTINUE, 0.0f);
       }
     }
   }
   else if (this->wasPlaying)
   {
-    _context->sendMessageToReceiverV(HV_HASH_MIDIREALTIMEIN, 0,
-      "ff", (float) MIDI_RT_STOP);
+    addFloatEvent(HV_HASH_MIDIREALTIMEIN, 0, 2, (float) MIDI_RT_STOP, 0.0f);
   }
   this->wasPlaying = timePos.playing;
 
@@ -206,8 +215,8 @@ void HeavyDPF_EP_MK1::handleMidiInput(uint32_t frames, const MidiEvent* midiEven
     double sampleAtCycleEnd = sampleAtCycleStart + frames;
 
     while (nextClockTick < sampleAtCycleEnd) {
-      _context->sendMessageToReceiverV(HV_HASH_MIDIREALTIMEIN, 1000*(nextClockTick - sampleAtCycleStart)/getSampleRate(),
-        "ff", (float) MIDI_RT_CLOCK);
+      addFloatEvent(HV_HASH_MIDIREALTIMEIN, (uint32_t) (nextClockTick - sampleAtCycleStart), 2,
+        (float) MIDI_RT_CLOCK, 0.0f);
       nextClockTick += samplesPerTick;
     }
 
@@ -219,58 +228,56 @@ void HeavyDPF_EP_MK1::handleMidiInput(uint32_t frames, const MidiEvent* midiEven
   // Midi events
   for (uint32_t i=0; i < midiEventCount; ++i)
   {
+    const uint32_t frame = midiEvents[i].frame;
     int status = midiEvents[i].data[0];
     int command = status & 0xF0;
     int channel = status & 0x0F;
     int data1   = midiEvents[i].data[1];
     int data2   = midiEvents[i].data[2];
 
-    // raw [midiin] messages
-    int dataSize = *(&midiEvents[i].data + 1) - midiEvents[i].data;
-
-    for (int i = 0; i < dataSize; ++i) {
-      _context->sendMessageToReceiverV(HV_HASH_MIDIIN, 1000.0*timePos.frame/getSampleRate(), "ff",
-        (float) midiEvents[i].data[i],
+    // raw [midiin] messages, always all 4 bytes of the event, zero-padded past its size
+    for (uint32_t j = 0; j < MidiEvent::kDataSize; ++j) {
+      addFloatEvent(HV_HASH_MIDIIN, frame, 2,
+        (j < midiEvents[i].size) ? (float) midiEvents[i].data[j] : 0.0f,
         (float) channel);
     }
 
     if(mrtSet.find(status) != mrtSet.end())
     {
-      _context->sendMessageToReceiverV(HV_HASH_MIDIREALTIMEIN, 1000.0*timePos.frame/getSampleRate(),
-        "ff", (float) status);
+      addFloatEvent(HV_HASH_MIDIREALTIMEIN, frame, 2, (float) status, 0.0f);
     }
 
     // typical midi messages
     switch (command) {
       case 0x80: {  // note off
-        _context->sendMessageToReceiverV(HV_HASH_NOTEIN, 1000.0*timePos.frame/getSampleRate(), "fff",
+        addFloatEvent(HV_HASH_NOTEIN, frame, 3,
           (float) data1, // pitch
           (float) 0, // velocity
           (float) channel);
         break;
       }
       case 0x90: { // note on
-        _context->sendMessageToReceiverV(HV_HASH_NOTEIN, 1000.0*timePos.frame/getSampleRate(), "fff",
+        addFloatEvent(HV_HASH_NOTEIN, frame, 3,
           (float) data1, // pitch
           (float) data2, // velocity
           (float) channel);
         break;
       }
       case 0xB0: { // control change
-        _context->sendMessageToReceiverV(HV_HASH_CTLIN, 1000.0*timePos.frame/getSampleRate(), "fff",
+        addFloatEvent(HV_HASH_CTLIN, frame, 3,
           (float) data2, // value
           (float) data1, // cc number
           (float) channel);
         break;
       }
       case 0xC0: { // program change
-        _context->sendMessageToReceiverV(HV_HASH_PGMIN, 1000.0*timePos.frame/getSampleRate(), "ff",
+        addFloatEvent(HV_HASH_PGMIN, frame, 2,
           (float) data1,
           (float) channel);
         break;
       }
       case 0xD0: { // aftertouch
-        _context->sendMessageToReceiverV(HV_HASH_TOUCHIN, 1000.0*timePos.frame/getSampleRate(), "ff",
+        addFloatEvent(HV_HASH_TOUCHIN, frame, 2,
           (float) data1,
           (float) channel);
         break;
@@ -278,7 +285,7 @@ void HeavyDPF_EP_MK1::handleMidiInput(uint32_t frames, const MidiEvent* midiEven
       case 0xE0: { // pitch bend
         // combine 7bit lsb and msb into 32bit int
         hv_uint32_t value = (((hv_uint32_t) data2) << 7) | ((hv_uint32_t) data1);
-        _context->sendMessageToReceiverV(HV_HASH_BENDIN, 1000.0*timePos.frame/getSampleRate(), "ff",
+        addFloatEvent(HV_HASH_BENDIN, frame, 2,
           (float) value,
           (float) channel);
         break;
@@ -286,6 +293,27 @@ void HeavyDPF_EP_MK1::handleMidiInput(uint32_t frames, const MidiEvent* midiEven
       default: break;
     }
   }
+
+  flushFloatEvents();
+}
+
+void HeavyDPF_EP_MK1::addFloatEvent(uint32_t receiverHash, uint32_t frame, uint32_t numFloats, float a, float b, float c)
+{
+  if (_numEvents == (int) (sizeof(_events)/sizeof(_events[0]))) flushFloatEvents();
+  HvFloatEvent *const e = _events + _numEvents++;
+  e->receiverHash = receiverHash;
+  e->sampleOffset = frame;
+  e->numFloats = numFloats;
+  e->f[0] = a;
+  e->f[1] = b;
+  e->f[2] = c;
+}
+
+// sends the events of the block with a single pass through the input queue lock
+void HeavyDPF_EP_MK1::flushFloatEvents()
+{
+  if (_numEvents > 0) _context->sendFloatEvents(_events, _numEvents);
+  _numEvents = 0;
 }
 #endif
 
@@ -416,12 +444,28 @@ void HeavyDPF_EP_MK1::handleMidiSend(uint32_t sendHash, const HvMessage *m)
 #if DISTRHO_PLUGIN_WANT_MIDI_INPUT
 void HeavyDPF_EP_MK1::run(const float** inputs, float** outputs, uint32_t frames, const MidiEvent* midiEvents, uint32_t midiEventCount)
 {
+#if HV_SERVICE
+  const uint64_t serviceStart = hSv_enter(&_service);
+#endif
+  HV_RT_AUDIT_ENTER();
   handleMidiInput(frames, midiEvents, midiEventCount);
 #else
 void HeavyDPF_EP_MK1::run(const float** inputs, float** outputs, uint32_t frames)
 {
+#if HV_SERVICE
+  const uint64_t serviceStart = hSv_enter(&_service);
+#endif
+  HV_RT_AUDIT_ENTER();
 #endif
   _context->process((float**)inputs, outputs, frames);
+#if HV_SERVICE
+  // the output of a sleeping context is below the silence threshold, it is captured as zeros
+  hSv_capture(&_service, _context->isOutputSilent() ? nullptr : outputs, frames);
+#endif
+  HV_RT_AUDIT_LEAVE();
+#if HV_SERVICE
+  hSv_leave(&_service, serviceStart, frames);
+#endif
 }
 
 // -------------------------------------------------------------------
@@ -431,6 +475,7 @@ void HeavyDPF_EP_MK1::sampleRateChanged(double newSampleRate)
 {
   hv_EP_MK1_free(_context);
 
+  _numEvents = 0;
   _context = hv_EP_MK1_new_with_options(getSampleRate(), 10, 2, 2);
   _context->setUserData(this);
   _context->setSendHook(&hvSendHookFunc);
@@ -36,6 +36,7 @@
 #include "DistrhoPlugin.hpp"
 #include "DistrhoPluginInfo.h"
 #include "Heavy_EP_MK1.hpp"
+#include "HvService.h"
 
 START_NAMESPACE_DISTRHO
 
@@ -114,8 +115,8 @@ protected:
   // -------------------------------------------------------------------
   // Process
 
-  // void activate() override;
-  // void deactivate() override;
+  void activate() override;
+  void deactivate() override;
 
 #if DISTRHO_PLUGIN_WANT_MIDI_INPUT
   void run(const float** inputs, float** outputs, uint32_t frames, const MidiEvent* midiEvents, uint32_t midiEventCount) override;
@@ -139,9 +140,20 @@ private:
   double nextClockTick;
   double sampleAtCycleStart;
 
+  // the events of a block, sent to the context all at once by flushFloatEvents()
+  void addFloatEvent(uint32_t receiverHash, uint32_t frame, uint32_t numFloats, float a, float b, float c = 0.0f);
+  void flushFloatEvents();
+  HvFloatEvent _events[512];
+  int _numEvents;
+
   // heavy context
   HeavyContextInterface *_context;
 
+#if HV_SERVICE
+  // realtime setup and callback timing of the headless standalone
+  HvService _service;
+#endif
+
   // HeavyDPF_EP_MK1<float> fEP_MK1;
 
   DISTRHO_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR(HeavyDPF_EP_MK1)
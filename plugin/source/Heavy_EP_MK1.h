@@ -70,6 +70,39 @@ HeavyContextInterface *hv_EP_MK1_new_with_options(double sampleRate, int poolKb,
  */
 void hv_EP_MK1_free(HeavyContextInterface *instance);
 
+/**
+ * Renders the first ms milliseconds of every note from firstKey to firstKey+numKeys-1,
+ * at each of the numLayers velocities in ascending order, into an attack cache file.
+ * Returns false if the file could not be written.
+ */
+bool hv_EP_MK1_renderAttackCache(const char *path, double sampleRate, int firstKey, int numKeys,
+    const float *velocities, int numLayers, float ms);
+
+/**
+ * Maps an attack cache file shared by all instances, or unmaps it if path is NULL.
+ * While a cache is mapped, note-ons of a cached key and velocity play its attack if the voice
+ * matches it. Other notes are rendered live.
+ * Returns false if the file is missing or was rendered for another build or sample rate.
+ */
+bool hv_EP_MK1_setAttackCache(HeavyContextInterface *instance, const char *path);
+
+/**
+ * Writes the per-section cycle profile of an HV_PROFILE build into the buffer and returns
+ * its length as snprintf() does. Writes an empty string without HV_PROFILE.
+ */
+hv_size_t hv_EP_MK1_getProfile(HeavyContextInterface *instance, char *buffer, hv_size_t size);
+
+/**
+ * Clears the profile of an HV_PROFILE build.
+ */
+void hv_EP_MK1_resetProfile(HeavyContextInterface *instance);
+
+/**
+ * Writes the message graph trace of an HV_TRACE build, recorded since the last call, to a
+ * Chrome trace JSON file. Returns false without HV_TRACE or if the file could not be written.
+ */
+bool hv_EP_MK1_writeTrace(HeavyContextInterface *instance, const char *path);
+
 
 #ifdef __cplusplus
 } // extern "C"
@@ -54,8 +54,61 @@
 #include "HvMath.h"
 #include "HvSignalRPole.h"
 #include "HvSignalBiquad.h"
+#include "HvControlNoteCache.h"
+#include "HvControlPoly.h"
+#include "HvAttackCache.h"
+#include "HvProfile.h"
+#include "HvTrace.h"
 
-class Heavy_EP_MK1 : public HeavyContext {
+// number of voices, each with its own control graph and signal chain
+#ifndef HV_EP_MK1_NUM_VOICES
+#define HV_EP_MK1_NUM_VOICES 8
+#endif
+
+// load tiers, each one includes the savings of the lower ones:
+// 1. the coefficients of both voice filters are computed once per HV_EP_MK1_FILTER_CONTROL_PERIOD samples
+// 2. the oscillators use a third instead of a fifth order sine approximation
+// 3. at most HV_EP_MK1_CAPPED_VOICES voices are rendered, the quietest others are released, faded
+//    out over HV_EP_MK1_VOICE_FADE_FRAMES frames and parked until their next note-on
+#define HV_EP_MK1_LOAD_TIER_CONTROL_RATE_FILTERS 1
+#define HV_EP_MK1_LOAD_TIER_CHEAP_OSCILLATORS 2
+#define HV_EP_MK1_LOAD_TIER_VOICE_CAP 3
+#define HV_EP_MK1_FILTER_CONTROL_PERIOD 64
+#ifndef HV_EP_MK1_CAPPED_VOICES
+#define HV_EP_MK1_CAPPED_VOICES (HV_EP_MK1_NUM_VOICES/2)
+#endif
+
+// number of blocks during which a voice that received a note-on is not shed again
+#define HV_EP_MK1_VOICE_PARK_GRACE_BLOCKS 16
+#define HV_EP_MK1_VOICE_FADE_FRAMES 256
+
+// cached attacks are rendered with a voice state checkpoint every HV_EP_MK1_ATTACK_CHECKPOINT_FRAMES
+// frames, and are only played if a live voice agrees with the cache up to HV_EP_MK1_ATTACK_TOLERANCE
+#define HV_EP_MK1_ATTACK_CHECKPOINT_FRAMES 256
+#define HV_EP_MK1_ATTACK_TOLERANCE 1.0e-5f
+
+// warmUp() plays a note on every voice of a scratch instance for HV_EP_MK1_WARM_UP_MS milliseconds,
+// and releases them halfway through
+#define HV_EP_MK1_WARM_UP_MS 50.0f
+
+// sections of the flat profile of an HV_PROFILE build, see getProfile().
+// The voice sections are those of Voice::process(), HV_EP_MK1_PROFILE_VOICES is the remaining
+// cost of rendering and mixing the voices, e.g. playing cached attacks.
+#define HV_EP_MK1_PROFILE_MESSAGES 0
+#define HV_EP_MK1_PROFILE_OSCILLATORS 1
+#define HV_EP_MK1_PROFILE_ENVELOPES 2
+#define HV_EP_MK1_PROFILE_FILTERS 3
+#define HV_EP_MK1_PROFILE_SHAPER 4
+#define HV_EP_MK1_PROFILE_VOICES 5
+#define HV_EP_MK1_PROFILE_MASTER 6
+#define HV_EP_MK1_PROFILE_OTHER 7
+#define HV_EP_MK1_PROFILE_NUM_SECTIONS 8
+
+// notes are allocated to voices by ControlPoly and sent straight to the chosen voice, whose note
+// graph runs as direct calls, see onNote(); define HV_EP_MK1_GENERIC_NOTEIN to run both through
+// the generated graph instead
+
+class Heavy_EP_MK1 final : public HeavyContext {
 
  public:
   Heavy_EP_MK1(double sampleRate, int poolKb=10, int inQueueKb=2, int outQueueKb=0);
@@ -71,10 +124,199 @@ class Heavy_EP_MK1 : public HeavyContext {
 
   int getParameterInfo(int index, HvParameterInfo *info) override;
 
+  bool setRenderThreads(int numThreads, int minBlockSize) override;
+
+  void warmUp() override;
+  void clearMessages() override;
+
+  /**
+   * Renders the first ms milliseconds of every note from firstKey to firstKey+numKeys-1,
+   * at each of the numLayers velocities in ascending order, into a cache file at path.
+   * Each attack is rendered by a fresh instance at the given sample rate.
+   */
+  static bool renderAttackCache(const char *path, double sampleRate, int firstKey, int numKeys,
+      const float *velocities, int numLayers, float ms);
+
+  /**
+   * Maps a cache file made by renderAttackCache(), or unmaps the current one if path is NULL.
+   * While mapped, note-on velocities snap to the nearest layer and cached attacks replace the
+   * voice signal chain. Returns false if the file is missing or does not match this build and
+   * sample rate. Must not be called concurrently with process().
+   */
+  bool setAttackCache(const char *path);
+
+  /**
+   * Writes the flat profile of an HV_PROFILE build since the last resetProfile() into the buffer,
+   * and returns its length as snprintf() does. Writes an empty string without HV_PROFILE.
+   * The profile is also printed to stderr when the instance is deleted.
+   */
+  hv_size_t getProfile(char *buffer, hv_size_t size) const;
+
+  /** Clears the profile. Must not be called concurrently with process(). */
+  void resetProfile();
+
+  /**
+   * Writes the message trace of an HV_TRACE build recorded since the last call to a Chrome trace
+   * JSON file, see HvTrace.h. May be called from any one thread while processing.
+   * Returns false without HV_TRACE or if the file could not be written.
+   */
+  bool writeTrace(const char *path);
+
  private:
   HvTable *getTableForHash(hv_uint32_t tableHash) override;
   void scheduleMessageForReceiver(hv_uint32_t receiverHash, HvMessage *m) override;
 
+  // The signal state of a voice, as saved in the checkpoints of an attack cache.
+  // The signal vars come last, see Voice::hasParameters().
+  struct VoiceSignalState {
+    SignalRPole sRPole_xQE1l5IP;
+    SignalPhasor sPhasor_1g348lth;
+    SignalRPole sRPole_LJ2U55sy;
+    SignalLine sLine_p3apF6qw;
+    SignalLine sLine_Fe0sHHrh;
+    SignalBiquad sBiquad_s_YKOSCulY;
+    SignalBiquad sBiquad_s_WwgL7LgK;
+    SignalVarf sVarf_12WWjECf;
+    SignalVarf sVarf_JStffWNs;
+    SignalVarf sVarf_MhpLVcYQ;
+    SignalVarf sVarf_dWTru9Kp;
+    SignalVarf sVarf_0vvlNiX4;
+    SignalVarf sVarf_yz2BQm5L;
+    SignalVarf sVarf_pkqNsRE6;
+    SignalVarf sVarf_5c1hNZPU;
+    SignalVarf sVarf_mmQmNb4h;
+    SignalVarf sVarf_U88OzJYl;
+    SignalVarf sVarf_E7C2HtOj;
+  };
+
+  // The state of one voice. The message functions of a voice take its index as template argument.
+  struct Voice {
+    void process(hv_bOutf_t bOut);
+    void render(hv_bOutf_t bOut); // process() or play the cached attack
+    void fadeOut(hv_bOutf_t bOut); // applies the fade of a shed voice, see capVoices()
+
+    // attack cache playback, see playAttack()
+    void startAttack(const HvAttackCacheHeader *h, const HvAttackCacheEntry *e);
+    void stopAttack();
+    void playAttack(hv_bOutf_t bOut);
+    void saveState(VoiceSignalState *s) const;
+    void restoreState(const VoiceSignalState *s);
+    bool hasParameters(const VoiceSignalState *s) const;
+
+    SignalRPole sRPole_xQE1l5IP;
+    SignalPhasor sPhasor_1g348lth;
+    SignalRPole sRPole_LJ2U55sy;
+    SignalLine sLine_p3apF6qw;
+    SignalLine sLine_Fe0sHHrh;
+    SignalBiquad sBiquad_s_YKOSCulY;
+    SignalBiquad sBiquad_s_WwgL7LgK;
+    ControlSlice cSlice_DhA4et2d;
+    ControlSlice cSlice_bjkjROgL;
+    ControlSlice cSlice_X59Ms47y;
+    ControlBinop cBinop_qZhFVp8b;
+    ControlBinop cBinop_puulPVJ8;
+    ControlBinop cBinop_DrdAUms9;
+    ControlBinop cBinop_5BolRjUc;
+    ControlDelay cDelay_XJtqLdR3;
+    ControlPack cPack_Tc48KAjO;
+    ControlSlice cSlice_mxHzGYpx;
+    ControlSlice cSlice_S1VOGbss;
+    ControlVar cVar_sZ2r4PVf;
+    ControlBinop cBinop_3RBhQUO2;
+    ControlBinop cBinop_k3xOFn9Y;
+    SignalVarf sVarf_12WWjECf;
+    ControlBinop cBinop_si1yqlyW;
+    ControlBinop cBinop_RceFSyRR;
+    ControlBinop cBinop_ByBj1s2m;
+    SignalVarf sVarf_JStffWNs;
+    ControlDelay cDelay_LdXQexFY;
+    ControlPack cPack_mCFcgioO;
+    ControlSlice cSlice_Km00ydT2;
+    ControlSlice cSlice_1Q9bVNNN;
+    ControlVar cVar_NTVGi1rx;
+    ControlBinop cBinop_D5D0LaYe;
+    ControlBinop cBinop_HA94hCLv;
+    SignalVarf sVarf_MhpLVcYQ;
+    ControlBinop cBinop_mTfoFJLO;
+    ControlBinop cBinop_A2KsUGjR;
+    ControlBinop cBinop_G6AE2PwA;
+    SignalVarf sVarf_dWTru9Kp;
+    ControlSlice cSlice_8PkrkbiL;
+    ControlSlice cSlice_AxhMJRiu;
+    ControlBinop cBinop_Ti73JY9X;
+    ControlBinop cBinop_aYuF0nQk;
+    ControlBinop cBinop_GBGRcaro;
+    ControlBinop cBinop_AUvUrY4R;
+    SignalVarf sVarf_0vvlNiX4;
+    SignalVarf sVarf_yz2BQm5L;
+    ControlDelay cDelay_yN9o31WM;
+    SignalVarf sVarf_pkqNsRE6;
+    ControlDelay cDelay_qZFKZiPY;
+    ControlDelay cDelay_u4RfWjOf;
+    ControlDelay cDelay_HvShZWxN;
+    ControlDelay cDelay_62QExDOA;
+    ControlDelay cDelay_twfJBpos;
+    ControlIf cIf_uB5Z1HTu;
+    ControlBinop cBinop_gRen83wr;
+    ControlBinop cBinop_7dajl5bE;
+    ControlBinop cBinop_maqKW0Ak;
+    ControlBinop cBinop_1pfH37j6;
+    ControlBinop cBinop_VtqrJbdm;
+    ControlPack cPack_H3oA1KXj;
+    ControlBinop cBinop_JuKEhSjI;
+    ControlBinop cBinop_F8TudeNI;
+    ControlBinop cBinop_j7sSgKsi;
+    ControlBinop cBinop_H0pkypkT;
+    ControlBinop cBinop_3tTN8vR3;
+    ControlBinop cBinop_dIYEAlww;
+    SignalVarf sVarf_5c1hNZPU;
+    ControlBinop cBinop_c85ioJXE;
+    ControlBinop cBinop_lklbN5Wj;
+    ControlBinop cBinop_7dgfWIsc;
+    ControlBinop cBinop_IpPxuID9;
+    ControlBinop cBinop_XKbyFfP1;
+    SignalVarf sVarf_mmQmNb4h;
+    SignalVarf sVarf_U88OzJYl;
+    SignalVarf sVarf_E7C2HtOj;
+
+    // load shedding state, see applyLoadTier()
+    hv_bufferf_t filterCoeffs[10]; // held coefficients of both filters
+    int loadTier;
+    int filterPhase; // vectors since the held filter coefficients were computed
+    bool parked; // not rendered after being shed by the voice cap, until the next note-on
+    int fadeFrames; // frames until a shed voice is parked, during which it fades out
+    int graceBlocks; // blocks until a retriggered voice may be shed again
+    float peak; // largest output level in the current block
+
+    // attack cache state
+    const HvAttackCacheHeader *attackHeader;
+    const HvAttackCacheEntry *attackEntry; // NULL while the voice renders live
+    hv_uint32_t attackFrame; // frames into the attack
+    float attackError; // largest difference between the live voice and the cache so far
+
+#if HV_PROFILE
+    hv_uint64_t profileTicks[HV_EP_MK1_PROFILE_NUM_SECTIONS]; // of the sections in process()
+#endif
+  };
+
+  // signal chains
+  void processMaster(hv_bInf_t bIn, hv_bOutf_t bOut);
+
+  // load shedding
+  void applyLoadTier(int tier) override;
+  void capVoices();
+
+  // attack cache
+  void onVoiceNote(Voice &v, const HvMessage *m);
+  void renderAttack(const HvAttackCacheHeader *h, int key, float velocity, HvAttackCacheEntry *e);
+  static bool renderAttackEntry(void *x, int key, int layer, HvAttackCacheEntry *e);
+  static hv_uint32_t getAttackCacheHash();
+
+  // parallel rendering
+  void processParallel(float **outputBuffers, int n4);
+  void processVoiceBlock(int i);
+  static void processVoiceJob(void *x, int i);
+
   // static sendMessage functions
   static void cSlice_elndZqvG_sendMessage(HeavyContextInterface *, int, const HvMessage *);
   static void cSlice_8lQZHtLi_sendMessage(HeavyContextInterface *, int, const HvMessage *);
@@ -104,8 +346,8 @@ class Heavy_EP_MK1 : public HeavyContext {
   static void cMsg_zLbZWnFO_sendMessage(HeavyContextInterface *, int, const HvMessage *);
   static void cBinop_JhA9xsTS_sendMessage(HeavyContextInterface *, int, const HvMessage *);
   static void cPack_BYT033Zm_sendMessage(HeavyContextInterface *, int, const HvMessage *);
-  static void cSwitchcase_oG9J2dvF_onMessage(HeavyContextInterface *, void *, int letIn, const HvMessage *const, void *);
-  static void cSlice_DhA4et2d_sendMessage(HeavyContextInterface *, int, const HvMessage *);
+  template <int V> static void cSwitchcase_oG9J2dvF_onMessage(HeavyContextInterface *, void *, int letIn, const HvMessage *const, void *);
+  template <int V> static void cSlice_DhA4et2d_sendMessage(HeavyContextInterface *, int, const HvMessage *);
   static void cBinop_z60tURxy_sendMessage(HeavyContextInterface *, int, const HvMessage *);
   static void cBinop_7Hb23T04_sendMessage(HeavyContextInterface *, int, const HvMessage *);
   static void cVar_ElxPJUxK_sendMessage(HeavyContextInterface *, int, const HvMessage *);
@@ -119,132 +361,132 @@ class Heavy_EP_MK1 : public HeavyContext {
   static void cBinop_jSKszev7_sendMessage(HeavyContextInterface *, int, const HvMessage *);
   static void cBinop_vPTjbp6l_sendMessage(HeavyContextInterface *, int, const HvMessage *);
   static void cBinop_BoHvJj3f_sendMessage(HeavyContextInterface *, int, const HvMessage *);
-  static void cSlice_bjkjROgL_sendMessage(HeavyContextInterface *, int, const HvMessage *);
-  static void cSlice_X59Ms47y_sendMessage(HeavyContextInterface *, int, const HvMessage *);
-  static void cBinop_qZhFVp8b_sendMessage(HeavyContextInterface *, int, const HvMessage *);
-  static void cBinop_puulPVJ8_sendMessage(HeavyContextInterface *, int, const HvMessage *);
-  static void cBinop_DrdAUms9_sendMessage(HeavyContextInterface *, int, const HvMessage *);
-  static void cBinop_5BolRjUc_sendMessage(HeavyContextInterface *, int, const HvMessage *);
-  static void cMsg_puiweEqf_sendMessage(HeavyContextInterface *, int, const HvMessage *);
-  static void cSwitchcase_tPwb42ks_onMessage(HeavyContextInterface *, void *, int letIn, const HvMessage *const, void *);
-  static void cDelay_XJtqLdR3_sendMessage(HeavyContextInterface *, int, const HvMessage *);
-  static void cMsg_Y3SeyQLm_sendMessage(HeavyContextInterface *, int, const HvMessage *);
-  static void cCast_zyxm9xt4_sendMessage(HeavyContextInterface *, int, const HvMessage *);
-  static void cPack_Tc48KAjO_sendMessage(HeavyContextInterface *, int, const HvMessage *);
-  static void cSlice_mxHzGYpx_sendMessage(HeavyContextInterface *, int, const HvMessage *);
-  static void cSlice_S1VOGbss_sendMessage(HeavyContextInterface *, int, const HvMessage *);
-  static void cVar_sZ2r4PVf_sendMessage(HeavyContextInterface *, int, const HvMessage *);
-  static void cMsg_iKXnugbR_sendMessage(HeavyContextInterface *, int, const HvMessage *);
-  static void cSystem_rsdZ4z9K_sendMessage(HeavyContextInterface *, int, const HvMessage *);
-  static void cBinop_3RBhQUO2_sendMessage(HeavyContextInterface *, int, const HvMessage *);
-  static void cBinop_k3xOFn9Y_sendMessage(HeavyContextInterface *, int, const HvMessage *);
-  static void cMsg_tjoYH8sh_sendMessage(HeavyContextInterface *, int, const HvMessage *);
-  static void cBinop_si1yqlyW_sendMessage(HeavyContextInterface *, int, const HvMessage *);
-  static void cBinop_RceFSyRR_sendMessage(HeavyContextInterface *, int, const HvMessage *);
-  static void cBinop_ByBj1s2m_sendMessage(HeavyContextInterface *, int, const HvMessage *);
-  static void cSwitchcase_PBqQjRJY_onMessage(HeavyContextInterface *, void *, int letIn, const HvMessage *const, void *);
-  static void cDelay_LdXQexFY_sendMessage(HeavyContextInterface *, int, const HvMessage *);
-  static void cMsg_alTHVTBj_sendMessage(HeavyContextInterface *, int, const HvMessage *);
-  static void cCast_q8WBZ5kV_sendMessage(HeavyContextInterface *, int, const HvMessage *);
-  static void cPack_mCFcgioO_sendMessage(HeavyContextInterface *, int, const HvMessage *);
-  static void cSlice_Km00ydT2_sendMessage(HeavyContextInterface *, int, const HvMessage *);
-  static void cSlice_1Q9bVNNN_sendMessage(HeavyContextInterface *, int, const HvMessage *);
-  static void cVar_NTVGi1rx_sendMessage(HeavyContextInterface *, int, const HvMessage *);
-  static void cMsg_JMXe4Ma3_sendMessage(HeavyContextInterface *, int, const HvMessage *);
-  static void cSystem_jkVp0Kx6_sendMessage(HeavyContextInterface *, int, const HvMessage *);
-  static void cBinop_D5D0LaYe_sendMessage(HeavyContextInterface *, int, const HvMessage *);
-  static void cBinop_HA94hCLv_sendMessage(HeavyContextInterface *, int, const HvMessage *);
-  static void cMsg_h8Wb1BsZ_sendMessage(HeavyContextInterface *, int, const HvMessage *);
-  static void cBinop_mTfoFJLO_sendMessage(HeavyContextInterface *, int, const HvMessage *);
-  static void cBinop_A2KsUGjR_sendMessage(HeavyContextInterface *, int, const HvMessage *);
-  static void cBinop_G6AE2PwA_sendMessage(HeavyContextInterface *, int, const HvMessage *);
-  static void cSwitchcase_WUtKOy78_onMessage(HeavyContextInterface *, void *, int letIn, const HvMessage *const, void *);
-  static void cSlice_8PkrkbiL_sendMessage(HeavyContextInterface *, int, const HvMessage *);
-  static void cSlice_AxhMJRiu_sendMessage(HeavyContextInterface *, int, const HvMessage *);
-  static void cBinop_Ti73JY9X_sendMessage(HeavyContextInterface *, int, const HvMessage *);
-  static void cBinop_aYuF0nQk_sendMessage(HeavyContextInterface *, int, const HvMessage *);
-  static void cBinop_GBGRcaro_sendMessage(HeavyContextInterface *, int, const HvMessage *);
-  static void cBinop_AUvUrY4R_sendMessage(HeavyContextInterface *, int, const HvMessage *);
-  static void cMsg_2BO3w29v_sendMessage(HeavyContextInterface *, int, const HvMessage *);
-  static void cSwitchcase_F7qGXQ00_onMessage(HeavyContextInterface *, void *, int letIn, const HvMessage *const, void *);
-  static void cCast_HSlHEo3Y_sendMessage(HeavyContextInterface *, int, const HvMessage *);
-  static void cMsg_mwVDhc33_sendMessage(HeavyContextInterface *, int, const HvMessage *);
-  static void cSystem_iEpbB1Tt_sendMessage(HeavyContextInterface *, int, const HvMessage *);
-  static void cMsg_h5Bsj9K4_sendMessage(HeavyContextInterface *, int, const HvMessage *);
-  static void cSystem_uncdQ37f_sendMessage(HeavyContextInterface *, int, const HvMessage *);
-  static void cDelay_yN9o31WM_sendMessage(HeavyContextInterface *, int, const HvMessage *);
-  static void cSwitchcase_aB1ee6eu_onMessage(HeavyContextInterface *, void *, int letIn, const HvMessage *const, void *);
-  static void cDelay_qZFKZiPY_sendMessage(HeavyContextInterface *, int, const HvMessage *);
-  static void cMsg_scaPpHxo_sendMessage(HeavyContextInterface *, int, const HvMessage *);
-  static void cCast_L944F4zY_sendMessage(HeavyContextInterface *, int, const HvMessage *);
-  static void cSwitchcase_Iv54fL1f_onMessage(HeavyContextInterface *, void *, int letIn, const HvMessage *const, void *);
-  static void cDelay_u4RfWjOf_sendMessage(HeavyContextInterface *, int, const HvMessage *);
-  static void cMsg_mQ7Y4evj_sendMessage(HeavyContextInterface *, int, const HvMessage *);
-  static void cCast_ozYOhZf7_sendMessage(HeavyContextInterface *, int, const HvMessage *);
-  static void cSwitchcase_qGp4pLv7_onMessage(HeavyContextInterface *, void *, int letIn, const HvMessage *const, void *);
-  static void cDelay_HvShZWxN_sendMessage(HeavyContextInterface *, int, const HvMessage *);
-  static void cMsg_5za4dMJS_sendMessage(HeavyContextInterface *, int, const HvMessage *);
-  static void cCast_1C4AfEl2_sendMessage(HeavyContextInterface *, int, const HvMessage *);
-  static void cSwitchcase_Gx61poeH_onMessage(HeavyContextInterface *, void *, int letIn, const HvMessage *const, void *);
-  static void cDelay_62QExDOA_sendMessage(HeavyContextInterface *, int, const HvMessage *);
-  static void cMsg_u88Owd7O_sendMessage(HeavyContextInterface *, int, const HvMessage *);
-  static void cCast_oZICOJL8_sendMessage(HeavyContextInterface *, int, const HvMessage *);
-  static void cDelay_twfJBpos_sendMessage(HeavyContextInterface *, int, const HvMessage *);
-  static void cSwitchcase_dnVPVUlN_onMessage(HeavyContextInterface *, void *, int letIn, const HvMessage *const, void *);
-  static void cCast_DNh0wPJB_sendMessage(HeavyContextInterface *, int, const HvMessage *);
-  static void cIf_uB5Z1HTu_sendMessage(HeavyContextInterface *, int, const HvMessage *);
-  static void cMsg_gp9whmCc_sendMessage(HeavyContextInterface *, int, const HvMessage *);
-  static void cBinop_gRen83wr_sendMessage(HeavyContextInterface *, int, const HvMessage *);
-  static void cBinop_7dajl5bE_sendMessage(HeavyContextInterface *, int, const HvMessage *);
-  static void cCast_HYVll2lR_sendMessage(HeavyContextInterface *, int, const HvMessage *);
-  static void cCast_B2ubKDES_sendMessage(HeavyContextInterface *, int, const HvMessage *);
-  static void cBinop_maqKW0Ak_sendMessage(HeavyContextInterface *, int, const HvMessage *);
-  static void cBinop_1pfH37j6_sendMessage(HeavyContextInterface *, int, const HvMessage *);
-  static void cMsg_m0uJKNwI_sendMessage(HeavyContextInterface *, int, const HvMessage *);
-  static void cBinop_VtqrJbdm_sendMessage(HeavyContextInterface *, int, const HvMessage *);
-  static void cPack_H3oA1KXj_sendMessage(HeavyContextInterface *, int, const HvMessage *);
-  static void cBinop_JuKEhSjI_sendMessage(HeavyContextInterface *, int, const HvMessage *);
-  static void cMsg_pcZ5VfKf_sendMessage(HeavyContextInterface *, int, const HvMessage *);
-  static void cBinop_F8TudeNI_sendMessage(HeavyContextInterface *, int, const HvMessage *);
-  static void cCast_ZnbsczMl_sendMessage(HeavyContextInterface *, int, const HvMessage *);
-  static void cCast_qnILIr3V_sendMessage(HeavyContextInterface *, int, const HvMessage *);
-  static void cMsg_sau9kNWL_sendMessage(HeavyContextInterface *, int, const HvMessage *);
-  static void cMsg_rt5iICvn_sendMessage(HeavyContextInterface *, int, const HvMessage *);
-  static void cBinop_j7sSgKsi_sendMessage(HeavyContextInterface *, int, const HvMessage *);
-  static void cMsg_W4073HRq_sendMessage(HeavyContextInterface *, int, const HvMessage *);
-  static void cBinop_H0pkypkT_sendMessage(HeavyContextInterface *, int, const HvMessage *);
-  static void cCast_82unbjQp_sendMessage(HeavyContextInterface *, int, const HvMessage *);
-  static void cCast_LDzBBnIB_sendMessage(HeavyContextInterface *, int, const HvMessage *);
-  static void cMsg_J9NUHt7W_sendMessage(HeavyContextInterface *, int, const HvMessage *);
-  static void cMsg_8vfufbLe_sendMessage(HeavyContextInterface *, int, const HvMessage *);
-  static void cCast_7jMyosM4_sendMessage(HeavyContextInterface *, int, const HvMessage *);
-  static void cCast_ZoDeIpFy_sendMessage(HeavyContextInterface *, int, const HvMessage *);
-  static void cMsg_dkpepr67_sendMessage(HeavyContextInterface *, int, const HvMessage *);
-  static void cMsg_rPtKYy3M_sendMessage(HeavyContextInterface *, int, const HvMessage *);
-  static void cBinop_3tTN8vR3_sendMessage(HeavyContextInterface *, int, const HvMessage *);
-  static void cMsg_tfyjDxKP_sendMessage(HeavyContextInterface *, int, const HvMessage *);
-  static void cBinop_dIYEAlww_sendMessage(HeavyContextInterface *, int, const HvMessage *);
-  static void cMsg_z4lOo8bC_sendMessage(HeavyContextInterface *, int, const HvMessage *);
-  static void cCast_J9xHtT7Q_sendMessage(HeavyContextInterface *, int, const HvMessage *);
-  static void cCast_QZxtFP7i_sendMessage(HeavyContextInterface *, int, const HvMessage *);
-  static void cCast_VFlsIg5P_sendMessage(HeavyContextInterface *, int, const HvMessage *);
-  static void cCast_x7fI6QRT_sendMessage(HeavyContextInterface *, int, const HvMessage *);
-  static void cCast_kmODmaFn_sendMessage(HeavyContextInterface *, int, const HvMessage *);
-  static void cCast_lzw09MRv_sendMessage(HeavyContextInterface *, int, const HvMessage *);
-  static void cMsg_5SkdkoAS_sendMessage(HeavyContextInterface *, int, const HvMessage *);
-  static void cCast_zrinnCdD_sendMessage(HeavyContextInterface *, int, const HvMessage *);
-  static void cCast_OxhalDGO_sendMessage(HeavyContextInterface *, int, const HvMessage *);
-  static void cMsg_tNJJ6cBJ_sendMessage(HeavyContextInterface *, int, const HvMessage *);
-  static void cMsg_gFJkvbAL_sendMessage(HeavyContextInterface *, int, const HvMessage *);
-  static void cMsg_hLRXbqS8_sendMessage(HeavyContextInterface *, int, const HvMessage *);
-  static void cBinop_c85ioJXE_sendMessage(HeavyContextInterface *, int, const HvMessage *);
-  static void cBinop_lklbN5Wj_sendMessage(HeavyContextInterface *, int, const HvMessage *);
-  static void cMsg_33fIYqZl_sendMessage(HeavyContextInterface *, int, const HvMessage *);
-  static void cBinop_7dgfWIsc_sendMessage(HeavyContextInterface *, int, const HvMessage *);
-  static void cBinop_IpPxuID9_sendMessage(HeavyContextInterface *, int, const HvMessage *);
-  static void cBinop_XKbyFfP1_sendMessage(HeavyContextInterface *, int, const HvMessage *);
-  static void cMsg_NuZfUb5j_sendMessage(HeavyContextInterface *, int, const HvMessage *);
-  static void cMsg_ICgFJaLq_sendMessage(HeavyContextInterface *, int, const HvMessage *);
+  template <int V> static void cSlice_bjkjROgL_sendMessage(HeavyContextInterface *, int, const HvMessage *);
+  template <int V> static void cSlice_X59Ms47y_sendMessage(HeavyContextInterface *, int, const HvMessage *);
+  template <int V> static void cBinop_qZhFVp8b_sendMessage(HeavyContextInterface *, int, const HvMessage *);
+  template <int V> static void cBinop_puulPVJ8_sendMessage(HeavyContextInterface *, int, const HvMessage *);
+  template <int V> static void cBinop_DrdAUms9_sendMessage(HeavyContextInterface *, int, const HvMessage *);
+  template <int V> static void cBinop_5BolRjUc_sendMessage(HeavyContextInterface *, int, const HvMessage *);
+  template <int V> static void cMsg_puiweEqf_sendMessage(HeavyContextInterface *, int, const HvMessage *);
+  template <int V> static void cSwitchcase_tPwb42ks_onMessage(HeavyContextInterface *, void *, int letIn, const HvMessage *const, void *);
+  template <int V> static void cDelay_XJtqLdR3_sendMessage(HeavyContextInterface *, int, const HvMessage *);
+  template <int V> static void cMsg_Y3SeyQLm_sendMessage(HeavyContextInterface *, int, const HvMessage *);
+  template <int V> static void cCast_zyxm9xt4_sendMessage(HeavyContextInterface *, int, const HvMessage *);
+  template <int V> static void cPack_Tc48KAjO_sendMessage(HeavyContextInterface *, int, const HvMessage *);
+  template <int V> static void cSlice_mxHzGYpx_sendMessage(HeavyContextInterface *, int, const HvMessage *);
+  template <int V> static void cSlice_S1VOGbss_sendMessage(HeavyContextInterface *, int, const HvMessage *);
+  template <int V> static void cVar_sZ2r4PVf_sendMessage(HeavyContextInterface *, int, const HvMessage *);
+  template <int V> static void cMsg_iKXnugbR_sendMessage(HeavyContextInterface *, int, const HvMessage *);
+  template <int V> static void cSystem_rsdZ4z9K_sendMessage(HeavyContextInterface *, int, const HvMessage *);
+  template <int V> static void cBinop_3RBhQUO2_sendMessage(HeavyContextInterface *, int, const HvMessage *);
+  template <int V> static void cBinop_k3xOFn9Y_sendMessage(HeavyContextInterface *, int, const HvMessage *);
+  template <int V> static void cMsg_tjoYH8sh_sendMessage(HeavyContextInterface *, int, const HvMessage *);
+  template <int V> static void cBinop_si1yqlyW_sendMessage(HeavyContextInterface *, int, const HvMessage *);
+  template <int V> static void cBinop_RceFSyRR_sendMessage(HeavyContextInterface *, int, const HvMessage *);
+  template <int V> static void cBinop_ByBj1s2m_sendMessage(HeavyContextInterface *, int, const HvMessage *);
+  template <int V> static void cSwitchcase_PBqQjRJY_onMessage(HeavyContextInterface *, void *, int letIn, const HvMessage *const, void *);
+  template <int V> static void cDelay_LdXQexFY_sendMessage(HeavyContextInterface *, int, const HvMessage *);
+  template <int V> static void cMsg_alTHVTBj_sendMessage(HeavyContextInterface *, int, const HvMessage *);
+  template <int V> static void cCast_q8WBZ5kV_sendMessage(HeavyContextInterface *, int, const HvMessage *);
+  template <int V> static void cPack_mCFcgioO_sendMessage(HeavyContextInterface *, int, const HvMessage *);
+  template <int V> static void cSlice_Km00ydT2_sendMessage(HeavyContextInterface *, int, const HvMessage *);
+  template <int V> static void cSlice_1Q9bVNNN_sendMessage(HeavyContextInterface *, int, const HvMessage *);
+  template <int V> static void cVar_NTVGi1rx_sendMessage(HeavyContextInterface *, int, const HvMessage *);
+  template <int V> static void cMsg_JMXe4Ma3_sendMessage(HeavyContextInterface *, int, const HvMessage *);
+  template <int V> static void cSystem_jkVp0Kx6_sendMessage(HeavyContextInterface *, int, const HvMessage *);
+  template <int V> static void cBinop_D5D0LaYe_sendMessage(HeavyContextInterface *, int, const HvMessage *);
+  template <int V> static void cBinop_HA94hCLv_sendMessage(HeavyContextInterface *, int, const HvMessage *);
+  template <int V> static void cMsg_h8Wb1BsZ_sendMessage(HeavyContextInterface *, int, const HvMessage *);
+  template <int V> static void cBinop_mTfoFJLO_sendMessage(HeavyContextInterface *, int, const HvMessage *);
+  template <int V> static void cBinop_A2KsUGjR_sendMessage(HeavyContextInterface *, int, const HvMessage *);
+  template <int V> static void cBinop_G6AE2PwA_sendMessage(HeavyContextInterface *, int, const HvMessage *);
+  template <int V> static void cSwitchcase_WUtKOy78_onMessage(HeavyContextInterface *, void *, int letIn, const HvMessage *const, void *);
+  template <int V> static void cSlice_8PkrkbiL_sendMessage(HeavyContextInterface *, int, const HvMessage *);
+  template <int V> static void cSlice_AxhMJRiu_sendMessage(HeavyContextInterface *, int, const HvMessage *);
+  template <int V> static void cBinop_Ti73JY9X_sendMessage(HeavyContextInterface *, int, const HvMessage *);
+  template <int V> static void cBinop_aYuF0nQk_sendMessage(HeavyContextInterface *, int, const HvMessage *);
+  template <int V> static void cBinop_GBGRcaro_sendMessage(HeavyContextInterface *, int, const HvMessage *);
+  template <int V> static void cBinop_AUvUrY4R_sendMessage(HeavyContextInterface *, int, const HvMessage *);
+  template <int V> static void cMsg_2BO3w29v_sendMessage(HeavyContextInterface *, int, const HvMessage *);
+  template <int V> static void cSwitchcase_F7qGXQ00_onMessage(HeavyContextInterface *, void *, int letIn, const HvMessage *const, void *);
+  template <int V> static void cCast_HSlHEo3Y_sendMessage(HeavyContextInterface *, int, const HvMessage *);
+  template <int V> static void cMsg_mwVDhc33_sendMessage(HeavyContextInterface *, int, const HvMessage *);
+  template <int V> static void cSystem_iEpbB1Tt_sendMessage(HeavyContextInterface *, int, const HvMessage *);
+  template <int V> static void cMsg_h5Bsj9K4_sendMessage(HeavyContextInterface *, int, const HvMessage *);
+  template <int V> static void cSystem_uncdQ37f_sendMessage(HeavyContextInterface *, int, const HvMessage *);
+  template <int V> static void cDelay_yN9o31WM_sendMessage(HeavyContextInterface *, int, const HvMessage *);
+  template <int V> static void cSwitchcase_aB1ee6eu_onMessage(HeavyContextInterface *, void *, int letIn, const HvMessage *const, void *);
+  template <int V> static void cDelay_qZFKZiPY_sendMessage(HeavyContextInterface *, int, const HvMessage *);
+  template <int V> static void cMsg_scaPpHxo_sendMessage(HeavyContextInterface *, int, const HvMessage *);
+  template <int V> static void cCast_L944F4zY_sendMessage(HeavyContextInterface *, int, const HvMessage *);
+  template <int V> static void cSwitchcase_Iv54fL1f_onMessage(HeavyContextInterface *, void *, int letIn, const HvMessage *const, void *);
+  template <int V> static void cDelay_u4RfWjOf_sendMessage(HeavyContextInterface *, int, const HvMessage *);
+  template <int V> static void cMsg_mQ7Y4evj_sendMessage(HeavyContextInterface *, int, const HvMessage *);
+  template <int V> static void cCast_ozYOhZf7_sendMessage(HeavyContextInterface *, int, const HvMessage *);
+  template <int V> static void cSwitchcase_qGp4pLv7_onMessage(HeavyContextInterface *, void *, int letIn, const HvMessage *const, void *);
+  template <int V> static void cDelay_HvShZWxN_sendMessage(HeavyContextInterface *, int, const HvMessage *);
+  template <int V> static void cMsg_5za4dMJS_sendMessage(HeavyContextInterface *, int, const HvMessage *);
+  template <int V> static void cCast_1C4AfEl2_sendMessage(HeavyContextInterface *, int, const HvMessage *);
+  template <int V> static void cSwitchcase_Gx61poeH_onMessage(HeavyContextInterface *, void *, int letIn, const HvMessage *const, void *);
+  template <int V> static void cDelay_62QExDOA_sendMessage(HeavyContextInterface *, int, const HvMessage *);
+  template <int V> static void cMsg_u88Owd7O_sendMessage(HeavyContextInterface *, int, const HvMessage *);
+  template <int V> static void cCast_oZICOJL8_sendMessage(HeavyContextInterface *, int, const HvMessage *);
+  template <int V> static void cDelay_twfJBpos_sendMessage(HeavyContextInterface *, int, const HvMessage *);
+  template <int V> static void cSwitchcase_dnVPVUlN_onMessage(HeavyContextInterface *, void *, int letIn, const HvMessage *const, void *);
+  template <int V> static void cCast_DNh0wPJB_sendMessage(HeavyContextInterface *, int, const HvMessage *);
+  template <int V> static void cIf_uB5Z1HTu_sendMessage(HeavyContextInterface *, int, const HvMessage *);
+  template <int V> static void cMsg_gp9whmCc_sendMessage(HeavyContextInterface *, int, const HvMessage *);
+  template <int V> static void cBinop_gRen83wr_sendMessage(HeavyContextInterface *, int, const HvMessage *);
+  template <int V> static void cBinop_7dajl5bE_sendMessage(HeavyContextInterface *, int, const HvMessage *);
+  template <int V> static void cCast_HYVll2lR_sendMessage(HeavyContextInterface *, int, const HvMessage *);
+  template <int V> static void cCast_B2ubKDES_sendMessage(HeavyContextInterface *, int, const HvMessage *);
+  template <int V> static void cBinop_maqKW0Ak_sendMessage(HeavyContextInterface *, int, const HvMessage *);
+  template <int V> static void cBinop_1pfH37j6_sendMessage(HeavyContextInterface *, int, const HvMessage *);
+  template <int V> static void cMsg_m0uJKNwI_sendMessage(HeavyContextInterface *, int, const HvMessage *);
+  template <int V> static void cBinop_VtqrJbdm_sendMessage(HeavyContextInterface *, int, const HvMessage *);
+  template <int V> static void cPack_H3oA1KXj_sendMessage(HeavyContextInterface *, int, const HvMessage *);
+  template <int V> static void cBinop_JuKEhSjI_sendMessage(HeavyContextInterface *, int, const HvMessage *);
+  template <int V> static void cMsg_pcZ5VfKf_sendMessage(HeavyContextInterface *, int, const HvMessage *);
+  template <int V> static void cBinop_F8TudeNI_sendMessage(HeavyContextInterface *, int, const HvMessage *);
+  template <int V> static void cCast_ZnbsczMl_sendMessage(HeavyContextInterface *, int, const HvMessage *);
+  template <int V> static void cCast_qnILIr3V_sendMessage(HeavyContextInterface *, int, const HvMessage *);
+  template <int V> static void cMsg_sau9kNWL_sendMessage(HeavyContextInterface *, int, const HvMessage *);
+  template <int V> static void cMsg_rt5iICvn_sendMessage(HeavyContextInterface *, int, const HvMessage *);
+  template <int V> static void cBinop_j7sSgKsi_sendMessage(HeavyContextInterface *, int, const HvMessage *);
+  template <int V> static void cMsg_W4073HRq_sendMessage(HeavyContextInterface *, int, const HvMessage *);
+  template <int V> static void cBinop_H0pkypkT_sendMessage(HeavyContextInterface *, int, const HvMessage *);
+  template <int V> static void cCast_82unbjQp_sendMessage(HeavyContextInterface *, int, const HvMessage *);
+  template <int V> static void cCast_LDzBBnIB_sendMessage(HeavyContextInterface *, int, const HvMessage *);
+  template <int V> static void cMsg_J9NUHt7W_sendMessage(HeavyContextInterface *, int, const HvMessage *);
+  template <int V> static void cMsg_8vfufbLe_sendMessage(HeavyContextInterface *, int, const HvMessage *);
+  template <int V> static void cCast_7jMyosM4_sendMessage(HeavyContextInterface *, int, const HvMessage *);
+  template <int V> static void cCast_ZoDeIpFy_sendMessage(HeavyContextInterface *, int, const HvMessage *);
+  template <int V> static void cMsg_dkpepr67_sendMessage(HeavyContextInterface *, int, const HvMessage *);
+  template <int V> static void cMsg_rPtKYy3M_sendMessage(HeavyContextInterface *, int, const HvMessage *);
+  template <int V> static void cBinop_3tTN8vR3_sendMessage(HeavyContextInterface *, int, const HvMessage *);
+  template <int V> static void cMsg_tfyjDxKP_sendMessage(HeavyContextInterface *, int, const HvMessage *);
+  template <int V> static void cBinop_dIYEAlww_sendMessage(HeavyContextInterface *, int, const HvMessage *);
+  template <int V> static void cMsg_z4lOo8bC_sendMessage(HeavyContextInterface *, int, const HvMessage *);
+  template <int V> static void cCast_J9xHtT7Q_sendMessage(HeavyContextInterface *, int, const HvMessage *);
+  template <int V> static void cCast_QZxtFP7i_sendMessage(HeavyContextInterface *, int, const HvMessage *);
+  template <int V> static void cCast_VFlsIg5P_sendMessage(HeavyContextInterface *, int, const HvMessage *);
+  template <int V> static void cCast_x7fI6QRT_sendMessage(HeavyContextInterface *, int, const HvMessage *);
+  template <int V> static void cCast_kmODmaFn_sendMessage(HeavyContextInterface *, int, const HvMessage *);
+  template <int V> static void cCast_lzw09MRv_sendMessage(HeavyContextInterface *, int, const HvMessage *);
+  template <int V> static void cMsg_5SkdkoAS_sendMessage(HeavyContextInterface *, int, const HvMessage *);
+  template <int V> static void cCast_zrinnCdD_sendMessage(HeavyContextInterface *, int, const HvMessage *);
+  template <int V> static void cCast_OxhalDGO_sendMessage(HeavyContextInterface *, int, const HvMessage *);
+  template <int V> static void cMsg_tNJJ6cBJ_sendMessage(HeavyContextInterface *, int, const HvMessage *);
+  template <int V> static void cMsg_gFJkvbAL_sendMessage(HeavyContextInterface *, int, const HvMessage *);
+  template <int V> static void cMsg_hLRXbqS8_sendMessage(HeavyContextInterface *, int, const HvMessage *);
+  template <int V> static void cBinop_c85ioJXE_sendMessage(HeavyContextInterface *, int, const HvMessage *);
+  template <int V> static void cBinop_lklbN5Wj_sendMessage(HeavyContextInterface *, int, const HvMessage *);
+  template <int V> static void cMsg_33fIYqZl_sendMessage(HeavyContextInterface *, int, const HvMessage *);
+  template <int V> static void cBinop_7dgfWIsc_sendMessage(HeavyContextInterface *, int, const HvMessage *);
+  template <int V> static void cBinop_IpPxuID9_sendMessage(HeavyContextInterface *, int, const HvMessage *);
+  template <int V> static void cBinop_XKbyFfP1_sendMessage(HeavyContextInterface *, int, const HvMessage *);
+  template <int V> static void cMsg_NuZfUb5j_sendMessage(HeavyContextInterface *, int, const HvMessage *);
+  template <int V> static void cMsg_ICgFJaLq_sendMessage(HeavyContextInterface *, int, const HvMessage *);
   static void cVar_W2qTdReU_sendMessage(HeavyContextInterface *, int, const HvMessage *);
   static void cVar_t9FMWBot_sendMessage(HeavyContextInterface *, int, const HvMessage *);
   static void cSwitchcase_qYBxKwmu_onMessage(HeavyContextInterface *, void *, int letIn, const HvMessage *const, void *);
@@ -623,902 +865,6 @@ class Heavy_EP_MK1 : public HeavyContext {
   static void cBinop_aRCf7ezT_sendMessage(HeavyContextInterface *, int, const HvMessage *);
   static void cBinop_b9e8k91q_sendMessage(HeavyContextInterface *, int, const HvMessage *);
   static void cBinop_7AH6hATD_sendMessage(HeavyContextInterface *, int, const HvMessage *);
-  static void cSlice_2INuIXhx_sendMessage(HeavyContextInterface *, int, const HvMessage *);
-  static void cSlice_rIS4wCWL_sendMessage(HeavyContextInterface *, int, const HvMessage *);
-  static void cBinop_anivr1Px_sendMessage(HeavyContextInterface *, int, const HvMessage *);
-  static void cBinop_Zzp7ey9u_sendMessage(HeavyContextInterface *, int, const HvMessage *);
-  static void cBinop_qNNqg8fl_sendMessage(HeavyContextInterface *, int, const HvMessage *);
-  static void cBinop_D4pAxZXo_sendMessage(HeavyContextInterface *, int, const HvMessage *);
-  static void cMsg_h9kP8P4g_sendMessage(HeavyContextInterface *, int, const HvMessage *);
-  static void cSwitchcase_APJ4Rlvd_onMessage(HeavyContextInterface *, void *, int letIn, const HvMessage *const, void *);
-  static void cDelay_fChR2EMd_sendMessage(HeavyContextInterface *, int, const HvMessage *);
-  static void cMsg_FGVof3f3_sendMessage(HeavyContextInterface *, int, const HvMessage *);
-  static void cCast_3kbCJtC1_sendMessage(HeavyContextInterface *, int, const HvMessage *);
-  static void cPack_5c1776aq_sendMessage(HeavyContextInterface *, int, const HvMessage *);
-  static void cSlice_uOTUFrWe_sendMessage(HeavyContextInterface *, int, const HvMessage *);
-  static void cSlice_2v2J5hCG_sendMessage(HeavyContextInterface *, int, const HvMessage *);
-  static void cVar_f7mZhooZ_sendMessage(HeavyContextInterface *, int, const HvMessage *);
-  static void cMsg_emXeKopE_sendMessage(HeavyContextInterface *, int, const HvMessage *);
-  static void cSystem_8NzDluXu_sendMessage(HeavyContextInterface *, int, const HvMessage *);
-  static void cBinop_lV6bOwnK_sendMessage(HeavyContextInterface *, int, const HvMessage *);
-  static void cBinop_GbGYOiva_sendMessage(HeavyContextInterface *, int, const HvMessage *);
-  static void cMsg_QnG0Lrhv_sendMessage(HeavyContextInterface *, int, const HvMessage *);
-  static void cBinop_Di0BSSgC_sendMessage(HeavyContextInterface *, int, const HvMessage *);
-  static void cBinop_oqPfrp1J_sendMessage(HeavyContextInterface *, int, const HvMessage *);
-  static void cBinop_JmyVXmNs_sendMessage(HeavyContextInterface *, int, const HvMessage *);
-  static void cSwitchcase_vgABNAXO_onMessage(HeavyContextInterface *, void *, int letIn, const HvMessage *const, void *);
-  static void cDelay_1yRWlMR0_sendMessage(HeavyContextInterface *, int, const HvMessage *);
-  static void cMsg_EADYdXGl_sendMessage(HeavyContextInterface *, int, const HvMessage *);
-  static void cCast_6KCFIGwR_sendMessage(HeavyContextInterface *, int, const HvMessage *);
-  static void cPack_SwGJLASp_sendMessage(HeavyContextInterface *, int, const HvMessage *);
-  static void cSlice_dtyI5XH4_sendMessage(HeavyContextInterface *, int, const HvMessage *);
-  static void cSlice_0n4vTued_sendMessage(HeavyContextInterface *, int, const HvMessage *);
-  static void cVar_cuvWDrFY_sendMessage(HeavyContextInterface *, int, const HvMessage *);
-  static void cMsg_fxp86nbP_sendMessage(HeavyContextInterface *, int, const HvMessage *);
-  static void cSystem_cUfQczTw_sendMessage(HeavyContextInterface *, int, const HvMessage *);
-  static void cBinop_CgfALdqs_sendMessage(HeavyContextInterface *, int, const HvMessage *);
-  static void cBinop_qjO6txa1_sendMessage(HeavyContextInterface *, int, const HvMessage *);
-  static void cMsg_7SQCIKgW_sendMessage(HeavyContextInterface *, int, const HvMessage *);
-  static void cBinop_r5YmAXgy_sendMessage(HeavyContextInterface *, int, const HvMessage *);
-  static void cBinop_4ZiErfzd_sendMessage(HeavyContextInterface *, int, const HvMessage *);
-  static void cBinop_bEbE8c1Q_sendMessage(HeavyContextInterface *, int, const HvMessage *);
-  static void cSwitchcase_lvSweEZ0_onMessage(HeavyContextInterface *, void *, int letIn, const HvMessage *const, void *);
-  static void cSlice_XuiDQjrM_sendMessage(HeavyContextInterface *, int, const HvMessage *);
-  static void cSlice_jf2Ro2dy_sendMessage(HeavyContextInterface *, int, const HvMessage *);
-  static void cBinop_apMcAOFx_sendMessage(HeavyContextInterface *, int, const HvMessage *);
-  static void cBinop_C9qeifus_sendMessage(HeavyContextInterface *, int, const HvMessage *);
-  static void cBinop_cXPXdUfF_sendMessage(HeavyContextInterface *, int, const HvMessage *);
-  static void cBinop_JmxewGJv_sendMessage(HeavyContextInterface *, int, const HvMessage *);
-  static void cMsg_KqRClAmB_sendMessage(HeavyContextInterface *, int, const HvMessage *);
-  static void cSwitchcase_lO6w9D3S_onMessage(HeavyContextInterface *, void *, int letIn, const HvMessage *const, void *);
-  static void cCast_8BHMru9s_sendMessage(HeavyContextInterface *, int, const HvMessage *);
-  static void cMsg_fNVYmuRq_sendMessage(HeavyContextInterface *, int, const HvMessage *);
-  static void cSystem_KdI1vnAr_sendMessage(HeavyContextInterface *, int, const HvMessage *);
-  static void cMsg_FyHDrtsd_sendMessage(HeavyContextInterface *, int, const HvMessage *);
-  static void cSystem_h4d3tlmE_sendMessage(HeavyContextInterface *, int, const HvMessage *);
-  static void cDelay_a1Yr3GlD_sendMessage(HeavyContextInterface *, int, const HvMessage *);
-  static void cSwitchcase_dtNJQ6K6_onMessage(HeavyContextInterface *, void *, int letIn, const HvMessage *const, void *);
-  static void cDelay_odpMaBGc_sendMessage(HeavyContextInterface *, int, const HvMessage *);
-  static void cMsg_bsPSOHBL_sendMessage(HeavyContextInterface *, int, const HvMessage *);
-  static void cCast_6WA4eR2z_sendMessage(HeavyContextInterface *, int, const HvMessage *);
-  static void cSwitchcase_7cpVtmSE_onMessage(HeavyContextInterface *, void *, int letIn, const HvMessage *const, void *);
-  static void cDelay_zIGcbWr6_sendMessage(HeavyContextInterface *, int, const HvMessage *);
-  static void cMsg_HMN6u30V_sendMessage(HeavyContextInterface *, int, const HvMessage *);
-  static void cCast_z1AJRAYb_sendMessage(HeavyContextInterface *, int, const HvMessage *);
-  static void cSwitchcase_YWGVI436_onMessage(HeavyContextInterface *, void *, int letIn, const HvMessage *const, void *);
-  static void cDelay_PYqe7fPW_sendMessage(HeavyContextInterface *, int, const HvMessage *);
-  static void cMsg_i0g200qz_sendMessage(HeavyContextInterface *, int, const HvMessage *);
-  static void cCast_gKnnfuMu_sendMessage(HeavyContextInterface *, int, const HvMessage *);
-  static void cSwitchcase_s1xwGczR_onMessage(HeavyContextInterface *, void *, int letIn, const HvMessage *const, void *);
-  static void cDelay_YTuA3aGI_sendMessage(HeavyContextInterface *, int, const HvMessage *);
-  static void cMsg_2AEOqncp_sendMessage(HeavyContextInterface *, int, const HvMessage *);
-  static void cCast_LELHGy7h_sendMessage(HeavyContextInterface *, int, const HvMessage *);
-  static void cDelay_B0f8yaM4_sendMessage(HeavyContextInterface *, int, const HvMessage *);
-  static void cSwitchcase_lBGbwojA_onMessage(HeavyContextInterface *, void *, int letIn, const HvMessage *const, void *);
-  static void cCast_S9fNqTQF_sendMessage(HeavyContextInterface *, int, const HvMessage *);
-  static void cIf_drS0YQ1l_sendMessage(HeavyContextInterface *, int, const HvMessage *);
-  static void cMsg_3GE6O36z_sendMessage(HeavyContextInterface *, int, const HvMessage *);
-  static void cBinop_NbhbI6Aw_sendMessage(HeavyContextInterface *, int, const HvMessage *);
-  static void cBinop_pOL4RXb6_sendMessage(HeavyContextInterface *, int, const HvMessage *);
-  static void cCast_ALLoyhj4_sendMessage(HeavyContextInterface *, int, const HvMessage *);
-  static void cCast_nWnQKHDf_sendMessage(HeavyContextInterface *, int, const HvMessage *);
-  static void cBinop_85xlG53a_sendMessage(HeavyContextInterface *, int, const HvMessage *);
-  static void cBinop_Cfh8L2Oh_sendMessage(HeavyContextInterface *, int, const HvMessage *);
-  static void cMsg_9gpPNaLn_sendMessage(HeavyContextInterface *, int, const HvMessage *);
-  static void cBinop_f1GPe8wH_sendMessage(HeavyContextInterface *, int, const HvMessage *);
-  static void cPack_nY24jnaO_sendMessage(HeavyContextInterface *, int, const HvMessage *);
-  static void cBinop_jxSH4lC7_sendMessage(HeavyContextInterface *, int, const HvMessage *);
-  static void cMsg_Kr66zLqC_sendMessage(HeavyContextInterface *, int, const HvMessage *);
-  static void cBinop_C0Wn6bJr_sendMessage(HeavyContextInterface *, int, const HvMessage *);
-  static void cCast_8LglT0zT_sendMessage(HeavyContextInterface *, int, const HvMessage *);
-  static void cCast_vSwCGGuH_sendMessage(HeavyContextInterface *, int, const HvMessage *);
-  static void cMsg_3wCqimft_sendMessage(HeavyContextInterface *, int, const HvMessage *);
-  static void cMsg_eS2Rovnu_sendMessage(HeavyContextInterface *, int, const HvMessage *);
-  static void cBinop_rRe2nMN0_sendMessage(HeavyContextInterface *, int, const HvMessage *);
-  static void cMsg_aHPfufNm_sendMessage(HeavyContextInterface *, int, const HvMessage *);
-  static void cBinop_R6mPsfGd_sendMessage(HeavyContextInterface *, int, const HvMessage *);
-  static void cCast_VQOHYJNi_sendMessage(HeavyContextInterface *, int, const HvMessage *);
-  static void cCast_2XjwilZg_sendMessage(HeavyContextInterface *, int, const HvMessage *);
-  static void cMsg_2pZV6Isa_sendMessage(HeavyContextInterface *, int, const HvMessage *);
-  static void cMsg_lTPANKWv_sendMessage(HeavyContextInterface *, int, const HvMessage *);
-  static void cCast_qDV0Ytnx_sendMessage(HeavyContextInterface *, int, const HvMessage *);
-  static void cCast_uZLgjKs3_sendMessage(HeavyContextInterface *, int, const HvMessage *);
-  static void cMsg_4VZAheL7_sendMessage(HeavyContextInterface *, int, const HvMessage *);
-  static void cMsg_McFVZ0Ll_sendMessage(HeavyContextInterface *, int, const HvMessage *);
-  static void cBinop_kIOWepAR_sendMessage(HeavyContextInterface *, int, const HvMessage *);
-  static void cMsg_V4moeuRd_sendMessage(HeavyContextInterface *, int, const HvMessage *);
-  static void cBinop_moMtXn4m_sendMessage(HeavyContextInterface *, int, const HvMessage *);
-  static void cMsg_HemNUF3Z_sendMessage(HeavyContextInterface *, int, const HvMessage *);
-  static void cCast_pbsGlW4B_sendMessage(HeavyContextInterface *, int, const HvMessage *);
-  static void cCast_HbyyrDXM_sendMessage(HeavyContextInterface *, int, const HvMessage *);
-  static void cCast_xoZj2b3V_sendMessage(HeavyContextInterface *, int, const HvMessage *);
-  static void cCast_HPFjicw6_sendMessage(HeavyContextInterface *, int, const HvMessage *);
-  static void cCast_omE6hhyU_sendMessage(HeavyContextInterface *, int, const HvMessage *);
-  static void cCast_zkHxLmhP_sendMessage(HeavyContextInterface *, int, const HvMessage *);
-  static void cMsg_NE37oH26_sendMessage(HeavyContextInterface *, int, const HvMessage *);
-  static void cCast_oj0DbcAj_sendMessage(HeavyContextInterface *, int, const HvMessage *);
-  static void cCast_03MpBgyk_sendMessage(HeavyContextInterface *, int, const HvMessage *);
-  static void cMsg_lRds2qee_sendMessage(HeavyContextInterface *, int, const HvMessage *);
-  static void cMsg_z5sQN4qF_sendMessage(HeavyContextInterface *, int, const HvMessage *);
-  static void cMsg_cs02sYyb_sendMessage(HeavyContextInterface *, int, const HvMessage *);
-  static void cBinop_zDi7M02d_sendMessage(HeavyContextInterface *, int, const HvMessage *);
-  static void cBinop_k49e22Gp_sendMessage(HeavyContextInterface *, int, const HvMessage *);
-  static void cMsg_R48tlqs4_sendMessage(HeavyContextInterface *, int, const HvMessage *);
-  static void cBinop_NixFIDVe_sendMessage(HeavyContextInterface *, int, const HvMessage *);
-  static void cBinop_zrBIyQso_sendMessage(HeavyContextInterface *, int, const HvMessage *);
-  static void cBinop_dhr9C5zZ_sendMessage(HeavyContextInterface *, int, const HvMessage *);
-  static void cMsg_0QFSYRTy_sendMessage(HeavyContextInterface *, int, const HvMessage *);
-  static void cMsg_AToUhGDl_sendMessage(HeavyContextInterface *, int, const HvMessage *);
-  static void cSlice_qZT4eBYV_sendMessage(HeavyContextInterface *, int, const HvMessage *);
-  static void cSlice_7oNej4sG_sendMessage(HeavyContextInterface *, int, const HvMessage *);
-  static void cBinop_l3RXDCtN_sendMessage(HeavyContextInterface *, int, const HvMessage *);
-  static void cBinop_tsESU4RN_sendMessage(HeavyContextInterface *, int, const HvMessage *);
-  static void cBinop_nWXpuFVx_sendMessage(HeavyContextInterface *, int, const HvMessage *);
-  static void cBinop_AUKqDMCP_sendMessage(HeavyContextInterface *, int, const HvMessage *);
-  static void cMsg_tuBmcMzI_sendMessage(HeavyContextInterface *, int, const HvMessage *);
-  static void cSwitchcase_pgCsBXVe_onMessage(HeavyContextInterface *, void *, int letIn, const HvMessage *const, void *);
-  static void cDelay_ZtwXRUif_sendMessage(HeavyContextInterface *, int, const HvMessage *);
-  static void cMsg_kk9ldTid_sendMessage(HeavyContextInterface *, int, const HvMessage *);
-  static void cCast_L5lS74o2_sendMessage(HeavyContextInterface *, int, const HvMessage *);
-  static void cPack_J0CLxFll_sendMessage(HeavyContextInterface *, int, const HvMessage *);
-  static void cSlice_YosQUGW6_sendMessage(HeavyContextInterface *, int, const HvMessage *);
-  static void cSlice_w1ytFFHJ_sendMessage(HeavyContextInterface *, int, const HvMessage *);
-  static void cVar_I5axLBa7_sendMessage(HeavyContextInterface *, int, const HvMessage *);
-  static void cMsg_xUIk35fz_sendMessage(HeavyContextInterface *, int, const HvMessage *);
-  static void cSystem_dhp6hY1K_sendMessage(HeavyContextInterface *, int, const HvMessage *);
-  static void cBinop_8mUuoz38_sendMessage(HeavyContextInterface *, int, const HvMessage *);
-  static void cBinop_llPN8wky_sendMessage(HeavyContextInterface *, int, const HvMessage *);
-  static void cMsg_punPVQER_sendMessage(HeavyContextInterface *, int, const HvMessage *);
-  static void cBinop_bjbPNxTO_sendMessage(HeavyContextInterface *, int, const HvMessage *);
-  static void cBinop_nCoZaBF0_sendMessage(HeavyContextInterface *, int, const HvMessage *);
-  static void cBinop_9Mvq2M0P_sendMessage(HeavyContextInterface *, int, const HvMessage *);
-  static void cSwitchcase_y8kaEfcl_onMessage(HeavyContextInterface *, void *, int letIn, const HvMessage *const, void *);
-  static void cDelay_iN9nDqKH_sendMessage(HeavyContextInterface *, int, const HvMessage *);
-  static void cMsg_sbFXwqUJ_sendMessage(HeavyContextInterface *, int, const HvMessage *);
-  static void cCast_LaYbGFDV_sendMessage(HeavyContextInterface *, int, const HvMessage *);
-  static void cPack_XcUCeI3v_sendMessage(HeavyContextInterface *, int, const HvMessage *);
-  static void cSlice_nOSjeXgq_sendMessage(HeavyContextInterface *, int, const HvMessage *);
-  static void cSlice_qIBpEnnd_sendMessage(HeavyContextInterface *, int, const HvMessage *);
-  static void cVar_6lY50lnm_sendMessage(HeavyContextInterface *, int, const HvMessage *);
-  static void cMsg_Axz1orYI_sendMessage(HeavyContextInterface *, int, const HvMessage *);
-  static void cSystem_mBQ668Zx_sendMessage(HeavyContextInterface *, int, const HvMessage *);
-  static void cBinop_KyQEhWTY_sendMessage(HeavyContextInterface *, int, const HvMessage *);
-  static void cBinop_tLvLAlZL_sendMessage(HeavyContextInterface *, int, const HvMessage *);
-  static void cMsg_kVyfvXw5_sendMessage(HeavyContextInterface *, int, const HvMessage *);
-  static void cBinop_WTmBkKQT_sendMessage(HeavyContextInterface *, int, const HvMessage *);
-  static void cBinop_jj4NG7qf_sendMessage(HeavyContextInterface *, int, const HvMessage *);
-  static void cBinop_FGtkRlDO_sendMessage(HeavyContextInterface *, int, const HvMessage *);
-  static void cSwitchcase_pqtCDn8K_onMessage(HeavyContextInterface *, void *, int letIn, const HvMessage *const, void *);
-  static void cSlice_UaT8lPaC_sendMessage(HeavyContextInterface *, int, const HvMessage *);
-  static void cSlice_F4UGzXJD_sendMessage(HeavyContextInterface *, int, const HvMessage *);
-  static void cBinop_QrSnCJCJ_sendMessage(HeavyContextInterface *, int, const HvMessage *);
-  static void cBinop_fJLC2pkO_sendMessage(HeavyContextInterface *, int, const HvMessage *);
-  static void cBinop_Fa78vtHE_sendMessage(HeavyContextInterface *, int, const HvMessage *);
-  static void cBinop_pNB7bAH5_sendMessage(HeavyContextInterface *, int, const HvMessage *);
-  static void cMsg_ACimLjhV_sendMessage(HeavyContextInterface *, int, const HvMessage *);
-  static void cSwitchcase_9ymEkSqF_onMessage(HeavyContextInterface *, void *, int letIn, const HvMessage *const, void *);
-  static void cCast_aJfuyvxQ_sendMessage(HeavyContextInterface *, int, const HvMessage *);
-  static void cMsg_vnInM2TA_sendMessage(HeavyContextInterface *, int, const HvMessage *);
-  static void cSystem_qTrmIzZM_sendMessage(HeavyContextInterface *, int, const HvMessage *);
-  static void cMsg_zX4gvtjh_sendMessage(HeavyContextInterface *, int, const HvMessage *);
-  static void cSystem_4b4CSsPS_sendMessage(HeavyContextInterface *, int, const HvMessage *);
-  static void cDelay_QLMdRIRC_sendMessage(HeavyContextInterface *, int, const HvMessage *);
-  static void cSwitchcase_xQdp3YLI_onMessage(HeavyContextInterface *, void *, int letIn, const HvMessage *const, void *);
-  static void cDelay_Jj5JoN3X_sendMessage(HeavyContextInterface *, int, const HvMessage *);
-  static void cMsg_R8N3OM8Z_sendMessage(HeavyContextInterface *, int, const HvMessage *);
-  static void cCast_P2zWlT8E_sendMessage(HeavyContextInterface *, int, const HvMessage *);
-  static void cSwitchcase_vt3e34wU_onMessage(HeavyContextInterface *, void *, int letIn, const HvMessage *const, void *);
-  static void cDelay_MT2IRF44_sendMessage(HeavyContextInterface *, int, const HvMessage *);
-  static void cMsg_v9CBBqPn_sendMessage(HeavyContextInterface *, int, const HvMessage *);
-  static void cCast_xQqze1C3_sendMessage(HeavyContextInterface *, int, const HvMessage *);
-  static void cSwitchcase_cL0RKMBM_onMessage(HeavyContextInterface *, void *, int letIn, const HvMessage *const, void *);
-  static void cDelay_kVeglpYz_sendMessage(HeavyContextInterface *, int, const HvMessage *);
-  static void cMsg_XHPdcOXe_sendMessage(HeavyContextInterface *, int, const HvMessage *);
-  static void cCast_PfH7zRUo_sendMessage(HeavyContextInterface *, int, const HvMessage *);
-  static void cSwitchcase_jGfys04F_onMessage(HeavyContextInterface *, void *, int letIn, const HvMessage *const, void *);
-  static void cDelay_HjgtvZoF_sendMessage(HeavyContextInterface *, int, const HvMessage *);
-  static void cMsg_Gwj9Okrj_sendMessage(HeavyContextInterface *, int, const HvMessage *);
-  static void cCast_DugDo7U9_sendMessage(HeavyContextInterface *, int, const HvMessage *);
-  static void cDelay_AQqKKBe7_sendMessage(HeavyContextInterface *, int, const HvMessage *);
-  static void cSwitchcase_A3E6anWI_onMessage(HeavyContextInterface *, void *, int letIn, const HvMessage *const, void *);
-  static void cCast_H1Xyhida_sendMessage(HeavyContextInterface *, int, const HvMessage *);
-  static void cIf_riRtEjEO_sendMessage(HeavyContextInterface *, int, const HvMessage *);
-  static void cMsg_Dv0gbeDu_sendMessage(HeavyContextInterface *, int, const HvMessage *);
-  static void cBinop_kWGjKN5n_sendMessage(HeavyContextInterface *, int, const HvMessage *);
-  static void cBinop_f5IHXl58_sendMessage(HeavyContextInterface *, int, const HvMessage *);
-  static void cCast_GnZxXwEh_sendMessage(HeavyContextInterface *, int, const HvMessage *);
-  static void cCast_XtWPeINd_sendMessage(HeavyContextInterface *, int, const HvMessage *);
-  static void cBinop_4fYWpMjF_sendMessage(HeavyContextInterface *, int, const HvMessage *);
-  static void cBinop_5r1OUzKN_sendMessage(HeavyContextInterface *, int, const HvMessage *);
-  static void cMsg_VRC3oFCN_sendMessage(HeavyContextInterface *, int, const HvMessage *);
-  static void cBinop_cyjUUiEB_sendMessage(HeavyContextInterface *, int, const HvMessage *);
-  static void cPack_X3O3xvTy_sendMessage(HeavyContextInterface *, int, const HvMessage *);
-  static void cBinop_jSR9zS7N_sendMessage(HeavyContextInterface *, int, const HvMessage *);
-  static void cMsg_UiZy1dIH_sendMessage(HeavyContextInterface *, int, const HvMessage *);
-  static void cBinop_NavqPfVK_sendMessage(HeavyContextInterface *, int, const HvMessage *);
-  static void cCast_9RZmugqL_sendMessage(HeavyContextInterface *, int, const HvMessage *);
-  static void cCast_4s3ICg4T_sendMessage(HeavyContextInterface *, int, const HvMessage *);
-  static void cMsg_373QxMWp_sendMessage(HeavyContextInterface *, int, const HvMessage *);
-  static void cMsg_z9hpzokD_sendMessage(HeavyContextInterface *, int, const HvMessage *);
-  static void cBinop_YopcEX5F_sendMessage(HeavyContextInterface *, int, const HvMessage *);
-  static void cMsg_Q4J8dJu7_sendMessage(HeavyContextInterface *, int, const HvMessage *);
-  static void cBinop_lyVu0twV_sendMessage(HeavyContextInterface *, int, const HvMessage *);
-  static void cCast_1ohY0MTH_sendMessage(HeavyContextInterface *, int, const HvMessage *);
-  static void cCast_K43UmDls_sendMessage(HeavyContextInterface *, int, const HvMessage *);
-  static void cMsg_LWirqX4o_sendMessage(HeavyContextInterface *, int, const HvMessage *);
-  static void cMsg_OA7ujY6d_sendMessage(HeavyContextInterface *, int, const HvMessage *);
-  static void cCast_6IqByR64_sendMessage(HeavyContextInterface *, int, const HvMessage *);
-  static void cCast_uYrKbzq4_sendMessage(HeavyContextInterface *, int, const HvMessage *);
-  static void cMsg_uoSqrOtK_sendMessage(HeavyContextInterface *, int, const HvMessage *);
-  static void cMsg_azNXhhOX_sendMessage(HeavyContextInterface *, int, const HvMessage *);
-  static void cBinop_7ecYajZQ_sendMessage(HeavyContextInterface *, int, const HvMessage *);
-  static void cMsg_nMKiO5o0_sendMessage(HeavyContextInterface *, int, const HvMessage *);
-  static void cBinop_aLAYvppH_sendMessage(HeavyContextInterface *, int, const HvMessage *);
-  static void cMsg_XEuGrYAQ_sendMessage(HeavyContextInterface *, int, const HvMessage *);
-  static void cCast_QPhwkePi_sendMessage(HeavyContextInterface *, int, const HvMessage *);
-  static void cCast_IHqc9FA0_sendMessage(HeavyContextInterface *, int, const HvMessage *);
-  static void cCast_RYsIbmpD_sendMessage(HeavyContextInterface *, int, const HvMessage *);
-  static void cCast_VznD72iG_sendMessage(HeavyContextInterface *, int, const HvMessage *);
-  static void cCast_0TVO4cyV_sendMessage(HeavyContextInterface *, int, const HvMessage *);
-  static void cCast_X8ntNJtD_sendMessage(HeavyContextInterface *, int, const HvMessage *);
-  static void cMsg_DpvC8iyV_sendMessage(HeavyContextInterface *, int, const HvMessage *);
-  static void cCast_dqXZ16ly_sendMessage(HeavyContextInterface *, int, const HvMessage *);
-  static void cCast_E9eETroy_sendMessage(HeavyContextInterface *, int, const HvMessage *);
-  static void cMsg_E21vn4iz_sendMessage(HeavyContextInterface *, int, const HvMessage *);
-  static void cMsg_3D0wbw8W_sendMessage(HeavyContextInterface *, int, const HvMessage *);
-  static void cMsg_8FLxmPX4_sendMessage(HeavyContextInterface *, int, const HvMessage *);
-  static void cBinop_RDIdQCKh_sendMessage(HeavyContextInterface *, int, const HvMessage *);
-  static void cBinop_dbIjZ05s_sendMessage(HeavyContextInterface *, int, const HvMessage *);
-  static void cMsg_mg7dkvqn_sendMessage(HeavyContextInterface *, int, const HvMessage *);
-  static void cBinop_OdnvGDMS_sendMessage(HeavyContextInterface *, int, const HvMessage *);
-  static void cBinop_Doptl4KB_sendMessage(HeavyContextInterface *, int, const HvMessage *);
-  static void cBinop_pF0VBlT7_sendMessage(HeavyContextInterface *, int, const HvMessage *);
-  static void cMsg_l00PrmVY_sendMessage(HeavyContextInterface *, int, const HvMessage *);
-  static void cMsg_1GrkztpU_sendMessage(HeavyContextInterface *, int, const HvMessage *);
-  static void cSlice_hv3mUgaW_sendMessage(HeavyContextInterface *, int, const HvMessage *);
-  static void cSlice_XWrWDCcW_sendMessage(HeavyContextInterface *, int, const HvMessage *);
-  static void cBinop_k1cslq56_sendMessage(HeavyContextInterface *, int, const HvMessage *);
-  static void cBinop_mFn54KU0_sendMessage(HeavyContextInterface *, int, const HvMessage *);
-  static void cBinop_nkoqLCHg_sendMessage(HeavyContextInterface *, int, const HvMessage *);
-  static void cBinop_c0i1xbS9_sendMessage(HeavyContextInterface *, int, const HvMessage *);
-  static void cMsg_vtdhWGdp_sendMessage(HeavyContextInterface *, int, const HvMessage *);
-  static void cSwitchcase_OuZLBvL4_onMessage(HeavyContextInterface *, void *, int letIn, const HvMessage *const, void *);
-  static void cDelay_6qAkbHP4_sendMessage(HeavyContextInterface *, int, const HvMessage *);
-  static void cMsg_BmsJaQFL_sendMessage(HeavyContextInterface *, int, const HvMessage *);
-  static void cCast_5Oo1MqXa_sendMessage(HeavyContextInterface *, int, const HvMessage *);
-  static void cPack_HKhQT7B9_sendMessage(HeavyContextInterface *, int, const HvMessage *);
-  static void cSlice_FwTqvMn2_sendMessage(HeavyContextInterface *, int, const HvMessage *);
-  static void cSlice_DcHse9W3_sendMessage(HeavyContextInterface *, int, const HvMessage *);
-  static void cVar_r5ixlHEt_sendMessage(HeavyContextInterface *, int, const HvMessage *);
-  static void cMsg_EZLaZJk9_sendMessage(HeavyContextInterface *, int, const HvMessage *);
-  static void cSystem_SMrHWdXB_sendMessage(HeavyContextInterface *, int, const HvMessage *);
-  static void cBinop_HqjECEs6_sendMessage(HeavyContextInterface *, int, const HvMessage *);
-  static void cBinop_3kpJHHGx_sendMessage(HeavyContextInterface *, int, const HvMessage *);
-  static void cMsg_pdB8k1j2_sendMessage(HeavyContextInterface *, int, const HvMessage *);
-  static void cBinop_zGb3Cnpa_sendMessage(HeavyContextInterface *, int, const HvMessage *);
-  static void cBinop_gcPqtQGi_sendMessage(HeavyContextInterface *, int, const HvMessage *);
-  static void cBinop_TzI3zrOK_sendMessage(HeavyContextInterface *, int, const HvMessage *);
-  static void cSwitchcase_VZIwLCKY_onMessage(HeavyContextInterface *, void *, int letIn, const HvMessage *const, void *);
-  static void cDelay_fsNbhAVw_sendMessage(HeavyContextInterface *, int, const HvMessage *);
-  static void cMsg_R6ucXJ9d_sendMessage(HeavyContextInterface *, int, const HvMessage *);
-  static void cCast_h1Kd5tf8_sendMessage(HeavyContextInterface *, int, const HvMessage *);
-  static void cPack_8rASSedI_sendMessage(HeavyContextInterface *, int, const HvMessage *);
-  static void cSlice_SQTrpvHR_sendMessage(HeavyContextInterface *, int, const HvMessage *);
-  static void cSlice_TEczJAdP_sendMessage(HeavyContextInterface *, int, const HvMessage *);
-  static void cVar_9G2w7qnP_sendMessage(HeavyContextInterface *, int, const HvMessage *);
-  static void cMsg_cGPaQMM6_sendMessage(HeavyContextInterface *, int, const HvMessage *);
-  static void cSystem_xxiMeu4W_sendMessage(HeavyContextInterface *, int, const HvMessage *);
-  static void cBinop_wtCPn2v7_sendMessage(HeavyContextInterface *, int, const HvMessage *);
-  static void cBinop_M3xbRzHZ_sendMessage(HeavyContextInterface *, int, const HvMessage *);
-  static void cMsg_EW0528j1_sendMessage(HeavyContextInterface *, int, const HvMessage *);
-  static void cBinop_WjxnTodE_sendMessage(HeavyContextInterface *, int, const HvMessage *);
-  static void cBinop_2gqweucP_sendMessage(HeavyContextInterface *, int, const HvMessage *);
-  static void cBinop_CVrmPTW2_sendMessage(HeavyContextInterface *, int, const HvMessage *);
-  static void cSwitchcase_7VmBeFDc_onMessage(HeavyContextInterface *, void *, int letIn, const HvMessage *const, void *);
-  static void cSlice_MO4iCVh1_sendMessage(HeavyContextInterface *, int, const HvMessage *);
-  static void cSlice_QuX5M4S2_sendMessage(HeavyContextInterface *, int, const HvMessage *);
-  static void cBinop_VbNqWaoC_sendMessage(HeavyContextInterface *, int, const HvMessage *);
-  static void cBinop_MGu6DZGz_sendMessage(HeavyContextInterface *, int, const HvMessage *);
-  static void cBinop_hsln8cTe_sendMessage(HeavyContextInterface *, int, const HvMessage *);
-  static void cBinop_YN6RyC3N_sendMessage(HeavyContextInterface *, int, const HvMessage *);
-  static void cMsg_mxr67C8l_sendMessage(HeavyContextInterface *, int, const HvMessage *);
-  static void cSwitchcase_ImYmO42I_onMessage(HeavyContextInterface *, void *, int letIn, const HvMessage *const, void *);
-  static void cCast_E6y5dwjY_sendMessage(HeavyContextInterface *, int, const HvMessage *);
-  static void cMsg_lYOaGMwk_sendMessage(HeavyContextInterface *, int, const HvMessage *);
-  static void cSystem_lKIgXgzR_sendMessage(HeavyContextInterface *, int, const HvMessage *);
-  static void cMsg_7KV6tt6Z_sendMessage(HeavyContextInterface *, int, const HvMessage *);
-  static void cSystem_9J223NWs_sendMessage(HeavyContextInterface *, int, const HvMessage *);
-  static void cDelay_VB784pvz_sendMessage(HeavyContextInterface *, int, const HvMessage *);
-  static void cSwitchcase_ydBi8MSl_onMessage(HeavyContextInterface *, void *, int letIn, const HvMessage *const, void *);
-  static void cDelay_BlyG4Dem_sendMessage(HeavyContextInterface *, int, const HvMessage *);
-  static void cMsg_RlSWCAcx_sendMessage(HeavyContextInterface *, int, const HvMessage *);
-  static void cCast_e3MU2AC0_sendMessage(HeavyContextInterface *, int, const HvMessage *);
-  static void cSwitchcase_1f79Z8tz_onMessage(HeavyContextInterface *, void *, int letIn, const HvMessage *const, void *);
-  static void cDelay_lesker1N_sendMessage(HeavyContextInterface *, int, const HvMessage *);
-  static void cMsg_VaYAOZMq_sendMessage(HeavyContextInterface *, int, const HvMessage *);
-  static void cCast_ieiXglU5_sendMessage(HeavyContextInterface *, int, const HvMessage *);
-  static void cSwitchcase_Y3RBjbcE_onMessage(HeavyContextInterface *, void *, int letIn, const HvMessage *const, void *);
-  static void cDelay_xS27Dv4p_sendMessage(HeavyContextInterface *, int, const HvMessage *);
-  static void cMsg_pXFlrQ1U_sendMessage(HeavyContextInterface *, int, const HvMessage *);
-  static void cCast_nfzHets3_sendMessage(HeavyContextInterface *, int, const HvMessage *);
-  static void cSwitchcase_GWKDlTzw_onMessage(HeavyContextInterface *, void *, int letIn, const HvMessage *const, void *);
-  static void cDelay_nlscGUxB_sendMessage(HeavyContextInterface *, int, const HvMessage *);
-  static void cMsg_fmDFusag_sendMessage(HeavyContextInterface *, int, const HvMessage *);
-  static void cCast_Hwx0FeG8_sendMessage(HeavyContextInterface *, int, const HvMessage *);
-  static void cDelay_8o62CkX0_sendMessage(HeavyContextInterface *, int, const HvMessage *);
-  static void cSwitchcase_FxIazoX8_onMessage(HeavyContextInterface *, void *, int letIn, const HvMessage *const, void *);
-  static void cCast_BW4KDBEE_sendMessage(HeavyContextInterface *, int, const HvMessage *);
-  static void cIf_eE0PJb50_sendMessage(HeavyContextInterface *, int, const HvMessage *);
-  static void cMsg_HydQQl0s_sendMessage(HeavyContextInterface *, int, const HvMessage *);
-  static void cBinop_dlGEIEnH_sendMessage(HeavyContextInterface *, int, const HvMessage *);
-  static void cBinop_JIbo3cDI_sendMessage(HeavyContextInterface *, int, const HvMessage *);
-  static void cCast_9YBnlLR5_sendMessage(HeavyContextInterface *, int, const HvMessage *);
-  static void cCast_G02Qw2wI_sendMessage(HeavyContextInterface *, int, const HvMessage *);
-  static void cBinop_pCXsFq1U_sendMessage(HeavyContextInterface *, int, const HvMessage *);
-  static void cBinop_3P1RBOib_sendMessage(HeavyContextInterface *, int, const HvMessage *);
-  static void cMsg_J7V6QIXZ_sendMessage(HeavyContextInterface *, int, const HvMessage *);
-  static void cBinop_qdM3r4g0_sendMessage(HeavyContextInterface *, int, const HvMessage *);
-  static void cPack_ydX1v6ep_sendMessage(HeavyContextInterface *, int, const HvMessage *);
-  static void cBinop_7zgCesuw_sendMessage(HeavyContextInterface *, int, const HvMessage *);
-  static void cMsg_AjbwGNok_sendMessage(HeavyContextInterface *, int, const HvMessage *);
-  static void cBinop_xCpzb0GP_sendMessage(HeavyContextInterface *, int, const HvMessage *);
-  static void cCast_ESX30QvR_sendMessage(HeavyContextInterface *, int, const HvMessage *);
-  static void cCast_IkUEaZ1v_sendMessage(HeavyContextInterface *, int, const HvMessage *);
-  static void cMsg_z7tFHTdk_sendMessage(HeavyContextInterface *, int, const HvMessage *);
-  static void cMsg_fbZMtyOu_sendMessage(HeavyContextInterface *, int, const HvMessage *);
-  static void cBinop_6hJ2N7Mg_sendMessage(HeavyContextInterface *, int, const HvMessage *);
-  static void cMsg_fY1gA9w2_sendMessage(HeavyContextInterface *, int, const HvMessage *);
-  static void cBinop_av6hA3La_sendMessage(HeavyContextInterface *, int, const HvMessage *);
-  static void cCast_zQBVGHM3_sendMessage(HeavyContextInterface *, int, const HvMessage *);
-  static void cCast_0ZfNJd7D_sendMessage(HeavyContextInterface *, int, const HvMessage *);
-  static void cMsg_uwlYxoQz_sendMessage(HeavyContextInterface *, int, const HvMessage *);
-  static void cMsg_C0QJdxdQ_sendMessage(HeavyContextInterface *, int, const HvMessage *);
-  static void cCast_wUSD8D2p_sendMessage(HeavyContextInterface *, int, const HvMessage *);
-  static void cCast_6BTUuGXc_sendMessage(HeavyContextInterface *, int, const HvMessage *);
-  static void cMsg_qI4eBhFz_sendMessage(HeavyContextInterface *, int, const HvMessage *);
-  static void cMsg_9gEcXN0Q_sendMessage(HeavyContextInterface *, int, const HvMessage *);
-  static void cBinop_doxG9FU3_sendMessage(HeavyContextInterface *, int, const HvMessage *);
-  static void cMsg_Cb6tqB6O_sendMessage(HeavyContextInterface *, int, const HvMessage *);
-  static void cBinop_E8SMKbju_sendMessage(HeavyContextInterface *, int, const HvMessage *);
-  static void cMsg_mQMFYsBj_sendMessage(HeavyContextInterface *, int, const HvMessage *);
-  static void cCast_HUgTLaW8_sendMessage(HeavyContextInterface *, int, const HvMessage *);
-  static void cCast_tOlKdVU3_sendMessage(HeavyContextInterface *, int, const HvMessage *);
-  static void cCast_DuodSYz6_sendMessage(HeavyContextInterface *, int, const HvMessage *);
-  static void cCast_C2nbcAxp_sendMessage(HeavyContextInterface *, int, const HvMessage *);
-  static void cCast_W6tBOTnb_sendMessage(HeavyContextInterface *, int, const HvMessage *);
-  static void cCast_dh3TAdGP_sendMessage(HeavyContextInterface *, int, const HvMessage *);
-  static void cMsg_u3kusKbw_sendMessage(HeavyContextInterface *, int, const HvMessage *);
-  static void cCast_kveJf1Sf_sendMessage(HeavyContextInterface *, int, const HvMessage *);
-  static void cCast_Zxo46jA0_sendMessage(HeavyContextInterface *, int, const HvMessage *);
-  static void cMsg_GPvBkq5J_sendMessage(HeavyContextInterface *, int, const HvMessage *);
-  static void cMsg_yNYaSFdF_sendMessage(HeavyContextInterface *, int, const HvMessage *);
-  static void cMsg_f84WaAVS_sendMessage(HeavyContextInterface *, int, const HvMessage *);
-  static void cBinop_03KuiZFi_sendMessage(HeavyContextInterface *, int, const HvMessage *);
-  static void cBinop_m6xlByYI_sendMessage(HeavyContextInterface *, int, const HvMessage *);
-  static void cMsg_cymXe6mx_sendMessage(HeavyContextInterface *, int, const HvMessage *);
-  static void cBinop_1qw1bhOJ_sendMessage(HeavyContextInterface *, int, const HvMessage *);
-  static void cBinop_PxyOdmoJ_sendMessage(HeavyContextInterface *, int, const HvMessage *);
-  static void cBinop_xVrj7M6A_sendMessage(HeavyContextInterface *, int, const HvMessage *);
-  static void cMsg_4c8BwGsk_sendMessage(HeavyContextInterface *, int, const HvMessage *);
-  static void cMsg_QBtHS11y_sendMessage(HeavyContextInterface *, int, const HvMessage *);
-  static void cSlice_jBZVqRID_sendMessage(HeavyContextInterface *, int, const HvMessage *);
-  static void cSlice_ZxsAnMyr_sendMessage(HeavyContextInterface *, int, const HvMessage *);
-  static void cBinop_8D0zCOwK_sendMessage(HeavyContextInterface *, int, const HvMessage *);
-  static void cBinop_BFi55qXh_sendMessage(HeavyContextInterface *, int, const HvMessage *);
-  static void cBinop_a8Dmzxhi_sendMessage(HeavyContextInterface *, int, const HvMessage *);
-  static void cBinop_0zmZNoDQ_sendMessage(HeavyContextInterface *, int, const HvMessage *);
-  static void cMsg_BKXRP7SB_sendMessage(HeavyContextInterface *, int, const HvMessage *);
-  static void cSwitchcase_0tNZuopx_onMessage(HeavyContextInterface *, void *, int letIn, const HvMessage *const, void *);
-  static void cDelay_boef1Edm_sendMessage(HeavyContextInterface *, int, const HvMessage *);
-  static void cMsg_b3dOoUE9_sendMessage(HeavyContextInterface *, int, const HvMessage *);
-  static void cCast_sQrbAz25_sendMessage(HeavyContextInterface *, int, const HvMessage *);
-  static void cPack_PKdgj686_sendMessage(HeavyContextInterface *, int, const HvMessage *);
-  static void cSlice_ZYqqPMEU_sendMessage(HeavyContextInterface *, int, const HvMessage *);
-  static void cSlice_9r5FvGx8_sendMessage(HeavyContextInterface *, int, const HvMessage *);
-  static void cVar_43FOqtBR_sendMessage(HeavyContextInterface *, int, const HvMessage *);
-  static void cMsg_0b6oTzRv_sendMessage(HeavyContextInterface *, int, const HvMessage *);
-  static void cSystem_TfDHTZTQ_sendMessage(HeavyContextInterface *, int, const HvMessage *);
-  static void cBinop_sG7uKtCn_sendMessage(HeavyContextInterface *, int, const HvMessage *);
-  static void cBinop_idtx5U4Z_sendMessage(HeavyContextInterface *, int, const HvMessage *);
-  static void cMsg_ZPbTlDVC_sendMessage(HeavyContextInterface *, int, const HvMessage *);
-  static void cBinop_4484JP4i_sendMessage(HeavyContextInterface *, int, const HvMessage *);
-  static void cBinop_VS2moOM6_sendMessage(HeavyContextInterface *, int, const HvMessage *);
-  static void cBinop_uoPduPOh_sendMessage(HeavyContextInterface *, int, const HvMessage *);
-  static void cSwitchcase_dasMg2O8_onMessage(HeavyContextInterface *, void *, int letIn, const HvMessage *const, void *);
-  static void cDelay_0g9RNRzd_sendMessage(HeavyContextInterface *, int, const HvMessage *);
-  static void cMsg_CFDXVYei_sendMessage(HeavyContextInterface *, int, const HvMessage *);
-  static void cCast_khXLU10O_sendMessage(HeavyContextInterface *, int, const HvMessage *);
-  static void cPack_zvNQLNNm_sendMessage(HeavyContextInterface *, int, const HvMessage *);
-  static void cSlice_OT28k0wW_sendMessage(HeavyContextInterface *, int, const HvMessage *);
-  static void cSlice_dX9iIu2e_sendMessage(HeavyContextInterface *, int, const HvMessage *);
-  static void cVar_PQrhAZRa_sendMessage(HeavyContextInterface *, int, const HvMessage *);
-  static void cMsg_pkFtiTnu_sendMessage(HeavyContextInterface *, int, const HvMessage *);
-  static void cSystem_LEccOHgH_sendMessage(HeavyContextInterface *, int, const HvMessage *);
-  static void cBinop_oqqJ1Paq_sendMessage(HeavyContextInterface *, int, const HvMessage *);
-  static void cBinop_nbWNwOai_sendMessage(HeavyContextInterface *, int, const HvMessage *);
-  static void cMsg_Dhca3X8S_sendMessage(HeavyContextInterface *, int, const HvMessage *);
-  static void cBinop_7hb1OHvN_sendMessage(HeavyContextInterface *, int, const HvMessage *);
-  static void cBinop_gspRXxvt_sendMessage(HeavyContextInterface *, int, const HvMessage *);
-  static void cBinop_Yp2K2bFn_sendMessage(HeavyContextInterface *, int, const HvMessage *);
-  static void cSwitchcase_HLr2sT4G_onMessage(HeavyContextInterface *, void *, int letIn, const HvMessage *const, void *);
-  static void cSlice_yX2gZFzd_sendMessage(HeavyContextInterface *, int, const HvMessage *);
-  static void cSlice_WyVXq3I4_sendMessage(HeavyContextInterface *, int, const HvMessage *);
-  static void cBinop_qSBIWrss_sendMessage(HeavyContextInterface *, int, const HvMessage *);
-  static void cBinop_H0Q3gbjl_sendMessage(HeavyContextInterface *, int, const HvMessage *);
-  static void cBinop_UOds2bwZ_sendMessage(HeavyContextInterface *, int, const HvMessage *);
-  static void cBinop_4gLdkR2v_sendMessage(HeavyContextInterface *, int, const HvMessage *);
-  static void cMsg_LavURYtr_sendMessage(HeavyContextInterface *, int, const HvMessage *);
-  static void cSwitchcase_CRShH4uR_onMessage(HeavyContextInterface *, void *, int letIn, const HvMessage *const, void *);
-  static void cCast_MBcjL5vu_sendMessage(HeavyContextInterface *, int, const HvMessage *);
-  static void cMsg_ug9sv1mV_sendMessage(HeavyContextInterface *, int, const HvMessage *);
-  static void cSystem_OegaO66V_sendMessage(HeavyContextInterface *, int, const HvMessage *);
-  static void cMsg_37gYBrZv_sendMessage(HeavyContextInterface *, int, const HvMessage *);
-  static void cSystem_54HbbWEF_sendMessage(HeavyContextInterface *, int, const HvMessage *);
-  static void cDelay_ouiGSpqr_sendMessage(HeavyContextInterface *, int, const HvMessage *);
-  static void cSwitchcase_2pQzutyz_onMessage(HeavyContextInterface *, void *, int letIn, const HvMessage *const, void *);
-  static void cDelay_QwttMs34_sendMessage(HeavyContextInterface *, int, const HvMessage *);
-  static void cMsg_7dURQOkB_sendMessage(HeavyContextInterface *, int, const HvMessage *);
-  static void cCast_fiLSD1a8_sendMessage(HeavyContextInterface *, int, const HvMessage *);
-  static void cSwitchcase_1WQogOMx_onMessage(HeavyContextInterface *, void *, int letIn, const HvMessage *const, void *);
-  static void cDelay_ynpjLAAq_sendMessage(HeavyContextInterface *, int, const HvMessage *);
-  static void cMsg_2mrdE5XU_sendMessage(HeavyContextInterface *, int, const HvMessage *);
-  static void cCast_hfPWaCT9_sendMessage(HeavyContextInterface *, int, const HvMessage *);
-  static void cSwitchcase_YNEcloRv_onMessage(HeavyContextInterface *, void *, int letIn, const HvMessage *const, void *);
-  static void cDelay_8zQ9g5kN_sendMessage(HeavyContextInterface *, int, const HvMessage *);
-  static void cMsg_0kE9k5nr_sendMessage(HeavyContextInterface *, int, const HvMessage *);
-  static void cCast_WFxvrVBl_sendMessage(HeavyContextInterface *, int, const HvMessage *);
-  static void cSwitchcase_iKdqEjv6_onMessage(HeavyContextInterface *, void *, int letIn, const HvMessage *const, void *);
-  static void cDelay_S4kddO82_sendMessage(HeavyContextInterface *, int, const HvMessage *);
-  static void cMsg_CMzciL5O_sendMessage(HeavyContextInterface *, int, const HvMessage *);
-  static void cCast_eF1E20Al_sendMessage(HeavyContextInterface *, int, const HvMessage *);
-  static void cDelay_IMZb3bj3_sendMessage(HeavyContextInterface *, int, const HvMessage *);
-  static void cSwitchcase_wLEk9jUQ_onMessage(HeavyContextInterface *, void *, int letIn, const HvMessage *const, void *);
-  static void cCast_qeF9BmG7_sendMessage(HeavyContextInterface *, int, const HvMessage *);
-  static void cIf_ZTxZJeNg_sendMessage(HeavyContextInterface *, int, const HvMessage *);
-  static void cMsg_Mypfyhhi_sendMessage(HeavyContextInterface *, int, const HvMessage *);
-  static void cBinop_WofbqBHk_sendMessage(HeavyContextInterface *, int, const HvMessage *);
-  static void cBinop_TBS1MzlW_sendMessage(HeavyContextInterface *, int, const HvMessage *);
-  static void cCast_9yzE6rZl_sendMessage(HeavyContextInterface *, int, const HvMessage *);
-  static void cCast_KjmrJTfq_sendMessage(HeavyContextInterface *, int, const HvMessage *);
-  static void cBinop_H2yxUgdZ_sendMessage(HeavyContextInterface *, int, const HvMessage *);
-  static void cBinop_93XUb6ci_sendMessage(HeavyContextInterface *, int, const HvMessage *);
-  static void cMsg_WxyRATiB_sendMessage(HeavyContextInterface *, int, const HvMessage *);
-  static void cBinop_ByESvDhb_sendMessage(HeavyContextInterface *, int, const HvMessage *);
-  static void cPack_Q2kgvi4X_sendMessage(HeavyContextInterface *, int, const HvMessage *);
-  static void cBinop_TwOQys3E_sendMessage(HeavyContextInterface *, int, const HvMessage *);
-  static void cMsg_KH2G7xkh_sendMessage(HeavyContextInterface *, int, const HvMessage *);
-  static void cBinop_xWe7L4zj_sendMessage(HeavyContextInterface *, int, const HvMessage *);
-  static void cCast_zcQvtdXn_sendMessage(HeavyContextInterface *, int, const HvMessage *);
-  static void cCast_jyic7ZqL_sendMessage(HeavyContextInterface *, int, const HvMessage *);
-  static void cMsg_mTgLwddF_sendMessage(HeavyContextInterface *, int, const HvMessage *);
-  static void cMsg_emIZO9r0_sendMessage(HeavyContextInterface *, int, const HvMessage *);
-  static void cBinop_Z6h5tmz3_sendMessage(HeavyContextInterface *, int, const HvMessage *);
-  static void cMsg_wSRNQSnT_sendMessage(HeavyContextInterface *, int, const HvMessage *);
-  static void cBinop_K7pbLD1Z_sendMessage(HeavyContextInterface *, int, const HvMessage *);
-  static void cCast_rnEOSonc_sendMessage(HeavyContextInterface *, int, const HvMessage *);
-  static void cCast_K0gOKmNO_sendMessage(HeavyContextInterface *, int, const HvMessage *);
-  static void cMsg_qUsjHa38_sendMessage(HeavyContextInterface *, int, const HvMessage *);
-  static void cMsg_Hibi7sqo_sendMessage(HeavyContextInterface *, int, const HvMessage *);
-  static void cCast_3knme7ox_sendMessage(HeavyContextInterface *, int, const HvMessage *);
-  static void cCast_UqHlaIWS_sendMessage(HeavyContextInterface *, int, const HvMessage *);
-  static void cMsg_dhWXbkCm_sendMessage(HeavyContextInterface *, int, const HvMessage *);
-  static void cMsg_zf9NWU2Y_sendMessage(HeavyContextInterface *, int, const HvMessage *);
-  static void cBinop_OTHnCVRL_sendMessage(HeavyContextInterface *, int, const HvMessage *);
-  static void cMsg_n6bwrVpU_sendMessage(HeavyContextInterface *, int, const HvMessage *);
-  static void cBinop_8hrzCrt9_sendMessage(HeavyContextInterface *, int, const HvMessage *);
-  static void cMsg_HXadA5UE_sendMessage(HeavyContextInterface *, int, const HvMessage *);
-  static void cCast_j8PzT9ic_sendMessage(HeavyContextInterface *, int, const HvMessage *);
-  static void cCast_Z4yPnLuA_sendMessage(HeavyContextInterface *, int, const HvMessage *);
-  static void cCast_IGOP15ec_sendMessage(HeavyContextInterface *, int, const HvMessage *);
-  static void cCast_3wJNYSfn_sendMessage(HeavyContextInterface *, int, const HvMessage *);
-  static void cCast_bKX7cNBW_sendMessage(HeavyContextInterface *, int, const HvMessage *);
-  static void cCast_joBtXzWK_sendMessage(HeavyContextInterface *, int, const HvMessage *);
-  static void cMsg_v5xOJFu4_sendMessage(HeavyContextInterface *, int, const HvMessage *);
-  static void cCast_FxwX0WGF_sendMessage(HeavyContextInterface *, int, const HvMessage *);
-  static void cCast_C864gYhG_sendMessage(HeavyContextInterface *, int, const HvMessage *);
-  static void cMsg_WTUX3k30_sendMessage(HeavyContextInterface *, int, const HvMessage *);
-  static void cMsg_9h8G172A_sendMessage(HeavyContextInterface *, int, const HvMessage *);
-  static void cMsg_HK3wrSdz_sendMessage(HeavyContextInterface *, int, const HvMessage *);
-  static void cBinop_ahqchjeT_sendMessage(HeavyContextInterface *, int, const HvMessage *);
-  static void cBinop_SS75KJNe_sendMessage(HeavyContextInterface *, int, const HvMessage *);
-  static void cMsg_fvqvkU8j_sendMessage(HeavyContextInterface *, int, const HvMessage *);
-  static void cBinop_BpYFlK4l_sendMessage(HeavyContextInterface *, int, const HvMessage *);
-  static void cBinop_YiTSNoeT_sendMessage(HeavyContextInterface *, int, const HvMessage *);
-  static void cBinop_FueLORJu_sendMessage(HeavyContextInterface *, int, const HvMessage *);
-  static void cMsg_rjuAtuSd_sendMessage(HeavyContextInterface *, int, const HvMessage *);
-  static void cMsg_fEdoPEOS_sendMessage(HeavyContextInterface *, int, const HvMessage *);
-  static void cSlice_YdkTn2WL_sendMessage(HeavyContextInterface *, int, const HvMessage *);
-  static void cSlice_IDtSoCz3_sendMessage(HeavyContextInterface *, int, const HvMessage *);
-  static void cBinop_MCRwxge6_sendMessage(HeavyContextInterface *, int, const HvMessage *);
-  static void cBinop_yeO0TBWK_sendMessage(HeavyContextInterface *, int, const HvMessage *);
-  static void cBinop_QFXcKD54_sendMessage(HeavyContextInterface *, int, const HvMessage *);
-  static void cBinop_uWnhLLWD_sendMessage(HeavyContextInterface *, int, const HvMessage *);
-  static void cMsg_UvKpFABm_sendMessage(HeavyContextInterface *, int, const HvMessage *);
-  static void cSwitchcase_ezgzLcgn_onMessage(HeavyContextInterface *, void *, int letIn, const HvMessage *const, void *);
-  static void cDelay_LNwKVA6h_sendMessage(HeavyContextInterface *, int, const HvMessage *);
-  static void cMsg_p9jyzeym_sendMessage(HeavyContextInterface *, int, const HvMessage *);
-  static void cCast_XvGm9o4Q_sendMessage(HeavyContextInterface *, int, const HvMessage *);
-  static void cPack_TPCSHBXT_sendMessage(HeavyContextInterface *, int, const HvMessage *);
-  static void cSlice_uN0zKAiB_sendMessage(HeavyContextInterface *, int, const HvMessage *);
-  static void cSlice_gNyzsSj0_sendMessage(HeavyContextInterface *, int, const HvMessage *);
-  static void cVar_mrGWo2hl_sendMessage(HeavyContextInterface *, int, const HvMessage *);
-  static void cMsg_0KIBKjcE_sendMessage(HeavyContextInterface *, int, const HvMessage *);
-  static void cSystem_WSf7WIv4_sendMessage(HeavyContextInterface *, int, const HvMessage *);
-  static void cBinop_6kvx4MW1_sendMessage(HeavyContextInterface *, int, const HvMessage *);
-  static void cBinop_G67N2Obe_sendMessage(HeavyContextInterface *, int, const HvMessage *);
-  static void cMsg_JtowgWnI_sendMessage(HeavyContextInterface *, int, const HvMessage *);
-  static void cBinop_yF8yz2t1_sendMessage(HeavyContextInterface *, int, const HvMessage *);
-  static void cBinop_tAnpPZo8_sendMessage(HeavyContextInterface *, int, const HvMessage *);
-  static void cBinop_SRfrcYXZ_sendMessage(HeavyContextInterface *, int, const HvMessage *);
-  static void cSwitchcase_UtrhqNBS_onMessage(HeavyContextInterface *, void *, int letIn, const HvMessage *const, void *);
-  static void cDelay_8ZZIXXPz_sendMessage(HeavyContextInterface *, int, const HvMessage *);
-  static void cMsg_4RKAbsEh_sendMessage(HeavyContextInterface *, int, const HvMessage *);
-  static void cCast_GWLDX8FC_sendMessage(HeavyContextInterface *, int, const HvMessage *);
-  static void cPack_5500f4rS_sendMessage(HeavyContextInterface *, int, const HvMessage *);
-  static void cSlice_V7WIm3dA_sendMessage(HeavyContextInterface *, int, const HvMessage *);
-  static void cSlice_NBtNQH70_sendMessage(HeavyContextInterface *, int, const HvMessage *);
-  static void cVar_2nrwCzMG_sendMessage(HeavyContextInterface *, int, const HvMessage *);
-  static void cMsg_lBdzS1y9_sendMessage(HeavyContextInterface *, int, const HvMessage *);
-  static void cSystem_PcD9gYPr_sendMessage(HeavyContextInterface *, int, const HvMessage *);
-  static void cBinop_laWCPJWj_sendMessage(HeavyContextInterface *, int, const HvMessage *);
-  static void cBinop_XRHl9hCk_sendMessage(HeavyContextInterface *, int, const HvMessage *);
-  static void cMsg_6bndNwzZ_sendMessage(HeavyContextInterface *, int, const HvMessage *);
-  static void cBinop_FxqAL3Iz_sendMessage(HeavyContextInterface *, int, const HvMessage *);
-  static void cBinop_uRKPU5nd_sendMessage(HeavyContextInterface *, int, const HvMessage *);
-  static void cBinop_QCh9dt7w_sendMessage(HeavyContextInterface *, int, const HvMessage *);
-  static void cSwitchcase_KfKBNZ1L_onMessage(HeavyContextInterface *, void *, int letIn, const HvMessage *const, void *);
-  static void cSlice_QjjpI8v1_sendMessage(HeavyContextInterface *, int, const HvMessage *);
-  static void cSlice_mq0IVuSG_sendMessage(HeavyContextInterface *, int, const HvMessage *);
-  static void cBinop_6TnJ4LDS_sendMessage(HeavyContextInterface *, int, const HvMessage *);
-  static void cBinop_KuuB7P1e_sendMessage(HeavyContextInterface *, int, const HvMessage *);
-  static void cBinop_WcuevvmP_sendMessage(HeavyContextInterface *, int, const HvMessage *);
-  static void cBinop_yktdhsb8_sendMessage(HeavyContextInterface *, int, const HvMessage *);
-  static void cMsg_ZKM96kn2_sendMessage(HeavyContextInterface *, int, const HvMessage *);
-  static void cSwitchcase_lLPhmlID_onMessage(HeavyContextInterface *, void *, int letIn, const HvMessage *const, void *);
-  static void cCast_zvQI1Kd2_sendMessage(HeavyContextInterface *, int, const HvMessage *);
-  static void cMsg_duSEFOQ2_sendMessage(HeavyContextInterface *, int, const HvMessage *);
-  static void cSystem_oxVnMnXG_sendMessage(HeavyContextInterface *, int, const HvMessage *);
-  static void cMsg_OmjfJHO2_sendMessage(HeavyContextInterface *, int, const HvMessage *);
-  static void cSystem_LLUvzUDy_sendMessage(HeavyContextInterface *, int, const HvMessage *);
-  static void cDelay_FpA49BkW_sendMessage(HeavyContextInterface *, int, const HvMessage *);
-  static void cSwitchcase_bZfJUN9p_onMessage(HeavyContextInterface *, void *, int letIn, const HvMessage *const, void *);
-  static void cDelay_Ksc6L6s1_sendMessage(HeavyContextInterface *, int, const HvMessage *);
-  static void cMsg_55yu4tIW_sendMessage(HeavyContextInterface *, int, const HvMessage *);
-  static void cCast_tFC7OPru_sendMessage(HeavyContextInterface *, int, const HvMessage *);
-  static void cSwitchcase_JhOu3BlT_onMessage(HeavyContextInterface *, void *, int letIn, const HvMessage *const, void *);
-  static void cDelay_HD4QVfFN_sendMessage(HeavyContextInterface *, int, const HvMessage *);
-  static void cMsg_6nW5oczT_sendMessage(HeavyContextInterface *, int, const HvMessage *);
-  static void cCast_c2rXE83Z_sendMessage(HeavyContextInterface *, int, const HvMessage *);
-  static void cSwitchcase_pkwO6v0F_onMessage(HeavyContextInterface *, void *, int letIn, const HvMessage *const, void *);
-  static void cDelay_kEuwEux7_sendMessage(HeavyContextInterface *, int, const HvMessage *);
-  static void cMsg_pKlDVOMZ_sendMessage(HeavyContextInterface *, int, const HvMessage *);
-  static void cCast_WhqT1RWV_sendMessage(HeavyContextInterface *, int, const HvMessage *);
-  static void cSwitchcase_lv6hvuVN_onMessage(HeavyContextInterface *, void *, int letIn, const HvMessage *const, void *);
-  static void cDelay_v6eu2VXR_sendMessage(HeavyContextInterface *, int, const HvMessage *);
-  static void cMsg_MYsZWUB0_sendMessage(HeavyContextInterface *, int, const HvMessage *);
-  static void cCast_q57F9a4k_sendMessage(HeavyContextInterface *, int, const HvMessage *);
-  static void cDelay_kJiO8EHE_sendMessage(HeavyContextInterface *, int, const HvMessage *);
-  static void cSwitchcase_KhWvkQGW_onMessage(HeavyContextInterface *, void *, int letIn, const HvMessage *const, void *);
-  static void cCast_QzeuJzkP_sendMessage(HeavyContextInterface *, int, const HvMessage *);
-  static void cIf_CxGKJWrF_sendMessage(HeavyContextInterface *, int, const HvMessage *);
-  static void cMsg_67CDvPpH_sendMessage(HeavyContextInterface *, int, const HvMessage *);
-  static void cBinop_gRP0w6t1_sendMessage(HeavyContextInterface *, int, const HvMessage *);
-  static void cBinop_6957mrj0_sendMessage(HeavyContextInterface *, int, const HvMessage *);
-  static void cCast_PasVdEIu_sendMessage(HeavyContextInterface *, int, const HvMessage *);
-  static void cCast_wuAUZWeX_sendMessage(HeavyContextInterface *, int, const HvMessage *);
-  static void cBinop_ygZpnClk_sendMessage(HeavyContextInterface *, int, const HvMessage *);
-  static void cBinop_7R1BuOcK_sendMessage(HeavyContextInterface *, int, const HvMessage *);
-  static void cMsg_KCdLhw9p_sendMessage(HeavyContextInterface *, int, const HvMessage *);
-  static void cBinop_guqgmXzk_sendMessage(HeavyContextInterface *, int, const HvMessage *);
-  static void cPack_IAED51KK_sendMessage(HeavyContextInterface *, int, const HvMessage *);
-  static void cBinop_SeoxEpEW_sendMessage(HeavyContextInterface *, int, const HvMessage *);
-  static void cMsg_ESSsls21_sendMessage(HeavyContextInterface *, int, const HvMessage *);
-  static void cBinop_cqeoyNml_sendMessage(HeavyContextInterface *, int, const HvMessage *);
-  static void cCast_FuyajRsH_sendMessage(HeavyContextInterface *, int, const HvMessage *);
-  static void cCast_LvJ2wEk3_sendMessage(HeavyContextInterface *, int, const HvMessage *);
-  static void cMsg_dEhJmgRF_sendMessage(HeavyContextInterface *, int, const HvMessage *);
-  static void cMsg_yP4v5nNM_sendMessage(HeavyContextInterface *, int, const HvMessage *);
-  static void cBinop_j1bGLY45_sendMessage(HeavyContextInterface *, int, const HvMessage *);
-  static void cMsg_12eibmLg_sendMessage(HeavyContextInterface *, int, const HvMessage *);
-  static void cBinop_4QbhXBqM_sendMessage(HeavyContextInterface *, int, const HvMessage *);
-  static void cCast_0bQ3YrqF_sendMessage(HeavyContextInterface *, int, const HvMessage *);
-  static void cCast_ARxFbiyZ_sendMessage(HeavyContextInterface *, int, const HvMessage *);
-  static void cMsg_pgQvI5cl_sendMessage(HeavyContextInterface *, int, const HvMessage *);
-  static void cMsg_mvBWrNAc_sendMessage(HeavyContextInterface *, int, const HvMessage *);
-  static void cCast_tAN8PWzQ_sendMessage(HeavyContextInterface *, int, const HvMessage *);
-  static void cCast_qfXDYMic_sendMessage(HeavyContextInterface *, int, const HvMessage *);
-  static void cMsg_epTObcqo_sendMessage(HeavyContextInterface *, int, const HvMessage *);
-  static void cMsg_maDapn8d_sendMessage(HeavyContextInterface *, int, const HvMessage *);
-  static void cBinop_LxB78UXU_sendMessage(HeavyContextInterface *, int, const HvMessage *);
-  static void cMsg_U1WUhvfv_sendMessage(HeavyContextInterface *, int, const HvMessage *);
-  static void cBinop_0lbLqOnp_sendMessage(HeavyContextInterface *, int, const HvMessage *);
-  static void cMsg_pCDxJ11J_sendMessage(HeavyContextInterface *, int, const HvMessage *);
-  static void cCast_C70yAhkD_sendMessage(HeavyContextInterface *, int, const HvMessage *);
-  static void cCast_ri54zFOR_sendMessage(HeavyContextInterface *, int, const HvMessage *);
-  static void cCast_seJyTUwT_sendMessage(HeavyContextInterface *, int, const HvMessage *);
-  static void cCast_ZD7HSBiV_sendMessage(HeavyContextInterface *, int, const HvMessage *);
-  static void cCast_tqTUMqUi_sendMessage(HeavyContextInterface *, int, const HvMessage *);
-  static void cCast_fQhFLMED_sendMessage(HeavyContextInterface *, int, const HvMessage *);
-  static void cMsg_589toPCL_sendMessage(HeavyContextInterface *, int, const HvMessage *);
-  static void cCast_0panBpL9_sendMessage(HeavyContextInterface *, int, const HvMessage *);
-  static void cCast_fvV9VMDq_sendMessage(HeavyContextInterface *, int, const HvMessage *);
-  static void cMsg_pbeOxslE_sendMessage(HeavyContextInterface *, int, const HvMessage *);
-  static void cMsg_rY9qYCDT_sendMessage(HeavyContextInterface *, int, const HvMessage *);
-  static void cMsg_U9KDZkV1_sendMessage(HeavyContextInterface *, int, const HvMessage *);
-  static void cBinop_DujDieyG_sendMessage(HeavyContextInterface *, int, const HvMessage *);
-  static void cBinop_uW0B7FY8_sendMessage(HeavyContextInterface *, int, const HvMessage *);
-  static void cMsg_pvvvyjWZ_sendMessage(HeavyContextInterface *, int, const HvMessage *);
-  static void cBinop_7grpLFXN_sendMessage(HeavyContextInterface *, int, const HvMessage *);
-  static void cBinop_aCHgNo2I_sendMessage(HeavyContextInterface *, int, const HvMessage *);
-  static void cBinop_XRrhABpI_sendMessage(HeavyContextInterface *, int, const HvMessage *);
-  static void cMsg_R67BfFZp_sendMessage(HeavyContextInterface *, int, const HvMessage *);
-  static void cMsg_W8jdGFW5_sendMessage(HeavyContextInterface *, int, const HvMessage *);
-  static void cSlice_DP57ivEA_sendMessage(HeavyContextInterface *, int, const HvMessage *);
-  static void cSlice_Jed3KeQW_sendMessage(HeavyContextInterface *, int, const HvMessage *);
-  static void cBinop_XWJ2Jqvu_sendMessage(HeavyContextInterface *, int, const HvMessage *);
-  static void cBinop_1OXqZ6Bg_sendMessage(HeavyContextInterface *, int, const HvMessage *);
-  static void cBinop_L6DcXzbK_sendMessage(HeavyContextInterface *, int, const HvMessage *);
-  static void cBinop_nhMYm0st_sendMessage(HeavyContextInterface *, int, const HvMessage *);
-  static void cMsg_rNIiSd33_sendMessage(HeavyContextInterface *, int, const HvMessage *);
-  static void cSwitchcase_MLt0O8yg_onMessage(HeavyContextInterface *, void *, int letIn, const HvMessage *const, void *);
-  static void cDelay_n7LU68W4_sendMessage(HeavyContextInterface *, int, const HvMessage *);
-  static void cMsg_EiR4r4A2_sendMessage(HeavyContextInterface *, int, const HvMessage *);
-  static void cCast_0UPpbu1i_sendMessage(HeavyContextInterface *, int, const HvMessage *);
-  static void cPack_Ty4AZCCD_sendMessage(HeavyContextInterface *, int, const HvMessage *);
-  static void cSlice_eySO46yn_sendMessage(HeavyContextInterface *, int, const HvMessage *);
-  static void cSlice_KnxapYvS_sendMessage(HeavyContextInterface *, int, const HvMessage *);
-  static void cVar_JD9szZbV_sendMessage(HeavyContextInterface *, int, const HvMessage *);
-  static void cMsg_KXtXNOXa_sendMessage(HeavyContextInterface *, int, const HvMessage *);
-  static void cSystem_kBcjJvxp_sendMessage(HeavyContextInterface *, int, const HvMessage *);
-  static void cBinop_CATg6nPr_sendMessage(HeavyContextInterface *, int, const HvMessage *);
-  static void cBinop_fXBy05cL_sendMessage(HeavyContextInterface *, int, const HvMessage *);
-  static void cMsg_OPUlBkwh_sendMessage(HeavyContextInterface *, int, const HvMessage *);
-  static void cBinop_4P51wQVc_sendMessage(HeavyContextInterface *, int, const HvMessage *);
-  static void cBinop_DZiVayHP_sendMessage(HeavyContextInterface *, int, const HvMessage *);
-  static void cBinop_21680sPq_sendMessage(HeavyContextInterface *, int, const HvMessage *);
-  static void cSwitchcase_SIDB48EI_onMessage(HeavyContextInterface *, void *, int letIn, const HvMessage *const, void *);
-  static void cDelay_dEFDi52d_sendMessage(HeavyContextInterface *, int, const HvMessage *);
-  static void cMsg_TJmmUm5U_sendMessage(HeavyContextInterface *, int, const HvMessage *);
-  static void cCast_wPee7GS2_sendMessage(HeavyContextInterface *, int, const HvMessage *);
-  static void cPack_uFHXRF1N_sendMessage(HeavyContextInterface *, int, const HvMessage *);
-  static void cSlice_ADmSntnx_sendMessage(HeavyContextInterface *, int, const HvMessage *);
-  static void cSlice_S4L3afF2_sendMessage(HeavyContextInterface *, int, const HvMessage *);
-  static void cVar_81HDz8CE_sendMessage(HeavyContextInterface *, int, const HvMessage *);
-  static void cMsg_qRQ3L6AU_sendMessage(HeavyContextInterface *, int, const HvMessage *);
-  static void cSystem_ihOT8CW7_sendMessage(HeavyContextInterface *, int, const HvMessage *);
-  static void cBinop_l8zt39cL_sendMessage(HeavyContextInterface *, int, const HvMessage *);
-  static void cBinop_7CG1MZIg_sendMessage(HeavyContextInterface *, int, const HvMessage *);
-  static void cMsg_0iV9pJKf_sendMessage(HeavyContextInterface *, int, const HvMessage *);
-  static void cBinop_IX3mHvPq_sendMessage(HeavyContextInterface *, int, const HvMessage *);
-  static void cBinop_qJXVtB2A_sendMessage(HeavyContextInterface *, int, const HvMessage *);
-  static void cBinop_BNTxg7wx_sendMessage(HeavyContextInterface *, int, const HvMessage *);
-  static void cSwitchcase_FvgdxOkD_onMessage(HeavyContextInterface *, void *, int letIn, const HvMessage *const, void *);
-  static void cSlice_K6SmtxqU_sendMessage(HeavyContextInterface *, int, const HvMessage *);
-  static void cSlice_BHreXGfs_sendMessage(HeavyContextInterface *, int, const HvMessage *);
-  static void cBinop_ky3Oc79Z_sendMessage(HeavyContextInterface *, int, const HvMessage *);
-  static void cBinop_zwbFLVjY_sendMessage(HeavyContextInterface *, int, const HvMessage *);
-  static void cBinop_5Eah3OBE_sendMessage(HeavyContextInterface *, int, const HvMessage *);
-  static void cBinop_ajNW3u8W_sendMessage(HeavyContextInterface *, int, const HvMessage *);
-  static void cMsg_OusnrNph_sendMessage(HeavyContextInterface *, int, const HvMessage *);
-  static void cSwitchcase_yHQBYmnf_onMessage(HeavyContextInterface *, void *, int letIn, const HvMessage *const, void *);
-  static void cCast_wLxvsE6d_sendMessage(HeavyContextInterface *, int, const HvMessage *);
-  static void cMsg_w9j1Cdjk_sendMessage(HeavyContextInterface *, int, const HvMessage *);
-  static void cSystem_wf9WYwuy_sendMessage(HeavyContextInterface *, int, const HvMessage *);
-  static void cMsg_dHvyDREf_sendMessage(HeavyContextInterface *, int, const HvMessage *);
-  static void cSystem_4tmfAejR_sendMessage(HeavyContextInterface *, int, const HvMessage *);
-  static void cDelay_Eru9gouJ_sendMessage(HeavyContextInterface *, int, const HvMessage *);
-  static void cSwitchcase_iphHSLaK_onMessage(HeavyContextInterface *, void *, int letIn, const HvMessage *const, void *);
-  static void cDelay_md93CS7M_sendMessage(HeavyContextInterface *, int, const HvMessage *);
-  static void cMsg_rhxubJln_sendMessage(HeavyContextInterface *, int, const HvMessage *);
-  static void cCast_6wIpt0f5_sendMessage(HeavyContextInterface *, int, const HvMessage *);
-  static void cSwitchcase_Kbkd3R0N_onMessage(HeavyContextInterface *, void *, int letIn, const HvMessage *const, void *);
-  static void cDelay_UvgBzaAj_sendMessage(HeavyContextInterface *, int, const HvMessage *);
-  static void cMsg_oOiNLMaR_sendMessage(HeavyContextInterface *, int, const HvMessage *);
-  static void cCast_JDJQipxH_sendMessage(HeavyContextInterface *, int, const HvMessage *);
-  static void cSwitchcase_zPJOqjLQ_onMessage(HeavyContextInterface *, void *, int letIn, const HvMessage *const, void *);
-  static void cDelay_M1nBpgGs_sendMessage(HeavyContextInterface *, int, const HvMessage *);
-  static void cMsg_aLvxbWK8_sendMessage(HeavyContextInterface *, int, const HvMessage *);
-  static void cCast_xKZO3BGD_sendMessage(HeavyContextInterface *, int, const HvMessage *);
-  static void cSwitchcase_SP2hdOgO_onMessage(HeavyContextInterface *, void *, int letIn, const HvMessage *const, void *);
-  static void cDelay_9Ftkd6Fy_sendMessage(HeavyContextInterface *, int, const HvMessage *);
-  static void cMsg_qLJXwPi3_sendMessage(HeavyContextInterface *, int, const HvMessage *);
-  static void cCast_5rZAbeSu_sendMessage(HeavyContextInterface *, int, const HvMessage *);
-  static void cDelay_8hDBcNPP_sendMessage(HeavyContextInterface *, int, const HvMessage *);
-  static void cSwitchcase_5yZ4bMmj_onMessage(HeavyContextInterface *, void *, int letIn, const HvMessage *const, void *);
-  static void cCast_YEv4mvrq_sendMessage(HeavyContextInterface *, int, const HvMessage *);
-  static void cIf_BPYXa7JB_sendMessage(HeavyContextInterface *, int, const HvMessage *);
-  static void cMsg_mELWUgjr_sendMessage(HeavyContextInterface *, int, const HvMessage *);
-  static void cBinop_2zKbOLUN_sendMessage(HeavyContextInterface *, int, const HvMessage *);
-  static void cBinop_ZOs8DKQs_sendMessage(HeavyContextInterface *, int, const HvMessage *);
-  static void cCast_JCdLNV35_sendMessage(HeavyContextInterface *, int, const HvMessage *);
-  static void cCast_dzWVGIcK_sendMessage(HeavyContextInterface *, int, const HvMessage *);
-  static void cBinop_KK4RoHV1_sendMessage(HeavyContextInterface *, int, const HvMessage *);
-  static void cBinop_KARnIlLo_sendMessage(HeavyContextInterface *, int, const HvMessage *);
-  static void cMsg_8VLFejsr_sendMessage(HeavyContextInterface *, int, const HvMessage *);
-  static void cBinop_i9YyF27D_sendMessage(HeavyContextInterface *, int, const HvMessage *);
-  static void cPack_mmRiOoWd_sendMessage(HeavyContextInterface *, int, const HvMessage *);
-  static void cBinop_LiMj0H1p_sendMessage(HeavyContextInterface *, int, const HvMessage *);
-  static void cMsg_PiRptExk_sendMessage(HeavyContextInterface *, int, const HvMessage *);
-  static void cBinop_Iui2p1my_sendMessage(HeavyContextInterface *, int, const HvMessage *);
-  static void cCast_JfIIyAwg_sendMessage(HeavyContextInterface *, int, const HvMessage *);
-  static void cCast_rIzOVftP_sendMessage(HeavyContextInterface *, int, const HvMessage *);
-  static void cMsg_y9otndkl_sendMessage(HeavyContextInterface *, int, const HvMessage *);
-  static void cMsg_mOOlRxTK_sendMessage(HeavyContextInterface *, int, const HvMessage *);
-  static void cBinop_oVUrXZdH_sendMessage(HeavyContextInterface *, int, const HvMessage *);
-  static void cMsg_pvqTzqZi_sendMessage(HeavyContextInterface *, int, const HvMessage *);
-  static void cBinop_mrXlugiY_sendMessage(HeavyContextInterface *, int, const HvMessage *);
-  static void cCast_YhfQGkQv_sendMessage(HeavyContextInterface *, int, const HvMessage *);
-  static void cCast_0pDnxeRd_sendMessage(HeavyContextInterface *, int, const HvMessage *);
-  static void cMsg_qBcuZRgZ_sendMessage(HeavyContextInterface *, int, const HvMessage *);
-  static void cMsg_O9aaqDcW_sendMessage(HeavyContextInterface *, int, const HvMessage *);
-  static void cCast_JctnXzZ6_sendMessage(HeavyContextInterface *, int, const HvMessage *);
-  static void cCast_QtcmGkpO_sendMessage(HeavyContextInterface *, int, const HvMessage *);
-  static void cMsg_LNpaIlFU_sendMessage(HeavyContextInterface *, int, const HvMessage *);
-  static void cMsg_hxFLOadH_sendMessage(HeavyContextInterface *, int, const HvMessage *);
-  static void cBinop_Q3fdZqnO_sendMessage(HeavyContextInterface *, int, const HvMessage *);
-  static void cMsg_DanocuFQ_sendMessage(HeavyContextInterface *, int, const HvMessage *);
-  static void cBinop_1oVhcKAe_sendMessage(HeavyContextInterface *, int, const HvMessage *);
-  static void cMsg_etboRD1p_sendMessage(HeavyContextInterface *, int, const HvMessage *);
-  static void cCast_wEEN8feL_sendMessage(HeavyContextInterface *, int, const HvMessage *);
-  static void cCast_jsHkXYE2_sendMessage(HeavyContextInterface *, int, const HvMessage *);
-  static void cCast_tj0WiuA4_sendMessage(HeavyContextInterface *, int, const HvMessage *);
-  static void cCast_RxFf9vpl_sendMessage(HeavyContextInterface *, int, const HvMessage *);
-  static void cCast_KQQK3QFZ_sendMessage(HeavyContextInterface *, int, const HvMessage *);
-  static void cCast_kUVyFe3n_sendMessage(HeavyContextInterface *, int, const HvMessage *);
-  static void cMsg_HMxya2xZ_sendMessage(HeavyContextInterface *, int, const HvMessage *);
-  static void cCast_cXXTcBNa_sendMessage(HeavyContextInterface *, int, const HvMessage *);
-  static void cCast_2W3kMZr0_sendMessage(HeavyContextInterface *, int, const HvMessage *);
-  static void cMsg_emZ4AHDA_sendMessage(HeavyContextInterface *, int, const HvMessage *);
-  static void cMsg_q4ou76oU_sendMessage(HeavyContextInterface *, int, const HvMessage *);
-  static void cMsg_O5mrDaec_sendMessage(HeavyContextInterface *, int, const HvMessage *);
-  static void cBinop_nAVnFHzn_sendMessage(HeavyContextInterface *, int, const HvMessage *);
-  static void cBinop_x5YXpkez_sendMessage(HeavyContextInterface *, int, const HvMessage *);
-  static void cMsg_Rli0KmaV_sendMessage(HeavyContextInterface *, int, const HvMessage *);
-  static void cBinop_PoYID1D7_sendMessage(HeavyContextInterface *, int, const HvMessage *);
-  static void cBinop_PXx3naOw_sendMessage(HeavyContextInterface *, int, const HvMessage *);
-  static void cBinop_pGk0g3cc_sendMessage(HeavyContextInterface *, int, const HvMessage *);
-  static void cMsg_RZ0SPTOO_sendMessage(HeavyContextInterface *, int, const HvMessage *);
-  static void cMsg_1yChKnRB_sendMessage(HeavyContextInterface *, int, const HvMessage *);
-  static void cSlice_kpwhR0tf_sendMessage(HeavyContextInterface *, int, const HvMessage *);
-  static void cSlice_oh4auhT2_sendMessage(HeavyContextInterface *, int, const HvMessage *);
-  static void cBinop_9GkGoUNy_sendMessage(HeavyContextInterface *, int, const HvMessage *);
-  static void cBinop_20OqfaGo_sendMessage(HeavyContextInterface *, int, const HvMessage *);
-  static void cBinop_jZbyfo4f_sendMessage(HeavyContextInterface *, int, const HvMessage *);
-  static void cBinop_0uc0zW84_sendMessage(HeavyContextInterface *, int, const HvMessage *);
-  static void cMsg_kb4IGhUs_sendMessage(HeavyContextInterface *, int, const HvMessage *);
-  static void cSwitchcase_rMfZDNZW_onMessage(HeavyContextInterface *, void *, int letIn, const HvMessage *const, void *);
-  static void cDelay_Gn9nia4s_sendMessage(HeavyContextInterface *, int, const HvMessage *);
-  static void cMsg_DCIzo1or_sendMessage(HeavyContextInterface *, int, const HvMessage *);
-  static void cCast_xgotwYzR_sendMessage(HeavyContextInterface *, int, const HvMessage *);
-  static void cPack_0FFsXUe9_sendMessage(HeavyContextInterface *, int, const HvMessage *);
-  static void cSlice_UWPDyIY4_sendMessage(HeavyContextInterface *, int, const HvMessage *);
-  static void cSlice_5Qfl8Kl3_sendMessage(HeavyContextInterface *, int, const HvMessage *);
-  static void cVar_kyiC1Zf2_sendMessage(HeavyContextInterface *, int, const HvMessage *);
-  static void cMsg_hDZvWMG1_sendMessage(HeavyContextInterface *, int, const HvMessage *);
-  static void cSystem_AIHWizth_sendMessage(HeavyContextInterface *, int, const HvMessage *);
-  static void cBinop_A5QHofQ9_sendMessage(HeavyContextInterface *, int, const HvMessage *);
-  static void cBinop_D136IKQ5_sendMessage(HeavyContextInterface *, int, const HvMessage *);
-  static void cMsg_FBLUET1E_sendMessage(HeavyContextInterface *, int, const HvMessage *);
-  static void cBinop_IMhCCKPw_sendMessage(HeavyContextInterface *, int, const HvMessage *);
-  static void cBinop_r1TUkR2L_sendMessage(HeavyContextInterface *, int, const HvMessage *);
-  static void cBinop_CZyqnm4Q_sendMessage(HeavyContextInterface *, int, const HvMessage *);
-  static void cSwitchcase_4cD0pfyC_onMessage(HeavyContextInterface *, void *, int letIn, const HvMessage *const, void *);
-  static void cDelay_i2j9vtBd_sendMessage(HeavyContextInterface *, int, const HvMessage *);
-  static void cMsg_CoaLfaFv_sendMessage(HeavyContextInterface *, int, const HvMessage *);
-  static void cCast_grCwKwJK_sendMessage(HeavyContextInterface *, int, const HvMessage *);
-  static void cPack_EgibIsHG_sendMessage(HeavyContextInterface *, int, const HvMessage *);
-  static void cSlice_nx6xWTIv_sendMessage(HeavyContextInterface *, int, const HvMessage *);
-  static void cSlice_nRibR7JK_sendMessage(HeavyContextInterface *, int, const HvMessage *);
-  static void cVar_2ZeHP4qZ_sendMessage(HeavyContextInterface *, int, const HvMessage *);
-  static void cMsg_eFIgSVQb_sendMessage(HeavyContextInterface *, int, const HvMessage *);
-  static void cSystem_rVjKxSWj_sendMessage(HeavyContextInterface *, int, const HvMessage *);
-  static void cBinop_3GYF4I39_sendMessage(HeavyContextInterface *, int, const HvMessage *);
-  static void cBinop_FyKBZYzr_sendMessage(HeavyContextInterface *, int, const HvMessage *);
-  static void cMsg_HRfxxP3f_sendMessage(HeavyContextInterface *, int, const HvMessage *);
-  static void cBinop_iAd21jN7_sendMessage(HeavyContextInterface *, int, const HvMessage *);
-  static void cBinop_JuAm7KIS_sendMessage(HeavyContextInterface *, int, const HvMessage *);
-  static void cBinop_wkitl7VS_sendMessage(HeavyContextInterface *, int, const HvMessage *);
-  static void cSwitchcase_AlMaGzAy_onMessage(HeavyContextInterface *, void *, int letIn, const HvMessage *const, void *);
-  static void cSlice_ccZGSBP7_sendMessage(HeavyContextInterface *, int, const HvMessage *);
-  static void cSlice_Ljp9kzNl_sendMessage(HeavyContextInterface *, int, const HvMessage *);
-  static void cBinop_HMJc0N5e_sendMessage(HeavyContextInterface *, int, const HvMessage *);
-  static void cBinop_GLx6aHXJ_sendMessage(HeavyContextInterface *, int, const HvMessage *);
-  static void cBinop_14YQ1uDS_sendMessage(HeavyContextInterface *, int, const HvMessage *);
-  static void cBinop_CWI2ECk7_sendMessage(HeavyContextInterface *, int, const HvMessage *);
-  static void cMsg_L5ydR6Yi_sendMessage(HeavyContextInterface *, int, const HvMessage *);
-  static void cSwitchcase_4Oxw3M2i_onMessage(HeavyContextInterface *, void *, int letIn, const HvMessage *const, void *);
-  static void cCast_lDCkN1Kf_sendMessage(HeavyContextInterface *, int, const HvMessage *);
-  static void cMsg_aIK2Du5A_sendMessage(HeavyContextInterface *, int, const HvMessage *);
-  static void cSystem_REqzQemd_sendMessage(HeavyContextInterface *, int, const HvMessage *);
-  static void cMsg_mUqtQDle_sendMessage(HeavyContextInterface *, int, const HvMessage *);
-  static void cSystem_p9cn2unM_sendMessage(HeavyContextInterface *, int, const HvMessage *);
-  static void cDelay_3FZn93hs_sendMessage(HeavyContextInterface *, int, const HvMessage *);
-  static void cSwitchcase_m0cBL5CC_onMessage(HeavyContextInterface *, void *, int letIn, const HvMessage *const, void *);
-  static void cDelay_rYvigZyQ_sendMessage(HeavyContextInterface *, int, const HvMessage *);
-  static void cMsg_4t6Hq55c_sendMessage(HeavyContextInterface *, int, const HvMessage *);
-  static void cCast_3Szlj56g_sendMessage(HeavyContextInterface *, int, const HvMessage *);
-  static void cSwitchcase_8EwDqalS_onMessage(HeavyContextInterface *, void *, int letIn, const HvMessage *const, void *);
-  static void cDelay_El2I9C77_sendMessage(HeavyContextInterface *, int, const HvMessage *);
-  static void cMsg_v5mHUs55_sendMessage(HeavyContextInterface *, int, const HvMessage *);
-  static void cCast_xdGIes8s_sendMessage(HeavyContextInterface *, int, const HvMessage *);
-  static void cSwitchcase_QCOcZL0k_onMessage(HeavyContextInterface *, void *, int letIn, const HvMessage *const, void *);
-  static void cDelay_IQg5PLnG_sendMessage(HeavyContextInterface *, int, const HvMessage *);
-  static void cMsg_DFPVnsBM_sendMessage(HeavyContextInterface *, int, const HvMessage *);
-  static void cCast_NqAjhx31_sendMessage(HeavyContextInterface *, int, const HvMessage *);
-  static void cSwitchcase_VNlVhLop_onMessage(HeavyContextInterface *, void *, int letIn, const HvMessage *const, void *);
-  static void cDelay_TfNYpGKV_sendMessage(HeavyContextInterface *, int, const HvMessage *);
-  static void cMsg_ss1rlpM4_sendMessage(HeavyContextInterface *, int, const HvMessage *);
-  static void cCast_cEXkdH3i_sendMessage(HeavyContextInterface *, int, const HvMessage *);
-  static void cDelay_SQWhXbuK_sendMessage(HeavyContextInterface *, int, const HvMessage *);
-  static void cSwitchcase_4bJ7vNfF_onMessage(HeavyContextInterface *, void *, int letIn, const HvMessage *const, void *);
-  static void cCast_432gH9F6_sendMessage(HeavyContextInterface *, int, const HvMessage *);
-  static void cIf_7NsIHVOW_sendMessage(HeavyContextInterface *, int, const HvMessage *);
-  static void cMsg_8zJCSbxV_sendMessage(HeavyContextInterface *, int, const HvMessage *);
-  static void cBinop_JsfiF6qC_sendMessage(HeavyContextInterface *, int, const HvMessage *);
-  static void cBinop_7hjoygWC_sendMessage(HeavyContextInterface *, int, const HvMessage *);
-  static void cCast_P0nhFNeb_sendMessage(HeavyContextInterface *, int, const HvMessage *);
-  static void cCast_OR53sAy6_sendMessage(HeavyContextInterface *, int, const HvMessage *);
-  static void cBinop_Pd5lqoR8_sendMessage(HeavyContextInterface *, int, const HvMessage *);
-  static void cBinop_dx9EgukM_sendMessage(HeavyContextInterface *, int, const HvMessage *);
-  static void cMsg_57hlhbxL_sendMessage(HeavyContextInterface *, int, const HvMessage *);
-  static void cBinop_HgHg89r7_sendMessage(HeavyContextInterface *, int, const HvMessage *);
-  static void cPack_knDzxs63_sendMessage(HeavyContextInterface *, int, const HvMessage *);
-  static void cBinop_Lo45ltl1_sendMessage(HeavyContextInterface *, int, const HvMessage *);
-  static void cMsg_mbwAJXPL_sendMessage(HeavyContextInterface *, int, const HvMessage *);
-  static void cBinop_PFUxS9Go_sendMessage(HeavyContextInterface *, int, const HvMessage *);
-  static void cCast_7NAvYHLM_sendMessage(HeavyContextInterface *, int, const HvMessage *);
-  static void cCast_J9J1vN7D_sendMessage(HeavyContextInterface *, int, const HvMessage *);
-  static void cMsg_ISJj7OwQ_sendMessage(HeavyContextInterface *, int, const HvMessage *);
-  static void cMsg_mEI45YN0_sendMessage(HeavyContextInterface *, int, const HvMessage *);
-  static void cBinop_Q5wsYYlY_sendMessage(HeavyContextInterface *, int, const HvMessage *);
-  static void cMsg_FVIIT6ue_sendMessage(HeavyContextInterface *, int, const HvMessage *);
-  static void cBinop_RHSLWQjL_sendMessage(HeavyContextInterface *, int, const HvMessage *);
-  static void cCast_wrpHr5h4_sendMessage(HeavyContextInterface *, int, const HvMessage *);
-  static void cCast_vNxezH8y_sendMessage(HeavyContextInterface *, int, const HvMessage *);
-  static void cMsg_4HMeafoY_sendMessage(HeavyContextInterface *, int, const HvMessage *);
-  static void cMsg_UThFMZyR_sendMessage(HeavyContextInterface *, int, const HvMessage *);
-  static void cCast_QpX8KJ1s_sendMessage(HeavyContextInterface *, int, const HvMessage *);
-  static void cCast_rk2leRf0_sendMessage(HeavyContextInterface *, int, const HvMessage *);
-  static void cMsg_vVR1067u_sendMessage(HeavyContextInterface *, int, const HvMessage *);
-  static void cMsg_wPGSZ374_sendMessage(HeavyContextInterface *, int, const HvMessage *);
-  static void cBinop_09LNF0Eg_sendMessage(HeavyContextInterface *, int, const HvMessage *);
-  static void cMsg_MMOQOcXb_sendMessage(HeavyContextInterface *, int, const HvMessage *);
-  static void cBinop_17N4JcCh_sendMessage(HeavyContextInterface *, int, const HvMessage *);
-  static void cMsg_1YqmG8JV_sendMessage(HeavyContextInterface *, int, const HvMessage *);
-  static void cCast_f66uQpzU_sendMessage(HeavyContextInterface *, int, const HvMessage *);
-  static void cCast_Rp4fOhNx_sendMessage(HeavyContextInterface *, int, const HvMessage *);
-  static void cCast_jQ3DV4oR_sendMessage(HeavyContextInterface *, int, const HvMessage *);
-  static void cCast_0rSymidU_sendMessage(HeavyContextInterface *, int, const HvMessage *);
-  static void cCast_2IDEfKFL_sendMessage(HeavyContextInterface *, int, const HvMessage *);
-  static void cCast_i0XIaf1t_sendMessage(HeavyContextInterface *, int, const HvMessage *);
-  static void cMsg_ievitM3h_sendMessage(HeavyContextInterface *, int, const HvMessage *);
-  static void cCast_2B0squbx_sendMessage(HeavyContextInterface *, int, const HvMessage *);
-  static void cCast_xEnOiPtC_sendMessage(HeavyContextInterface *, int, const HvMessage *);
-  static void cMsg_Tv18BrFM_sendMessage(HeavyContextInterface *, int, const HvMessage *);
-  static void cMsg_b60XF5JT_sendMessage(HeavyContextInterface *, int, const HvMessage *);
-  static void cMsg_xWQxJdsi_sendMessage(HeavyContextInterface *, int, const HvMessage *);
-  static void cBinop_vTikcOK9_sendMessage(HeavyContextInterface *, int, const HvMessage *);
-  static void cBinop_4LE3oFAE_sendMessage(HeavyContextInterface *, int, const HvMessage *);
-  static void cMsg_LbalmIoa_sendMessage(HeavyContextInterface *, int, const HvMessage *);
-  static void cBinop_ghZEl5yM_sendMessage(HeavyContextInterface *, int, const HvMessage *);
-  static void cBinop_Af1mNKzv_sendMessage(HeavyContextInterface *, int, const HvMessage *);
-  static void cBinop_XzeBh5jF_sendMessage(HeavyContextInterface *, int, const HvMessage *);
-  static void cMsg_bXl02GUf_sendMessage(HeavyContextInterface *, int, const HvMessage *);
-  static void cMsg_12GlrbhH_sendMessage(HeavyContextInterface *, int, const HvMessage *);
-  static void cSwitchcase_oJjbF3oR_onMessage(HeavyContextInterface *, void *, int letIn, const HvMessage *const, void *);
-  static void cSlice_05vVwRGe_sendMessage(HeavyContextInterface *, int, const HvMessage *);
-  static void cSwitchcase_CI4f9r5B_onMessage(HeavyContextInterface *, void *, int letIn, const HvMessage *const, void *);
-  static void cSlice_c3nXiTNC_sendMessage(HeavyContextInterface *, int, const HvMessage *);
-  static void cSwitchcase_0kq1xuMz_onMessage(HeavyContextInterface *, void *, int letIn, const HvMessage *const, void *);
-  static void cSlice_z8G0G5Eb_sendMessage(HeavyContextInterface *, int, const HvMessage *);
-  static void cSwitchcase_zGa1EpH7_onMessage(HeavyContextInterface *, void *, int letIn, const HvMessage *const, void *);
-  static void cSlice_2O5lvYJA_sendMessage(HeavyContextInterface *, int, const HvMessage *);
-  static void cSwitchcase_7i9NfnFn_onMessage(HeavyContextInterface *, void *, int letIn, const HvMessage *const, void *);
-  static void cSlice_if4TiRX7_sendMessage(HeavyContextInterface *, int, const HvMessage *);
-  static void cSwitchcase_nPhn8cUn_onMessage(HeavyContextInterface *, void *, int letIn, const HvMessage *const, void *);
-  static void cSlice_lpM95DRE_sendMessage(HeavyContextInterface *, int, const HvMessage *);
-  static void cSwitchcase_ZvI2MPL9_onMessage(HeavyContextInterface *, void *, int letIn, const HvMessage *const, void *);
-  static void cSlice_GQUD4Nul_sendMessage(HeavyContextInterface *, int, const HvMessage *);
   static void cSend_AOX5cBQ7_sendMessage(HeavyContextInterface *, int, const HvMessage *);
   static void cReceive_30ra41Ne_sendMessage(HeavyContextInterface *, int, const HvMessage *);
   static void cReceive_xufwxl2p_sendMessage(HeavyContextInterface *, int, const HvMessage *);
@@ -1533,63 +879,525 @@ class Heavy_EP_MK1 : public HeavyContext {
   static void cReceive_YSOymCGl_sendMessage(HeavyContextInterface *, int, const HvMessage *);
   static void cReceive_UNQwjlFB_sendMessage(HeavyContextInterface *, int, const HvMessage *);
 
+  // send a message to voice V and all following ones
+  template <int V> static void cReceive_30ra41Ne_voice(HeavyContextInterface *, const HvMessage *);
+  template <int V> static void cReceive_YUPT5gm3_voice(HeavyContextInterface *, const HvMessage *);
+  template <int V> static void cReceive_MGnMGx0X_voice(HeavyContextInterface *, const HvMessage *);
+
+  // send a note allocated by cPoly_notein to the voice given as outlet
+  static void cPoly_notein_sendMessage(HeavyContextInterface *, int, const HvMessage *);
+  template <int V> static void cPoly_notein_voice(HeavyContextInterface *, int, const HvMessage *);
+
+  // the note graph of voice V compiled into direct calls, see onNote()
+  template <int V> static void onNote(HeavyContextInterface *, hv_uint32_t timestamp, float pitch, float velocity);
+  template <int V> static void onNotePitch(HeavyContextInterface *, int, const HvMessage *);
+  template <int V> static void onNoteVelocity(HeavyContextInterface *, int, const HvMessage *);
+  template <int V> static void onNoteFrequency(HeavyContextInterface *, hv_uint32_t timestamp, float frequency, bool on);
+  template <int V> static void onEnvelopeADelay(HeavyContextInterface *, int, const HvMessage *);
+  template <int V> static void onEnvelopeBDelay(HeavyContextInterface *, int, const HvMessage *);
+
+  // parallel render state, renderStart and renderEnd are frame offsets into the current block
+  float *renderBuffer; // HV_RENDER_BUFFER_LENGTH frames per voice
+  int renderStart;
+  int renderEnd;
+
+  int numShedVoices; // voices fading out or parked by capVoices()
+
+  HvAttackCache attackCache;
+
+  // the symbols that the graph sends, interned once by the constructor
+  enum GraphSymbol {
+    SYMBOL_SAMPLERATE,
+    SYMBOL_CLEAR,
+    SYMBOL_TABLE,
+    SYMBOL_LENGTH,
+    NUM_GRAPH_SYMBOLS
+  };
+  hv_uint32_t graphSymbols[NUM_GRAPH_SYMBOLS]; // indices into the global symbol table
+
+#if HV_TRACE
+  // ids of the traced message functions, named by traceNames
+  enum TraceId {
+    TRACE_QUEUE, // dispatch of a scheduled message
+    TRACE_RECEIVE_MGnMGx0X, // 1001-buz-pha
+    TRACE_RECEIVE_YUPT5gm3, // 1001-poly
+    TRACE_RECEIVE_Yvc0SbVa, // 1148-currentVoiceId
+    TRACE_RECEIVE_xWrZfXcb, // 1148-indexOff
+    TRACE_RECEIVE_T5RYnxvy, // 1148-indexOn
+    TRACE_RECEIVE_YSOymCGl, // 1148-isFirstOff
+    TRACE_RECEIVE_UNQwjlFB, // 1148-isFirstOn
+    TRACE_RECEIVE_VHVO9aGV, // 1148-maxVoiceId
+    TRACE_RECEIVE_78vPaVrA, // 1148-shouldSteal
+    TRACE_RECEIVE_RehAy77I, // 1148-voiceId++
+    TRACE_RECEIVE_30ra41Ne, // __hv_init
+    TRACE_RECEIVE_xufwxl2p, // __hv_notein
+    TRACE_cSlice_elndZqvG,
+    TRACE_cSlice_8lQZHtLi,
+    TRACE_cSlice_YVJyinnD,
+    TRACE_cSlice_ARpUAMcU,
+    TRACE_cSlice_qZ4JKRTE,
+    TRACE_cVar_cpIi4bZm,
+    TRACE_cUnop_eneqfT0P,
+    TRACE_cUnop_q0eNViDL,
+    TRACE_cIf_YoRQTGhu,
+    TRACE_cBinop_s8vQ1BWG,
+    TRACE_cVar_QDfjXuFO,
+    TRACE_cUnop_E4jP3u4J,
+    TRACE_cUnop_7Y4zZuNv,
+    TRACE_cIf_f2jlbKVU,
+    TRACE_cBinop_TjJdcdK8,
+    TRACE_cIf_mO03xd4v,
+    TRACE_cIf_amyuKIUW,
+    TRACE_cIf_KcTlrUJx,
+    TRACE_cIf_smq6naFn,
+    TRACE_cBinop_9aJebTmn,
+    TRACE_cBinop_pCiyJnjZ,
+    TRACE_cBinop_JhA9xsTS,
+    TRACE_cPack_BYT033Zm,
+    TRACE_cSlice_DhA4et2d,
+    TRACE_cBinop_z60tURxy,
+    TRACE_cBinop_7Hb23T04,
+    TRACE_cVar_ElxPJUxK,
+    TRACE_cSystem_1k6xs4ow,
+    TRACE_cBinop_k9lbIrHi,
+    TRACE_cBinop_34r4jXzz,
+    TRACE_cBinop_oX6ssrYL,
+    TRACE_cBinop_rz4c8AUf,
+    TRACE_cBinop_jSKszev7,
+    TRACE_cBinop_vPTjbp6l,
+    TRACE_cBinop_BoHvJj3f,
+    TRACE_cSlice_bjkjROgL,
+    TRACE_cSlice_X59Ms47y,
+    TRACE_cBinop_qZhFVp8b,
+    TRACE_cBinop_puulPVJ8,
+    TRACE_cBinop_DrdAUms9,
+    TRACE_cBinop_5BolRjUc,
+    TRACE_cCast_zyxm9xt4,
+    TRACE_cPack_Tc48KAjO,
+    TRACE_cSlice_mxHzGYpx,
+    TRACE_cSlice_S1VOGbss,
+    TRACE_cVar_sZ2r4PVf,
+    TRACE_cSystem_rsdZ4z9K,
+    TRACE_cBinop_3RBhQUO2,
+    TRACE_cBinop_k3xOFn9Y,
+    TRACE_cBinop_si1yqlyW,
+    TRACE_cBinop_RceFSyRR,
+    TRACE_cBinop_ByBj1s2m,
+    TRACE_cCast_q8WBZ5kV,
+    TRACE_cPack_mCFcgioO,
+    TRACE_cSlice_Km00ydT2,
+    TRACE_cSlice_1Q9bVNNN,
+    TRACE_cVar_NTVGi1rx,
+    TRACE_cSystem_jkVp0Kx6,
+    TRACE_cBinop_D5D0LaYe,
+    TRACE_cBinop_HA94hCLv,
+    TRACE_cBinop_mTfoFJLO,
+    TRACE_cBinop_A2KsUGjR,
+    TRACE_cBinop_G6AE2PwA,
+    TRACE_cSlice_8PkrkbiL,
+    TRACE_cSlice_AxhMJRiu,
+    TRACE_cBinop_Ti73JY9X,
+    TRACE_cBinop_aYuF0nQk,
+    TRACE_cBinop_GBGRcaro,
+    TRACE_cBinop_AUvUrY4R,
+    TRACE_cCast_HSlHEo3Y,
+    TRACE_cSystem_iEpbB1Tt,
+    TRACE_cSystem_uncdQ37f,
+    TRACE_cCast_L944F4zY,
+    TRACE_cCast_ozYOhZf7,
+    TRACE_cCast_1C4AfEl2,
+    TRACE_cCast_oZICOJL8,
+    TRACE_cCast_DNh0wPJB,
+    TRACE_cIf_uB5Z1HTu,
+    TRACE_cBinop_gRen83wr,
+    TRACE_cBinop_7dajl5bE,
+    TRACE_cCast_HYVll2lR,
+    TRACE_cCast_B2ubKDES,
+    TRACE_cBinop_maqKW0Ak,
+    TRACE_cBinop_1pfH37j6,
+    TRACE_cBinop_VtqrJbdm,
+    TRACE_cPack_H3oA1KXj,
+    TRACE_cBinop_JuKEhSjI,
+    TRACE_cBinop_F8TudeNI,
+    TRACE_cCast_ZnbsczMl,
+    TRACE_cCast_qnILIr3V,
+    TRACE_cBinop_j7sSgKsi,
+    TRACE_cBinop_H0pkypkT,
+    TRACE_cCast_82unbjQp,
+    TRACE_cCast_LDzBBnIB,
+    TRACE_cCast_7jMyosM4,
+    TRACE_cCast_ZoDeIpFy,
+    TRACE_cBinop_3tTN8vR3,
+    TRACE_cBinop_dIYEAlww,
+    TRACE_cCast_J9xHtT7Q,
+    TRACE_cCast_QZxtFP7i,
+    TRACE_cCast_VFlsIg5P,
+    TRACE_cCast_x7fI6QRT,
+    TRACE_cCast_kmODmaFn,
+    TRACE_cCast_lzw09MRv,
+    TRACE_cCast_zrinnCdD,
+    TRACE_cCast_OxhalDGO,
+    TRACE_cBinop_c85ioJXE,
+    TRACE_cBinop_lklbN5Wj,
+    TRACE_cBinop_7dgfWIsc,
+    TRACE_cBinop_IpPxuID9,
+    TRACE_cBinop_XKbyFfP1,
+    TRACE_cVar_W2qTdReU,
+    TRACE_cVar_t9FMWBot,
+    TRACE_cSlice_0qBP9nWd,
+    TRACE_cSlice_tESkokbe,
+    TRACE_cSlice_o4tsP9dq,
+    TRACE_cSlice_FCBGNY5K,
+    TRACE_cVar_nFgGc4Zm,
+    TRACE_cIf_D4wcmJuh,
+    TRACE_cIf_c0zUMuUL,
+    TRACE_cIf_D3NPspDa,
+    TRACE_cVar_h9fOsrnu,
+    TRACE_cIf_aU22ke9k,
+    TRACE_cBinop_zdLrBU74,
+    TRACE_cVar_nFPgN4cq,
+    TRACE_cUnop_PXFSc0Xg,
+    TRACE_cUnop_dGHGrDep,
+    TRACE_cIf_47eGoYaP,
+    TRACE_cBinop_JAzKubmp,
+    TRACE_cCast_z1M5xDBU,
+    TRACE_cCast_ZIpKuNn1,
+    TRACE_cBinop_RBY4x1dy,
+    TRACE_cCast_8XlFXMki,
+    TRACE_cCast_AzNh1LS8,
+    TRACE_cBinop_fiLZbzXB,
+    TRACE_cCast_1Y4FEehG,
+    TRACE_cCast_n8meYdCZ,
+    TRACE_cVar_G6zKrSxh,
+    TRACE_cTabread_PauJffJY,
+    TRACE_cSlice_yetBqfVw,
+    TRACE_cVar_TLOWGcxL,
+    TRACE_cSystem_C94bpPZ1,
+    TRACE_cBinop_MwEDiNmW,
+    TRACE_cCast_qEdTfHLx,
+    TRACE_cCast_gQEr5Vzf,
+    TRACE_cBinop_zGtokhdj,
+    TRACE_cBinop_wvx1FFS8,
+    TRACE_cTabread_KpXSrXsH,
+    TRACE_cSlice_o3FM47ae,
+    TRACE_cVar_5rfRjuLO,
+    TRACE_cSystem_moa8uldG,
+    TRACE_cBinop_rQCjjERn,
+    TRACE_cCast_gjQd6FHg,
+    TRACE_cCast_r4xpgQAp,
+    TRACE_cBinop_FKqtHwiD,
+    TRACE_cBinop_GsngWkWj,
+    TRACE_cVar_YQvRzRkM,
+    TRACE_cSlice_kuLRrEzT,
+    TRACE_cSlice_zdBnuOil,
+    TRACE_cTabread_ZQApb8qU,
+    TRACE_cSlice_JhRv8Rsb,
+    TRACE_cVar_RJ9OHYRE,
+    TRACE_cSystem_4iejHTOR,
+    TRACE_cBinop_gIbVQO5V,
+    TRACE_cCast_GYSRok7h,
+    TRACE_cCast_wPRiZIlB,
+    TRACE_cBinop_anj1Q63b,
+    TRACE_cBinop_t953EdC4,
+    TRACE_cVar_uyfxho1R,
+    TRACE_cCast_nl7RC4Js,
+    TRACE_cVar_6P11HIk6,
+    TRACE_cIf_UIdc2Y3S,
+    TRACE_cTabwrite_phRkfVNE,
+    TRACE_cSlice_XQ59cW9c,
+    TRACE_cTabwrite_srERlrc2,
+    TRACE_cSlice_92qaa8G2,
+    TRACE_cVar_FxOwbdbW,
+    TRACE_cVar_qiKMdCfe,
+    TRACE_cSlice_uEndvnwx,
+    TRACE_cSlice_IZt7JHNk,
+    TRACE_cPack_81OkRPDa,
+    TRACE_cCast_t07sRowU,
+    TRACE_cCast_sjy60rVr,
+    TRACE_cCast_r2Mflo6h,
+    TRACE_cCast_5clhtePq,
+    TRACE_cCast_zxoReFHB,
+    TRACE_cCast_59ayNLj0,
+    TRACE_cCast_fZQLrPZX,
+    TRACE_cCast_vqezTY2U,
+    TRACE_cBinop_RFdaE8WW,
+    TRACE_cBinop_7PEtvA9O,
+    TRACE_cBinop_DNEcWV5z,
+    TRACE_cBinop_01bWJPHc,
+    TRACE_cCast_Toelep2C,
+    TRACE_cCast_otsptKoG,
+    TRACE_cCast_OiE13JrK,
+    TRACE_cCast_kjGd09sO,
+    TRACE_cCast_lVQoNquY,
+    TRACE_cCast_v3d0oOQA,
+    TRACE_cCast_tT8xPc3T,
+    TRACE_cSend_NjIhZ7gk,
+    TRACE_cCast_lC8f8LIc,
+    TRACE_cCast_oaX9amtS,
+    TRACE_cCast_ZP0FUoSx,
+    TRACE_cCast_JZbX8B3e,
+    TRACE_cIf_TFIJca8L,
+    TRACE_cVar_cKm6INBi,
+    TRACE_cIf_ibFYYATN,
+    TRACE_cBinop_I8mRYXHG,
+    TRACE_cVar_QJUrAoEP,
+    TRACE_cUnop_txyu0gVn,
+    TRACE_cUnop_sJpF83hS,
+    TRACE_cIf_o3dHJNrP,
+    TRACE_cBinop_3kgvdtIu,
+    TRACE_cCast_OsZGs13Y,
+    TRACE_cCast_d65Rxi8V,
+    TRACE_cBinop_fXXfM7sT,
+    TRACE_cCast_Tz96PA7l,
+    TRACE_cCast_zbdsGp4Q,
+    TRACE_cBinop_CDRpKtNX,
+    TRACE_cCast_O4Q1pV7f,
+    TRACE_cCast_L0r15hIm,
+    TRACE_cVar_YNI0kMWD,
+    TRACE_cTabwrite_4XAIFIT1,
+    TRACE_cSlice_Ahl4XFE1,
+    TRACE_cTabread_v2Y3w5Js,
+    TRACE_cSlice_KfTlOVnb,
+    TRACE_cVar_xlGGAJyo,
+    TRACE_cSystem_pnjlb28E,
+    TRACE_cBinop_mGNHy9HX,
+    TRACE_cCast_YrH7suTO,
+    TRACE_cCast_T1P9TfNh,
+    TRACE_cBinop_4OhIorOU,
+    TRACE_cBinop_zrolu0CB,
+    TRACE_cIf_9Pnl6QKg,
+    TRACE_cTabread_3p4zBAxb,
+    TRACE_cSlice_3TTb2icc,
+    TRACE_cVar_ALLgM3kz,
+    TRACE_cSystem_toydDMEZ,
+    TRACE_cBinop_x6QzRkvq,
+    TRACE_cCast_2PhtqbJs,
+    TRACE_cCast_moRgLKdQ,
+    TRACE_cBinop_9ycQILEU,
+    TRACE_cBinop_cWTIXbmQ,
+    TRACE_cCast_K8rv8Ljd,
+    TRACE_cCast_Mc8k3hlh,
+    TRACE_cSend_hiyIT3I9,
+    TRACE_cBinop_akFH16AP,
+    TRACE_cCast_IlvONaEH,
+    TRACE_cCast_BABcar8i,
+    TRACE_cCast_Pwj4c9ij,
+    TRACE_cCast_iN9dXiS0,
+    TRACE_cCast_TB6jVJx0,
+    TRACE_cCast_Y55V3JXd,
+    TRACE_cCast_ACsUUs03,
+    TRACE_cCast_cCLqsJUy,
+    TRACE_cCast_OVwLKMkd,
+    TRACE_cSend_HkQLUnNC,
+    TRACE_cIf_4hIlFUU3,
+    TRACE_cVar_QV1FHuAQ,
+    TRACE_cIf_8SDdSAUy,
+    TRACE_cBinop_tf6cjDqo,
+    TRACE_cVar_OFdGnxYb,
+    TRACE_cUnop_HQuF2Uw5,
+    TRACE_cUnop_MChGy2fT,
+    TRACE_cIf_iPBiNEnD,
+    TRACE_cBinop_X0hsC581,
+    TRACE_cCast_E7hj1L6l,
+    TRACE_cCast_6K1GAY3K,
+    TRACE_cBinop_EHSnhdCg,
+    TRACE_cCast_2a8a6rMB,
+    TRACE_cCast_syhavs5K,
+    TRACE_cBinop_oBnn7Qpa,
+    TRACE_cCast_rorsqFcn,
+    TRACE_cCast_hERdrwbZ,
+    TRACE_cVar_gyUPexf9,
+    TRACE_cTabwrite_mwtkLMr5,
+    TRACE_cSlice_687b49wk,
+    TRACE_cTabwrite_t4h14qem,
+    TRACE_cSlice_TpNaIlmR,
+    TRACE_cTabwrite_Xc9EqI71,
+    TRACE_cSlice_uriW0Yse,
+    TRACE_cCast_tQTbtkm7,
+    TRACE_cCast_kzNTGzTT,
+    TRACE_cSend_pZhDrNel,
+    TRACE_cCast_GHLt8WPI,
+    TRACE_cIf_N2eqUNfm,
+    TRACE_cVar_INvadq4g,
+    TRACE_cIf_MXYQ077D,
+    TRACE_cBinop_UT1t4ZTo,
+    TRACE_cVar_cdEnC7IL,
+    TRACE_cUnop_tyiyS93M,
+    TRACE_cUnop_rQdaBRHs,
+    TRACE_cIf_MuTE4IBy,
+    TRACE_cBinop_Tgf0gGqC,
+    TRACE_cCast_M0vsPpvk,
+    TRACE_cCast_Aeno7EE6,
+    TRACE_cBinop_fiXM9NS8,
+    TRACE_cCast_L1fYJdEq,
+    TRACE_cCast_WoShzqey,
+    TRACE_cBinop_2rzB3hZ9,
+    TRACE_cCast_eSt1Myvl,
+    TRACE_cCast_zHPXM7Vo,
+    TRACE_cVar_OkVpRRSw,
+    TRACE_cCast_DuaZN2LR,
+    TRACE_cVar_XpmYbjT4,
+    TRACE_cIf_0cDBtrS9,
+    TRACE_cVar_iiualsly,
+    TRACE_cCast_LyTrBvaL,
+    TRACE_cVar_dx2ZQG4K,
+    TRACE_cVar_OyUmAZI6,
+    TRACE_cIf_YXo0WfYq,
+    TRACE_cIf_dw0Rb8md,
+    TRACE_cPack_TGa9AOTT,
+    TRACE_cVar_MfvQWInI,
+    TRACE_cSlice_SvNxgwyv,
+    TRACE_cSlice_84tpamIM,
+    TRACE_cVar_bNgyqWRz,
+    TRACE_cIf_30KS2vcA,
+    TRACE_cVar_L9vaHYGJ,
+    TRACE_cVar_u5tBj8Lb,
+    TRACE_cTabread_zixFG9DX,
+    TRACE_cSlice_mpKBBGkD,
+    TRACE_cVar_qZNKNNj4,
+    TRACE_cSystem_voLMvJtv,
+    TRACE_cBinop_178ekfBO,
+    TRACE_cCast_v6d4l04b,
+    TRACE_cCast_lw2om64Y,
+    TRACE_cBinop_fTIYVYXR,
+    TRACE_cBinop_wnEj2stC,
+    TRACE_cTabread_r8YGsDv2,
+    TRACE_cSlice_E3eGCS7T,
+    TRACE_cVar_nqwB3gob,
+    TRACE_cSystem_dFJmqMg6,
+    TRACE_cBinop_QSHAKfTC,
+    TRACE_cCast_p8ajT9ad,
+    TRACE_cCast_bx7WNS9f,
+    TRACE_cBinop_RTJGzepK,
+    TRACE_cBinop_lWgQPRpo,
+    TRACE_cTabwrite_AFpLtIy7,
+    TRACE_cSlice_Xgq2sBvz,
+    TRACE_cTabread_wzHGlVxe,
+    TRACE_cSlice_uQMKeyli,
+    TRACE_cVar_6vM6OQsr,
+    TRACE_cSystem_96tJg7pf,
+    TRACE_cBinop_kDYam45V,
+    TRACE_cCast_QnJqLA1M,
+    TRACE_cCast_LeSduyOi,
+    TRACE_cBinop_n6HPoGNU,
+    TRACE_cBinop_tZWF9Lfj,
+    TRACE_cTabwrite_7CqRGpzh,
+    TRACE_cSlice_fGAlwoVk,
+    TRACE_cTabwrite_f431WPJL,
+    TRACE_cSlice_oeypQYGk,
+    TRACE_cTabwrite_b1zrUtiJ,
+    TRACE_cSlice_4y3BMUCB,
+    TRACE_cTabwrite_ZnyIyMwB,
+    TRACE_cSlice_ahe4Nl54,
+    TRACE_cVar_GiSxSddZ,
+    TRACE_cTabwrite_rhy4zqC2,
+    TRACE_cSlice_jJFqUT5D,
+    TRACE_cVar_MitV4kWM,
+    TRACE_cSlice_vacnVbtY,
+    TRACE_cSlice_JP4mGNIp,
+    TRACE_cVar_aVw41OwU,
+    TRACE_cBinop_Bhr229Ht,
+    TRACE_cBinop_VHLIISwe,
+    TRACE_cCast_MzF5Hl3g,
+    TRACE_cCast_Rqdzzopc,
+    TRACE_cCast_pRnu6zXa,
+    TRACE_cCast_QKm7gW5N,
+    TRACE_cSend_yCYNWwSA,
+    TRACE_cCast_za7kZ0e3,
+    TRACE_cCast_iG3mZ9o0,
+    TRACE_cBinop_eieiD2dS,
+    TRACE_cBinop_xavIp2th,
+    TRACE_cCast_1dEz7w9q,
+    TRACE_cCast_03VH1lVz,
+    TRACE_cBinop_DGMgtVll,
+    TRACE_cSend_WSDDndNM,
+    TRACE_cSend_Zs9LdfGr,
+    TRACE_cSend_rYRzeYO9,
+    TRACE_cCast_dcDNxpDA,
+    TRACE_cCast_HwYRa9lS,
+    TRACE_cCast_u85ozOpU,
+    TRACE_cBinop_wRpWrKWi,
+    TRACE_cCast_X1p3HUe3,
+    TRACE_cCast_aU6TuZlp,
+    TRACE_cCast_6oxnYXEa,
+    TRACE_cCast_AoKOrzvT,
+    TRACE_cCast_a8KlujQB,
+    TRACE_cSend_uyNAOhx6,
+    TRACE_cCast_yyCIcfT1,
+    TRACE_cCast_yVBkpDUK,
+    TRACE_cCast_lzcrmloV,
+    TRACE_cSend_Lrct6HgO,
+    TRACE_cCast_A5avvMDt,
+    TRACE_cCast_Xlp3vC4h,
+    TRACE_cCast_IQbanAHu,
+    TRACE_cSend_x9mgTo5s,
+    TRACE_cSend_NmT9TuoN,
+    TRACE_cCast_xqKm824T,
+    TRACE_cCast_E0zeqvEo,
+    TRACE_cBinop_0TCmOiUi,
+    TRACE_cBinop_B3C8qnN1,
+    TRACE_cCast_UqYgiBZ0,
+    TRACE_cCast_QIOH6Z9s,
+    TRACE_cCast_ck24J6RM,
+    TRACE_cCast_IT7p1guU,
+    TRACE_cCast_ZJq0sCI6,
+    TRACE_cCast_7hJNNhYI,
+    TRACE_cCast_4IkDDX1c,
+    TRACE_cCast_1wJ4poyP,
+    TRACE_cSend_7OrG8WzM,
+    TRACE_cCast_Dp1wu1wH,
+    TRACE_cCast_7sCGNTzx,
+    TRACE_cSend_VtoZ7BwK,
+    TRACE_cCast_DCzwWFBE,
+    TRACE_cCast_WkdFLadT,
+    TRACE_cCast_S7DTAUvH,
+    TRACE_cCast_todgcz4E,
+    TRACE_cCast_WmFpuX9z,
+    TRACE_cCast_hpLxvQwg,
+    TRACE_cSend_TNisPs3g,
+    TRACE_cBinop_Qa8GSBYv,
+    TRACE_cSend_Vp3RAYli,
+    TRACE_cBinop_EpXBdGxj,
+    TRACE_cBinop_60vLkGOw,
+    TRACE_hTable_zrjAPWjU,
+    TRACE_hTable_jDLA3bj2,
+    TRACE_hTable_103Wn1Ed,
+    TRACE_cCast_GXrq5eSO,
+    TRACE_cCast_gjG7vzxq,
+    TRACE_cSend_14E5VKgj,
+    TRACE_cBinop_aRCf7ezT,
+    TRACE_cBinop_b9e8k91q,
+    TRACE_cBinop_7AH6hATD,
+    TRACE_cSend_AOX5cBQ7,
+    TRACE_cReceive_30ra41Ne,
+    TRACE_cReceive_xufwxl2p,
+    TRACE_cReceive_YUPT5gm3,
+    TRACE_cPoly_notein,
+    TRACE_cReceive_MGnMGx0X,
+    TRACE_cReceive_78vPaVrA,
+    TRACE_cReceive_Yvc0SbVa,
+    TRACE_cReceive_RehAy77I,
+    TRACE_cReceive_VHVO9aGV,
+    TRACE_cReceive_T5RYnxvy,
+    TRACE_cReceive_xWrZfXcb,
+    TRACE_cReceive_YSOymCGl,
+    TRACE_cReceive_UNQwjlFB,
+    TRACE_NUM_IDS
+  };
+  static const char *const traceNames[TRACE_NUM_IDS];
+  HvTrace trace;
+#endif
+
+#if HV_PROFILE
+  // the voice sections are counted by each voice, HV_EP_MK1_PROFILE_VOICES counts all voices
+  hv_uint64_t profileTicks[HV_EP_MK1_PROFILE_NUM_SECTIONS];
+  hv_uint64_t profileFrames;
+#endif
+
   // objects
-  SignalRPole sRPole_xQE1l5IP;
-  SignalPhasor sPhasor_1g348lth;
-  SignalRPole sRPole_LJ2U55sy;
-  SignalLine sLine_p3apF6qw;
-  SignalLine sLine_Fe0sHHrh;
-  SignalBiquad sBiquad_s_YKOSCulY;
-  SignalBiquad sBiquad_s_WwgL7LgK;
-  SignalRPole sRPole_Yh3y0fv7;
-  SignalPhasor sPhasor_fT5BH6mJ;
-  SignalRPole sRPole_OW9MoKMh;
-  SignalLine sLine_hADdbIyX;
-  SignalLine sLine_QOlaVO7i;
-  SignalBiquad sBiquad_s_J2SXmwLe;
-  SignalBiquad sBiquad_s_V1GxOo38;
-  SignalRPole sRPole_fc8fozRB;
-  SignalPhasor sPhasor_4cjQsVOb;
-  SignalRPole sRPole_mUTFYoDS;
-  SignalLine sLine_cIX3zJqu;
-  SignalLine sLine_LhlRTRkY;
-  SignalBiquad sBiquad_s_yl5UTiMA;
-  SignalBiquad sBiquad_s_w1lsyZ09;
-  SignalRPole sRPole_6w5YBg62;
-  SignalPhasor sPhasor_D5sKYl8D;
-  SignalRPole sRPole_RSpjeLQ7;
-  SignalLine sLine_0sWTZ5AU;
-  SignalLine sLine_RzEGSGrh;
-  SignalBiquad sBiquad_s_RKAk6kYo;
-  SignalBiquad sBiquad_s_tKqK3PD8;
-  SignalRPole sRPole_rortzBCV;
-  SignalPhasor sPhasor_EcWjv2sM;
-  SignalRPole sRPole_h1PimpFg;
-  SignalLine sLine_dkF12Ve6;
-  SignalLine sLine_qf13Df9a;
-  SignalBiquad sBiquad_s_5ZyVy244;
-  SignalBiquad sBiquad_s_iY0l9PpE;
-  SignalRPole sRPole_ENY5kCjf;
-  SignalPhasor sPhasor_E5G3BDc3;
-  SignalRPole sRPole_FcnY2nUH;
-  SignalLine sLine_7VShF34d;
-  SignalLine sLine_cB6SyVDf;
-  SignalBiquad sBiquad_s_lTst5uXH;
-  SignalBiquad sBiquad_s_bv0ayvgN;
-  SignalRPole sRPole_KtL4KXWw;
-  SignalPhasor sPhasor_c7vJg0xU;
-  SignalRPole sRPole_rXfoSWbc;
-  SignalLine sLine_j9bBmCVa;
-  SignalLine sLine_sg8Xev4V;
-  SignalBiquad sBiquad_s_cMP1tQbF;
-  SignalBiquad sBiquad_s_gmGyDRT9;
-  SignalRPole sRPole_hqPZA51z;
-  SignalPhasor sPhasor_SazJp6hE;
-  SignalRPole sRPole_i1z0QzqD;
-  SignalLine sLine_B8Rawwja;
-  SignalLine sLine_VEYj3jgK;
-  SignalBiquad sBiquad_s_Tem2knmO;
-  SignalBiquad sBiquad_s_LyFyGR1n;
+  Voice voice[HV_EP_MK1_NUM_VOICES];
+  ControlNoteCache cNoteCache_mtof; // shared by the mtof chains of all voices
+  ControlPoly cPoly_notein; // native voice allocator on the state of the [poly] graph
   SignalRPole sRPole_FWviEoDV;
   SignalDel1 sDel1_GoFPXWmZ;
   ControlSlice cSlice_elndZqvG;
@@ -1611,7 +1419,6 @@ class Heavy_EP_MK1 : public HeavyContext {
   ControlBinop cBinop_pCiyJnjZ;
   ControlBinop cBinop_JhA9xsTS;
   ControlPack cPack_BYT033Zm;
-  ControlSlice cSlice_DhA4et2d;
   ControlBinop cBinop_z60tURxy;
   ControlBinop cBinop_7Hb23T04;
   SignalVarf sVarf_RNGFp3NA;
@@ -1624,73 +1431,6 @@ class Heavy_EP_MK1 : public HeavyContext {
   ControlBinop cBinop_vPTjbp6l;
   ControlBinop cBinop_BoHvJj3f;
   SignalVarf sVarf_Yp4JGjbp;
-  ControlSlice cSlice_bjkjROgL;
-  ControlSlice cSlice_X59Ms47y;
-  ControlBinop cBinop_qZhFVp8b;
-  ControlBinop cBinop_puulPVJ8;
-  ControlBinop cBinop_DrdAUms9;
-  ControlBinop cBinop_5BolRjUc;
-  ControlDelay cDelay_XJtqLdR3;
-  ControlPack cPack_Tc48KAjO;
-  ControlSlice cSlice_mxHzGYpx;
-  ControlSlice cSlice_S1VOGbss;
-  ControlVar cVar_sZ2r4PVf;
-  ControlBinop cBinop_3RBhQUO2;
-  ControlBinop cBinop_k3xOFn9Y;
-  SignalVarf sVarf_12WWjECf;
-  ControlBinop cBinop_si1yqlyW;
-  ControlBinop cBinop_RceFSyRR;
-  ControlBinop cBinop_ByBj1s2m;
-  SignalVarf sVarf_JStffWNs;
-  ControlDelay cDelay_LdXQexFY;
-  ControlPack cPack_mCFcgioO;
-  ControlSlice cSlice_Km00ydT2;
-  ControlSlice cSlice_1Q9bVNNN;
-  ControlVar cVar_NTVGi1rx;
-  ControlBinop cBinop_D5D0LaYe;
-  ControlBinop cBinop_HA94hCLv;
-  SignalVarf sVarf_MhpLVcYQ;
-  ControlBinop cBinop_mTfoFJLO;
-  ControlBinop cBinop_A2KsUGjR;
-  ControlBinop cBinop_G6AE2PwA;
-  SignalVarf sVarf_dWTru9Kp;
-  ControlSlice cSlice_8PkrkbiL;
-  ControlSlice cSlice_AxhMJRiu;
-  ControlBinop cBinop_Ti73JY9X;
-  ControlBinop cBinop_aYuF0nQk;
-  ControlBinop cBinop_GBGRcaro;
-  ControlBinop cBinop_AUvUrY4R;
-  SignalVarf sVarf_0vvlNiX4;
-  SignalVarf sVarf_yz2BQm5L;
-  ControlDelay cDelay_yN9o31WM;
-  SignalVarf sVarf_pkqNsRE6;
-  ControlDelay cDelay_qZFKZiPY;
-  ControlDelay cDelay_u4RfWjOf;
-  ControlDelay cDelay_HvShZWxN;
-  ControlDelay cDelay_62QExDOA;
-  ControlDelay cDelay_twfJBpos;
-  ControlIf cIf_uB5Z1HTu;
-  ControlBinop cBinop_gRen83wr;
-  ControlBinop cBinop_7dajl5bE;
-  ControlBinop cBinop_maqKW0Ak;
-  ControlBinop cBinop_1pfH37j6;
-  ControlBinop cBinop_VtqrJbdm;
-  ControlPack cPack_H3oA1KXj;
-  ControlBinop cBinop_JuKEhSjI;
-  ControlBinop cBinop_F8TudeNI;
-  ControlBinop cBinop_j7sSgKsi;
-  ControlBinop cBinop_H0pkypkT;
-  ControlBinop cBinop_3tTN8vR3;
-  ControlBinop cBinop_dIYEAlww;
-  SignalVarf sVarf_5c1hNZPU;
-  ControlBinop cBinop_c85ioJXE;
-  ControlBinop cBinop_lklbN5Wj;
-  ControlBinop cBinop_7dgfWIsc;
-  ControlBinop cBinop_IpPxuID9;
-  ControlBinop cBinop_XKbyFfP1;
-  SignalVarf sVarf_mmQmNb4h;
-  SignalVarf sVarf_U88OzJYl;
-  SignalVarf sVarf_E7C2HtOj;
   ControlVar cVar_W2qTdReU;
   ControlVar cVar_t9FMWBot;
   ControlSlice cSlice_0qBP9nWd;
@@ -1864,482 +1604,6 @@ class Heavy_EP_MK1 : public HeavyContext {
   HvTable hTable_103Wn1Ed;
   ControlBinop cBinop_aRCf7ezT;
   ControlBinop cBinop_b9e8k91q;
-  ControlSlice cSlice_2INuIXhx;
-  ControlSlice cSlice_rIS4wCWL;
-  ControlBinop cBinop_anivr1Px;
-  ControlBinop cBinop_Zzp7ey9u;
-  ControlBinop cBinop_qNNqg8fl;
-  ControlBinop cBinop_D4pAxZXo;
-  ControlDelay cDelay_fChR2EMd;
-  ControlPack cPack_5c1776aq;
-  ControlSlice cSlice_uOTUFrWe;
-  ControlSlice cSlice_2v2J5hCG;
-  ControlVar cVar_f7mZhooZ;
-  ControlBinop cBinop_lV6bOwnK;
-  ControlBinop cBinop_GbGYOiva;
-  SignalVarf sVarf_WD7C8chd;
-  ControlBinop cBinop_Di0BSSgC;
-  ControlBinop cBinop_oqPfrp1J;
-  ControlBinop cBinop_JmyVXmNs;
-  SignalVarf sVarf_RcnTHRuu;
-  ControlDelay cDelay_1yRWlMR0;
-  ControlPack cPack_SwGJLASp;
-  ControlSlice cSlice_dtyI5XH4;
-  ControlSlice cSlice_0n4vTued;
-  ControlVar cVar_cuvWDrFY;
-  ControlBinop cBinop_CgfALdqs;
-  ControlBinop cBinop_qjO6txa1;
-  SignalVarf sVarf_MfT4ifW4;
-  ControlBinop cBinop_r5YmAXgy;
-  ControlBinop cBinop_4ZiErfzd;
-  ControlBinop cBinop_bEbE8c1Q;
-  SignalVarf sVarf_vp8lIXCn;
-  ControlSlice cSlice_XuiDQjrM;
-  ControlSlice cSlice_jf2Ro2dy;
-  ControlBinop cBinop_apMcAOFx;
-  ControlBinop cBinop_C9qeifus;
-  ControlBinop cBinop_cXPXdUfF;
-  ControlBinop cBinop_JmxewGJv;
-  SignalVarf sVarf_qx7mJTO2;
-  SignalVarf sVarf_Jiw4Es3V;
-  ControlDelay cDelay_a1Yr3GlD;
-  SignalVarf sVarf_EnIDOsdo;
-  ControlDelay cDelay_odpMaBGc;
-  ControlDelay cDelay_zIGcbWr6;
-  ControlDelay cDelay_PYqe7fPW;
-  ControlDelay cDelay_YTuA3aGI;
-  ControlDelay cDelay_B0f8yaM4;
-  ControlIf cIf_drS0YQ1l;
-  ControlBinop cBinop_NbhbI6Aw;
-  ControlBinop cBinop_pOL4RXb6;
-  ControlBinop cBinop_85xlG53a;
-  ControlBinop cBinop_Cfh8L2Oh;
-  ControlBinop cBinop_f1GPe8wH;
-  ControlPack cPack_nY24jnaO;
-  ControlBinop cBinop_jxSH4lC7;
-  ControlBinop cBinop_C0Wn6bJr;
-  ControlBinop cBinop_rRe2nMN0;
-  ControlBinop cBinop_R6mPsfGd;
-  ControlBinop cBinop_kIOWepAR;
-  ControlBinop cBinop_moMtXn4m;
-  SignalVarf sVarf_7rNwdeBI;
-  ControlBinop cBinop_zDi7M02d;
-  ControlBinop cBinop_k49e22Gp;
-  ControlBinop cBinop_NixFIDVe;
-  ControlBinop cBinop_zrBIyQso;
-  ControlBinop cBinop_dhr9C5zZ;
-  SignalVarf sVarf_lvEgPbs3;
-  SignalVarf sVarf_iDRS34B2;
-  SignalVarf sVarf_3qDPWnPQ;
-  ControlSlice cSlice_qZT4eBYV;
-  ControlSlice cSlice_7oNej4sG;
-  ControlBinop cBinop_l3RXDCtN;
-  ControlBinop cBinop_tsESU4RN;
-  ControlBinop cBinop_nWXpuFVx;
-  ControlBinop cBinop_AUKqDMCP;
-  ControlDelay cDelay_ZtwXRUif;
-  ControlPack cPack_J0CLxFll;
-  ControlSlice cSlice_YosQUGW6;
-  ControlSlice cSlice_w1ytFFHJ;
-  ControlVar cVar_I5axLBa7;
-  ControlBinop cBinop_8mUuoz38;
-  ControlBinop cBinop_llPN8wky;
-  SignalVarf sVarf_sChqoevv;
-  ControlBinop cBinop_bjbPNxTO;
-  ControlBinop cBinop_nCoZaBF0;
-  ControlBinop cBinop_9Mvq2M0P;
-  SignalVarf sVarf_oj8tkGiB;
-  ControlDelay cDelay_iN9nDqKH;
-  ControlPack cPack_XcUCeI3v;
-  ControlSlice cSlice_nOSjeXgq;
-  ControlSlice cSlice_qIBpEnnd;
-  ControlVar cVar_6lY50lnm;
-  ControlBinop cBinop_KyQEhWTY;
-  ControlBinop cBinop_tLvLAlZL;
-  SignalVarf sVarf_r2nB2y1m;
-  ControlBinop cBinop_WTmBkKQT;
-  ControlBinop cBinop_jj4NG7qf;
-  ControlBinop cBinop_FGtkRlDO;
-  SignalVarf sVarf_WSO3zyqT;
-  ControlSlice cSlice_UaT8lPaC;
-  ControlSlice cSlice_F4UGzXJD;
-  ControlBinop cBinop_QrSnCJCJ;
-  ControlBinop cBinop_fJLC2pkO;
-  ControlBinop cBinop_Fa78vtHE;
-  ControlBinop cBinop_pNB7bAH5;
-  SignalVarf sVarf_ruyibc4Y;
-  SignalVarf sVarf_zp8XrZmD;
-  ControlDelay cDelay_QLMdRIRC;
-  SignalVarf sVarf_e5DnsKGN;
-  ControlDelay cDelay_Jj5JoN3X;
-  ControlDelay cDelay_MT2IRF44;
-  ControlDelay cDelay_kVeglpYz;
-  ControlDelay cDelay_HjgtvZoF;
-  ControlDelay cDelay_AQqKKBe7;
-  ControlIf cIf_riRtEjEO;
-  ControlBinop cBinop_kWGjKN5n;
-  ControlBinop cBinop_f5IHXl58;
-  ControlBinop cBinop_4fYWpMjF;
-  ControlBinop cBinop_5r1OUzKN;
-  ControlBinop cBinop_cyjUUiEB;
-  ControlPack cPack_X3O3xvTy;
-  ControlBinop cBinop_jSR9zS7N;
-  ControlBinop cBinop_NavqPfVK;
-  ControlBinop cBinop_YopcEX5F;
-  ControlBinop cBinop_lyVu0twV;
-  ControlBinop cBinop_7ecYajZQ;
-  ControlBinop cBinop_aLAYvppH;
-  SignalVarf sVarf_sna6KPtA;
-  ControlBinop cBinop_RDIdQCKh;
-  ControlBinop cBinop_dbIjZ05s;
-  ControlBinop cBinop_OdnvGDMS;
-  ControlBinop cBinop_Doptl4KB;
-  ControlBinop cBinop_pF0VBlT7;
-  SignalVarf sVarf_1ozkl1Ar;
-  SignalVarf sVarf_zeHbGhXt;
-  SignalVarf sVarf_NOYgXabI;
-  ControlSlice cSlice_hv3mUgaW;
-  ControlSlice cSlice_XWrWDCcW;
-  ControlBinop cBinop_k1cslq56;
-  ControlBinop cBinop_mFn54KU0;
-  ControlBinop cBinop_nkoqLCHg;
-  ControlBinop cBinop_c0i1xbS9;
-  ControlDelay cDelay_6qAkbHP4;
-  ControlPack cPack_HKhQT7B9;
-  ControlSlice cSlice_FwTqvMn2;
-  ControlSlice cSlice_DcHse9W3;
-  ControlVar cVar_r5ixlHEt;
-  ControlBinop cBinop_HqjECEs6;
-  ControlBinop cBinop_3kpJHHGx;
-  SignalVarf sVarf_DyUZzAkb;
-  ControlBinop cBinop_zGb3Cnpa;
-  ControlBinop cBinop_gcPqtQGi;
-  ControlBinop cBinop_TzI3zrOK;
-  SignalVarf sVarf_7O0Uks8x;
-  ControlDelay cDelay_fsNbhAVw;
-  ControlPack cPack_8rASSedI;
-  ControlSlice cSlice_SQTrpvHR;
-  ControlSlice cSlice_TEczJAdP;
-  ControlVar cVar_9G2w7qnP;
-  ControlBinop cBinop_wtCPn2v7;
-  ControlBinop cBinop_M3xbRzHZ;
-  SignalVarf sVarf_K4mxXcbU;
-  ControlBinop cBinop_WjxnTodE;
-  ControlBinop cBinop_2gqweucP;
-  ControlBinop cBinop_CVrmPTW2;
-  SignalVarf sVarf_8A33dqbR;
-  ControlSlice cSlice_MO4iCVh1;
-  ControlSlice cSlice_QuX5M4S2;
-  ControlBinop cBinop_VbNqWaoC;
-  ControlBinop cBinop_MGu6DZGz;
-  ControlBinop cBinop_hsln8cTe;
-  ControlBinop cBinop_YN6RyC3N;
-  SignalVarf sVarf_LGgQiJgX;
-  SignalVarf sVarf_tfwRhNIy;
-  ControlDelay cDelay_VB784pvz;
-  SignalVarf sVarf_4WWOmkn4;
-  ControlDelay cDelay_BlyG4Dem;
-  ControlDelay cDelay_lesker1N;
-  ControlDelay cDelay_xS27Dv4p;
-  ControlDelay cDelay_nlscGUxB;
-  ControlDelay cDelay_8o62CkX0;
-  ControlIf cIf_eE0PJb50;
-  ControlBinop cBinop_dlGEIEnH;
-  ControlBinop cBinop_JIbo3cDI;
-  ControlBinop cBinop_pCXsFq1U;
-  ControlBinop cBinop_3P1RBOib;
-  ControlBinop cBinop_qdM3r4g0;
-  ControlPack cPack_ydX1v6ep;
-  ControlBinop cBinop_7zgCesuw;
-  ControlBinop cBinop_xCpzb0GP;
-  ControlBinop cBinop_6hJ2N7Mg;
-  ControlBinop cBinop_av6hA3La;
-  ControlBinop cBinop_doxG9FU3;
-  ControlBinop cBinop_E8SMKbju;
-  SignalVarf sVarf_2h60wK8h;
-  ControlBinop cBinop_03KuiZFi;
-  ControlBinop cBinop_m6xlByYI;
-  ControlBinop cBinop_1qw1bhOJ;
-  ControlBinop cBinop_PxyOdmoJ;
-  ControlBinop cBinop_xVrj7M6A;
-  SignalVarf sVarf_kx1tzfa7;
-  SignalVarf sVarf_nFQtbdVq;
-  SignalVarf sVarf_gMuBQaiz;
-  ControlSlice cSlice_jBZVqRID;
-  ControlSlice cSlice_ZxsAnMyr;
-  ControlBinop cBinop_8D0zCOwK;
-  ControlBinop cBinop_BFi55qXh;
-  ControlBinop cBinop_a8Dmzxhi;
-  ControlBinop cBinop_0zmZNoDQ;
-  ControlDelay cDelay_boef1Edm;
-  ControlPack cPack_PKdgj686;
-  ControlSlice cSlice_ZYqqPMEU;
-  ControlSlice cSlice_9r5FvGx8;
-  ControlVar cVar_43FOqtBR;
-  ControlBinop cBinop_sG7uKtCn;
-  ControlBinop cBinop_idtx5U4Z;
-  SignalVarf sVarf_P4bF2htA;
-  ControlBinop cBinop_4484JP4i;
-  ControlBinop cBinop_VS2moOM6;
-  ControlBinop cBinop_uoPduPOh;
-  SignalVarf sVarf_Q2qDb61i;
-  ControlDelay cDelay_0g9RNRzd;
-  ControlPack cPack_zvNQLNNm;
-  ControlSlice cSlice_OT28k0wW;
-  ControlSlice cSlice_dX9iIu2e;
-  ControlVar cVar_PQrhAZRa;
-  ControlBinop cBinop_oqqJ1Paq;
-  ControlBinop cBinop_nbWNwOai;
-  SignalVarf sVarf_Gzvbv7EO;
-  ControlBinop cBinop_7hb1OHvN;
-  ControlBinop cBinop_gspRXxvt;
-  ControlBinop cBinop_Yp2K2bFn;
-  SignalVarf sVarf_9lhwrhxA;
-  ControlSlice cSlice_yX2gZFzd;
-  ControlSlice cSlice_WyVXq3I4;
-  ControlBinop cBinop_qSBIWrss;
-  ControlBinop cBinop_H0Q3gbjl;
-  ControlBinop cBinop_UOds2bwZ;
-  ControlBinop cBinop_4gLdkR2v;
-  SignalVarf sVarf_gG3oyfVr;
-  SignalVarf sVarf_LJPeQeRw;
-  ControlDelay cDelay_ouiGSpqr;
-  SignalVarf sVarf_7P4pkLFI;
-  ControlDelay cDelay_QwttMs34;
-  ControlDelay cDelay_ynpjLAAq;
-  ControlDelay cDelay_8zQ9g5kN;
-  ControlDelay cDelay_S4kddO82;
-  ControlDelay cDelay_IMZb3bj3;
-  ControlIf cIf_ZTxZJeNg;
-  ControlBinop cBinop_WofbqBHk;
-  ControlBinop cBinop_TBS1MzlW;
-  ControlBinop cBinop_H2yxUgdZ;
-  ControlBinop cBinop_93XUb6ci;
-  ControlBinop cBinop_ByESvDhb;
-  ControlPack cPack_Q2kgvi4X;
-  ControlBinop cBinop_TwOQys3E;
-  ControlBinop cBinop_xWe7L4zj;
-  ControlBinop cBinop_Z6h5tmz3;
-  ControlBinop cBinop_K7pbLD1Z;
-  ControlBinop cBinop_OTHnCVRL;
-  ControlBinop cBinop_8hrzCrt9;
-  SignalVarf sVarf_3PZoK8Te;
-  ControlBinop cBinop_ahqchjeT;
-  ControlBinop cBinop_SS75KJNe;
-  ControlBinop cBinop_BpYFlK4l;
-  ControlBinop cBinop_YiTSNoeT;
-  ControlBinop cBinop_FueLORJu;
-  SignalVarf sVarf_4tw7syWZ;
-  SignalVarf sVarf_Uj8v2gts;
-  SignalVarf sVarf_QndJgocL;
-  ControlSlice cSlice_YdkTn2WL;
-  ControlSlice cSlice_IDtSoCz3;
-  ControlBinop cBinop_MCRwxge6;
-  ControlBinop cBinop_yeO0TBWK;
-  ControlBinop cBinop_QFXcKD54;
-  ControlBinop cBinop_uWnhLLWD;
-  ControlDelay cDelay_LNwKVA6h;
-  ControlPack cPack_TPCSHBXT;
-  ControlSlice cSlice_uN0zKAiB;
-  ControlSlice cSlice_gNyzsSj0;
-  ControlVar cVar_mrGWo2hl;
-  ControlBinop cBinop_6kvx4MW1;
-  ControlBinop cBinop_G67N2Obe;
-  SignalVarf sVarf_WdJqQKz5;
-  ControlBinop cBinop_yF8yz2t1;
-  ControlBinop cBinop_tAnpPZo8;
-  ControlBinop cBinop_SRfrcYXZ;
-  SignalVarf sVarf_ya0UY0D5;
-  ControlDelay cDelay_8ZZIXXPz;
-  ControlPack cPack_5500f4rS;
-  ControlSlice cSlice_V7WIm3dA;
-  ControlSlice cSlice_NBtNQH70;
-  ControlVar cVar_2nrwCzMG;
-  ControlBinop cBinop_laWCPJWj;
-  ControlBinop cBinop_XRHl9hCk;
-  SignalVarf sVarf_QJuMdqAL;
-  ControlBinop cBinop_FxqAL3Iz;
-  ControlBinop cBinop_uRKPU5nd;
-  ControlBinop cBinop_QCh9dt7w;
-  SignalVarf sVarf_lbmQbBe1;
-  ControlSlice cSlice_QjjpI8v1;
-  ControlSlice cSlice_mq0IVuSG;
-  ControlBinop cBinop_6TnJ4LDS;
-  ControlBinop cBinop_KuuB7P1e;
-  ControlBinop cBinop_WcuevvmP;
-  ControlBinop cBinop_yktdhsb8;
-  SignalVarf sVarf_bwlmwK6X;
-  SignalVarf sVarf_LY96DS0r;
-  ControlDelay cDelay_FpA49BkW;
-  SignalVarf sVarf_2VaBCHEQ;
-  ControlDelay cDelay_Ksc6L6s1;
-  ControlDelay cDelay_HD4QVfFN;
-  ControlDelay cDelay_kEuwEux7;
-  ControlDelay cDelay_v6eu2VXR;
-  ControlDelay cDelay_kJiO8EHE;
-  ControlIf cIf_CxGKJWrF;
-  ControlBinop cBinop_gRP0w6t1;
-  ControlBinop cBinop_6957mrj0;
-  ControlBinop cBinop_ygZpnClk;
-  ControlBinop cBinop_7R1BuOcK;
-  ControlBinop cBinop_guqgmXzk;
-  ControlPack cPack_IAED51KK;
-  ControlBinop cBinop_SeoxEpEW;
-  ControlBinop cBinop_cqeoyNml;
-  ControlBinop cBinop_j1bGLY45;
-  ControlBinop cBinop_4QbhXBqM;
-  ControlBinop cBinop_LxB78UXU;
-  ControlBinop cBinop_0lbLqOnp;
-  SignalVarf sVarf_p9lZuVC3;
-  ControlBinop cBinop_DujDieyG;
-  ControlBinop cBinop_uW0B7FY8;
-  ControlBinop cBinop_7grpLFXN;
-  ControlBinop cBinop_aCHgNo2I;
-  ControlBinop cBinop_XRrhABpI;
-  SignalVarf sVarf_9dY6u1g9;
-  SignalVarf sVarf_Tln43Iuf;
-  SignalVarf sVarf_jkwvGNGq;
-  ControlSlice cSlice_DP57ivEA;
-  ControlSlice cSlice_Jed3KeQW;
-  ControlBinop cBinop_XWJ2Jqvu;
-  ControlBinop cBinop_1OXqZ6Bg;
-  ControlBinop cBinop_L6DcXzbK;
-  ControlBinop cBinop_nhMYm0st;
-  ControlDelay cDelay_n7LU68W4;
-  ControlPack cPack_Ty4AZCCD;
-  ControlSlice cSlice_eySO46yn;
-  ControlSlice cSlice_KnxapYvS;
-  ControlVar cVar_JD9szZbV;
-  ControlBinop cBinop_CATg6nPr;
-  ControlBinop cBinop_fXBy05cL;
-  SignalVarf sVarf_fNWQjrL4;
-  ControlBinop cBinop_4P51wQVc;
-  ControlBinop cBinop_DZiVayHP;
-  ControlBinop cBinop_21680sPq;
-  SignalVarf sVarf_1LU3jUnE;
-  ControlDelay cDelay_dEFDi52d;
-  ControlPack cPack_uFHXRF1N;
-  ControlSlice cSlice_ADmSntnx;
-  ControlSlice cSlice_S4L3afF2;
-  ControlVar cVar_81HDz8CE;
-  ControlBinop cBinop_l8zt39cL;
-  ControlBinop cBinop_7CG1MZIg;
-  SignalVarf sVarf_XOZLXNvW;
-  ControlBinop cBinop_IX3mHvPq;
-  ControlBinop cBinop_qJXVtB2A;
-  ControlBinop cBinop_BNTxg7wx;
-  SignalVarf sVarf_H49aKc1Z;
-  ControlSlice cSlice_K6SmtxqU;
-  ControlSlice cSlice_BHreXGfs;
-  ControlBinop cBinop_ky3Oc79Z;
-  ControlBinop cBinop_zwbFLVjY;
-  ControlBinop cBinop_5Eah3OBE;
-  ControlBinop cBinop_ajNW3u8W;
-  SignalVarf sVarf_tRrgHLef;
-  SignalVarf sVarf_jvcAXwqO;
-  ControlDelay cDelay_Eru9gouJ;
-  SignalVarf sVarf_wMKdFxWD;
-  ControlDelay cDelay_md93CS7M;
-  ControlDelay cDelay_UvgBzaAj;
-  ControlDelay cDelay_M1nBpgGs;
-  ControlDelay cDelay_9Ftkd6Fy;
-  ControlDelay cDelay_8hDBcNPP;
-  ControlIf cIf_BPYXa7JB;
-  ControlBinop cBinop_2zKbOLUN;
-  ControlBinop cBinop_ZOs8DKQs;
-  ControlBinop cBinop_KK4RoHV1;
-  ControlBinop cBinop_KARnIlLo;
-  ControlBinop cBinop_i9YyF27D;
-  ControlPack cPack_mmRiOoWd;
-  ControlBinop cBinop_LiMj0H1p;
-  ControlBinop cBinop_Iui2p1my;
-  ControlBinop cBinop_oVUrXZdH;
-  ControlBinop cBinop_mrXlugiY;
-  ControlBinop cBinop_Q3fdZqnO;
-  ControlBinop cBinop_1oVhcKAe;
-  SignalVarf sVarf_JwE9URmy;
-  ControlBinop cBinop_nAVnFHzn;
-  ControlBinop cBinop_x5YXpkez;
-  ControlBinop cBinop_PoYID1D7;
-  ControlBinop cBinop_PXx3naOw;
-  ControlBinop cBinop_pGk0g3cc;
-  SignalVarf sVarf_kZnFwfGv;
-  SignalVarf sVarf_uSJzSkBR;
-  SignalVarf sVarf_OHtE4ZXn;
-  ControlSlice cSlice_kpwhR0tf;
-  ControlSlice cSlice_oh4auhT2;
-  ControlBinop cBinop_9GkGoUNy;
-  ControlBinop cBinop_20OqfaGo;
-  ControlBinop cBinop_jZbyfo4f;
-  ControlBinop cBinop_0uc0zW84;
-  ControlDelay cDelay_Gn9nia4s;
-  ControlPack cPack_0FFsXUe9;
-  ControlSlice cSlice_UWPDyIY4;
-  ControlSlice cSlice_5Qfl8Kl3;
-  ControlVar cVar_kyiC1Zf2;
-  ControlBinop cBinop_A5QHofQ9;
-  ControlBinop cBinop_D136IKQ5;
-  SignalVarf sVarf_yvUDRhOv;
-  ControlBinop cBinop_IMhCCKPw;
-  ControlBinop cBinop_r1TUkR2L;
-  ControlBinop cBinop_CZyqnm4Q;
-  SignalVarf sVarf_4J0MldFm;
-  ControlDelay cDelay_i2j9vtBd;
-  ControlPack cPack_EgibIsHG;
-  ControlSlice cSlice_nx6xWTIv;
-  ControlSlice cSlice_nRibR7JK;
-  ControlVar cVar_2ZeHP4qZ;
-  ControlBinop cBinop_3GYF4I39;
-  ControlBinop cBinop_FyKBZYzr;
-  SignalVarf sVarf_14rNbRoM;
-  ControlBinop cBinop_iAd21jN7;
-  ControlBinop cBinop_JuAm7KIS;
-  ControlBinop cBinop_wkitl7VS;
-  SignalVarf sVarf_w0y5ojuv;
-  ControlSlice cSlice_ccZGSBP7;
-  ControlSlice cSlice_Ljp9kzNl;
-  ControlBinop cBinop_HMJc0N5e;
-  ControlBinop cBinop_GLx6aHXJ;
-  ControlBinop cBinop_14YQ1uDS;
-  ControlBinop cBinop_CWI2ECk7;
-  SignalVarf sVarf_xbpI8lwe;
-  SignalVarf sVarf_DiXqbjFE;
-  ControlDelay cDelay_3FZn93hs;
-  SignalVarf sVarf_mprK3PVr;
-  ControlDelay cDelay_rYvigZyQ;
-  ControlDelay cDelay_El2I9C77;
-  ControlDelay cDelay_IQg5PLnG;
-  ControlDelay cDelay_TfNYpGKV;
-  ControlDelay cDelay_SQWhXbuK;
-  ControlIf cIf_7NsIHVOW;
-  ControlBinop cBinop_JsfiF6qC;
-  ControlBinop cBinop_7hjoygWC;
-  ControlBinop cBinop_Pd5lqoR8;
-  ControlBinop cBinop_dx9EgukM;
-  ControlBinop cBinop_HgHg89r7;
-  ControlPack cPack_knDzxs63;
-  ControlBinop cBinop_Lo45ltl1;
-  ControlBinop cBinop_PFUxS9Go;
-  ControlBinop cBinop_Q5wsYYlY;
-  ControlBinop cBinop_RHSLWQjL;
-  ControlBinop cBinop_09LNF0Eg;
-  ControlBinop cBinop_17N4JcCh;
-  SignalVarf sVarf_Zj8nnBuC;
-  ControlBinop cBinop_vTikcOK9;
-  ControlBinop cBinop_4LE3oFAE;
-  ControlBinop cBinop_ghZEl5yM;
-  ControlBinop cBinop_Af1mNKzv;
-  ControlBinop cBinop_XzeBh5jF;
-  SignalVarf sVarf_QC38XxDe;
-  SignalVarf sVarf_U2PPTpXa;
-  SignalVarf sVarf_71RKkz2i;
-  ControlSlice cSlice_05vVwRGe;
-  ControlSlice cSlice_c3nXiTNC;
-  ControlSlice cSlice_z8G0G5Eb;
-  ControlSlice cSlice_2O5lvYJA;
-  ControlSlice cSlice_if4TiRX7;
-  ControlSlice cSlice_lpM95DRE;
-  ControlSlice cSlice_GQUD4Nul;
 };
 
 #endif // _HEAVY_CONTEXT_EP_MK1_HPP_
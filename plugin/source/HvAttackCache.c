@@ -0,0 +1,167 @@
+/**
+ * Copyright (c) 2014-2018 Enzien Audio Ltd.
+ *
+ * Permission to use, copy, modify, and/or distribute this software for any
+ * purpose with or without fee is hereby granted, provided that the above
+ * copyright notice and this permission notice appear in all copies.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL WARRANTIES WITH
+ * REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED WARRANTIES OF MERCHANTABILITY
+ * AND FITNESS. IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR ANY SPECIAL, DIRECT,
+ * INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES WHATSOEVER RESULTING FROM
+ * LOSS OF USE, DATA OR PROFITS, WHETHER IN AN ACTION OF CONTRACT, NEGLIGENCE OR
+ * OTHER TORTIOUS ACTION, ARISING OUT OF OR IN CONNECTION WITH THE USE OR
+ * PERFORMANCE OF THIS SOFTWARE.
+ */
+
+#include "HvAttackCache.h"
+
+#if HV_WIN
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+hv_size_t hAc_init(HvAttackCache *o) {
+  o->header = NULL;
+  o->size = 0;
+  return 0;
+}
+
+static const void *hAc_map(const char *path, hv_size_t *size) {
+#if HV_WIN
+  HANDLE f = CreateFileA(path, GENERIC_READ, FILE_SHARE_READ, NULL, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, NULL);
+  if (f == INVALID_HANDLE_VALUE) return NULL;
+  LARGE_INTEGER n;
+  const void *p = NULL;
+  if (GetFileSizeEx(f, &n) && n.QuadPart >= (LONGLONG) sizeof(HvAttackCacheHeader)) {
+    HANDLE m = CreateFileMappingA(f, NULL, PAGE_READONLY, 0, 0, NULL);
+    if (m != NULL) {
+      p = MapViewOfFile(m, FILE_MAP_READ, 0, 0, 0);
+      CloseHandle(m); // the view keeps the mapping alive
+    }
+    *size = (hv_size_t) n.QuadPart;
+  }
+  CloseHandle(f);
+  return p;
+#else
+  const int fd = open(path, O_RDONLY);
+  if (fd < 0) return NULL;
+  struct stat st;
+  const void *p = NULL;
+  if (fstat(fd, &st) == 0 && st.st_size >= (off_t) sizeof(HvAttackCacheHeader)) {
+    p = mmap(NULL, (size_t) st.st_size, PROT_READ, MAP_SHARED, fd, 0);
+    if (p == MAP_FAILED) p = NULL;
+    *size = (hv_size_t) st.st_size;
+  }
+  close(fd); // the mapping keeps the file open
+  return p;
+#endif
+}
+
+static void hAc_unmap(const void *p, hv_size_t size) {
+#if HV_WIN
+  UnmapViewOfFile(p);
+#else
+  munmap((void *) p, size);
+#endif
+}
+
+bool hAc_open(HvAttackCache *o, const char *path, hv_uint32_t patchHash, hv_uint32_t stateSize, double sampleRate) {
+  hAc_close(o);
+  hv_size_t size = 0;
+  const HvAttackCacheHeader *h = (const HvAttackCacheHeader *) hAc_map(path, &size);
+  if (h == NULL) return false;
+
+  HvAttackCacheHeader g = *h;
+  hAc_initHeader(&g); // recompute the layout from the fields it depends on
+  if (h->magic != HV_ATTACK_CACHE_MAGIC || h->version != HV_ATTACK_CACHE_VERSION
+      || h->patchHash != patchHash || h->stateSize != stateSize || h->sampleRate != sampleRate
+      || h->numLayers == 0 || h->numLayers > HV_ATTACK_CACHE_MAX_LAYERS
+      || h->checkpointFrames == 0 || (h->checkpointFrames & HV_N_SIMD_MASK) || (h->numFrames % h->checkpointFrames)
+      || h->entrySize != g.entrySize
+      || size < __hAc_align(sizeof(HvAttackCacheHeader)) + (hv_size_t) h->numKeys*h->numLayers*h->entrySize) {
+    hAc_unmap(h, size);
+    return false;
+  }
+  o->header = h;
+  o->size = size;
+  return true;
+}
+
+void hAc_close(HvAttackCache *o) {
+  if (o->header != NULL) {
+    hAc_unmap(o->header, o->size);
+    o->header = NULL;
+    o->size = 0;
+  }
+}
+
+void hAc_initHeader(HvAttackCacheHeader *h) {
+  h->magic = HV_ATTACK_CACHE_MAGIC;
+  h->version = HV_ATTACK_CACHE_VERSION;
+  const hv_size_t numCheckpoints = (h->checkpointFrames > 0) ? (h->numFrames/h->checkpointFrames + 1) : 0;
+  h->entrySize = (hv_uint32_t) (__hAc_align(sizeof(HvAttackCacheEntry))
+      + __hAc_align(h->numFrames*sizeof(float))
+      + numCheckpoints*__hAc_align(h->stateSize));
+}
+
+int hAc_getLayer(const HvAttackCacheHeader *h, float velocity) {
+  for (hv_uint32_t i = 0; i < h->numLayers; ++i) {
+    if (h->velocities[i] == velocity) return (int) i;
+  }
+  return -1;
+}
+
+const HvAttackCacheEntry *hAc_getEntry(const HvAttackCache *o, int key, int layer) {
+  const HvAttackCacheHeader *h = o->header;
+  if (h == NULL || key < (int) h->firstKey || key >= (int) (h->firstKey+h->numKeys)) return NULL;
+  hv_assert(layer >= 0 && layer < (int) h->numLayers);
+  const hv_size_t i = (hv_size_t) (key-h->firstKey)*h->numLayers + layer;
+  return (const HvAttackCacheEntry *) (((const char *) h) + __hAc_align(sizeof(HvAttackCacheHeader)) + i*h->entrySize);
+}
+
+bool hAc_write(const char *path, const HvAttackCacheHeader *h,
+    bool (*render)(void *userData, int key, int layer, HvAttackCacheEntry *e), void *userData) {
+  // the temporary file is unique per process, such that concurrent writers do not interleave
+  char tmpPath[1024];
+#if HV_WIN
+  hv_snprintf(tmpPath, sizeof(tmpPath), "%s.%lu.tmp", path, (unsigned long) GetCurrentProcessId());
+#else
+  hv_snprintf(tmpPath, sizeof(tmpPath), "%s.%ld.tmp", path, (long) getpid());
+#endif
+
+  FILE *f = fopen(tmpPath, "wb");
+  if (f == NULL) return false;
+
+  // the header is padded with zeros to the alignment of the first entry
+  const hv_size_t headerSize = __hAc_align(sizeof(HvAttackCacheHeader));
+  const hv_size_t bufferSize = (headerSize > h->entrySize) ? headerSize : h->entrySize;
+  char *const buffer = (char *) hv_malloc(bufferSize);
+  bool ok = (buffer != NULL);
+  if (ok) {
+    hv_memclear(buffer, bufferSize);
+    hv_memcpy(buffer, h, sizeof(HvAttackCacheHeader));
+    ok = (fwrite(buffer, 1, headerSize, f) == headerSize);
+  }
+  for (int i = 0; ok && i < (int) h->numKeys; ++i) {
+    for (int j = 0; ok && j < (int) h->numLayers; ++j) {
+      hv_memclear(buffer, h->entrySize);
+      ok = render(userData, (int) h->firstKey+i, j, (HvAttackCacheEntry *) buffer)
+          && (fwrite(buffer, 1, h->entrySize, f) == h->entrySize);
+    }
+  }
+  hv_free(buffer);
+  ok = (fclose(f) == 0) && ok;
+
+#if HV_WIN
+  ok = ok && MoveFileExA(tmpPath, path, MOVEFILE_REPLACE_EXISTING);
+#else
+  ok = ok && (rename(tmpPath, path) == 0);
+#endif
+  if (!ok) remove(tmpPath);
+  return ok;
+}
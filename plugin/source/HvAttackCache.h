@@ -0,0 +1,115 @@
+/**
+ * Copyright (c) 2014-2018 Enzien Audio Ltd.
+ *
+ * Permission to use, copy, modify, and/or distribute this software for any
+ * purpose with or without fee is hereby granted, provided that the above
+ * copyright notice and this permission notice appear in all copies.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL WARRANTIES WITH
+ * REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED WARRANTIES OF MERCHANTABILITY
+ * AND FITNESS. IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR ANY SPECIAL, DIRECT,
+ * INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES WHATSOEVER RESULTING FROM
+ * LOSS OF USE, DATA OR PROFITS, WHETHER IN AN ACTION OF CONTRACT, NEGLIGENCE OR
+ * OTHER TORTIOUS ACTION, ARISING OUT OF OR IN CONNECTION WITH THE USE OR
+ * PERFORMANCE OF THIS SOFTWARE.
+ */
+
+#ifndef _HEAVY_ATTACK_CACHE_H_
+#define _HEAVY_ATTACK_CACHE_H_
+
+#include "HvUtils.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#define HV_ATTACK_CACHE_MAGIC 0x63417648 // "HvAc"
+#define HV_ATTACK_CACHE_VERSION 2
+#define HV_ATTACK_CACHE_MAX_LAYERS 127 // enough for every MIDI velocity
+
+// all sections of a cache file start on this boundary, such that frames can be loaded as SIMD vectors
+#define HV_ATTACK_CACHE_ALIGNMENT 64
+
+/**
+ * A cache file holds the first numFrames output frames of a voice for every key and velocity layer,
+ * together with copies of the voice state every checkpointFrames frames. Each attack entry is laid out as
+ *   [entry header][numFrames frames][numFrames/checkpointFrames+1 checkpoints of stateSize bytes]
+ * with every section aligned to HV_ATTACK_CACHE_ALIGNMENT bytes. The file is only valid for the patch
+ * build, voice state layout and sample rate that it was rendered with.
+ */
+typedef struct HvAttackCacheHeader {
+  hv_uint32_t magic;
+  hv_uint32_t version;
+  hv_uint32_t patchHash; // identifies the patch and the SIMD backend it was rendered with
+  hv_uint32_t stateSize; // bytes of one voice state checkpoint
+  double sampleRate;
+  hv_uint32_t firstKey;
+  hv_uint32_t numKeys;
+  hv_uint32_t numLayers;
+  hv_uint32_t numFrames; // a multiple of checkpointFrames
+  hv_uint32_t checkpointFrames; // a multiple of HV_N_SIMD
+  hv_uint32_t entrySize; // bytes per attack entry
+  float velocities[HV_ATTACK_CACHE_MAX_LAYERS]; // of each layer, in ascending order
+} HvAttackCacheHeader;
+
+typedef struct HvAttackCacheEntry {
+  // The first frame that may be played from the cache, a multiple of checkpointFrames.
+  // All control events of the note are due before it. numFrames if the attack never settles.
+  hv_uint32_t startFrame;
+} HvAttackCacheEntry;
+
+typedef struct HvAttackCache {
+  const HvAttackCacheHeader *header; // the mapped file, NULL if none
+  hv_size_t size; // bytes mapped
+} HvAttackCache;
+
+hv_size_t hAc_init(HvAttackCache *o);
+
+/**
+ * Maps a cache file read-only, such that several processes share its pages.
+ * Returns false and maps nothing if the file is missing or was rendered for another
+ * patch hash, voice state size or sample rate.
+ */
+bool hAc_open(HvAttackCache *o, const char *path, hv_uint32_t patchHash, hv_uint32_t stateSize, double sampleRate);
+
+void hAc_close(HvAttackCache *o);
+
+static inline bool hAc_isOpen(const HvAttackCache *o) {
+  return (o->header != NULL);
+}
+
+/** Fills in the layout fields of a header from its other fields. */
+void hAc_initHeader(HvAttackCacheHeader *h);
+
+/** Returns the index of the layer of the given velocity, or -1 if it is not cached. */
+int hAc_getLayer(const HvAttackCacheHeader *h, float velocity);
+
+/** Returns the entry of a key and layer, or NULL if the key is not cached. */
+const HvAttackCacheEntry *hAc_getEntry(const HvAttackCache *o, int key, int layer);
+
+static inline hv_size_t __hAc_align(hv_size_t n) {
+  return (n + HV_ATTACK_CACHE_ALIGNMENT-1) & ~((hv_size_t) HV_ATTACK_CACHE_ALIGNMENT-1);
+}
+
+static inline const float *hAc_getFrames(const HvAttackCacheEntry *e) {
+  return (const float *) (((const char *) e) + __hAc_align(sizeof(HvAttackCacheEntry)));
+}
+
+/** Returns the voice state after the first k*checkpointFrames frames of the attack. */
+static inline const void *hAc_getCheckpoint(const HvAttackCacheHeader *h, const HvAttackCacheEntry *e, int k) {
+  return ((const char *) hAc_getFrames(e)) + __hAc_align(h->numFrames*sizeof(float)) + k*__hAc_align(h->stateSize);
+}
+
+/**
+ * Writes a cache file. The render function fills in each entry, which is zeroed beforehand,
+ * and returns false to abort. The file is written next to the path and then renamed onto it,
+ * such that processes that map the path never see a partial file.
+ */
+bool hAc_write(const char *path, const HvAttackCacheHeader *h,
+    bool (*render)(void *userData, int key, int layer, HvAttackCacheEntry *e), void *userData);
+
+#ifdef __cplusplus
+} // extern "C"
+#endif
+
+#endif // _HEAVY_ATTACK_CACHE_H_
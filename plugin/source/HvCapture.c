@@ -0,0 +1,249 @@
+/**
+ * Copyright (c) 2014-2018 Enzien Audio Ltd.
+ *
+ * Permission to use, copy, modify, and/or distribute this software for any
+ * purpose with or without fee is hereby granted, provided that the above
+ * copyright notice and this permission notice appear in all copies.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL WARRANTIES WITH
+ * REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED WARRANTIES OF MERCHANTABILITY
+ * AND FITNESS. IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR ANY SPECIAL, DIRECT,
+ * INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES WHATSOEVER RESULTING FROM
+ * LOSS OF USE, DATA OR PROFITS, WHETHER IN AN ACTION OF CONTRACT, NEGLIGENCE OR
+ * OTHER TORTIOUS ACTION, ARISING OUT OF OR IN CONNECTION WITH THE USE OR
+ * PERFORMANCE OF THIS SOFTWARE.
+ */
+
+#if defined(__linux__) && !defined(_GNU_SOURCE)
+#define _GNU_SOURCE // O_DIRECT
+#endif
+
+#include "HvCapture.h"
+
+#if HV_SERVICE
+
+#if !defined(__linux__)
+#error "HV_SERVICE is only supported on Linux"
+#endif
+
+#include <errno.h>
+#include <fcntl.h>
+#include <string.h>
+#include <time.h>
+#include <unistd.h>
+
+// the header is padded with a JUNK chunk such that the data starts at this offset
+#define HV_CAPTURE_HEADER_SIZE 4096
+
+static void hCp_put16(char *p, hv_uint32_t x) {
+  p[0] = (char) x; p[1] = (char) (x >> 8);
+}
+
+static void hCp_put32(char *p, hv_uint32_t x) {
+  p[0] = (char) x; p[1] = (char) (x >> 8); p[2] = (char) (x >> 16); p[3] = (char) (x >> 24);
+}
+
+// RIFF, fmt (IEEE float), fact, JUNK and data chunk headers, with the given number of frames
+static void hCp_fillHeader(const HvCapture *o, char *h, hv_uint64_t numFrames) {
+  const hv_uint32_t frameSize = (hv_uint32_t) (o->numChannels*sizeof(float));
+  const hv_uint32_t dataSize = (hv_uint32_t) (numFrames*frameSize);
+  hv_memclear(h, HV_CAPTURE_HEADER_SIZE);
+  hv_memcpy(h, "RIFF", 4); hCp_put32(h+4, HV_CAPTURE_HEADER_SIZE-8+dataSize); hv_memcpy(h+8, "WAVE", 4);
+  hv_memcpy(h+12, "fmt ", 4); hCp_put32(h+16, 18);
+  hCp_put16(h+20, 3); // WAVE_FORMAT_IEEE_FLOAT
+  hCp_put16(h+22, (hv_uint32_t) o->numChannels);
+  hCp_put32(h+24, (hv_uint32_t) o->sampleRate);
+  hCp_put32(h+28, (hv_uint32_t) o->sampleRate*frameSize);
+  hCp_put16(h+32, frameSize);
+  hCp_put16(h+34, 32);
+  hCp_put16(h+36, 0); // no extension
+  hv_memcpy(h+38, "fact", 4); hCp_put32(h+42, 4); hCp_put32(h+46, (hv_uint32_t) numFrames);
+  hv_memcpy(h+50, "JUNK", 4); hCp_put32(h+54, HV_CAPTURE_HEADER_SIZE-66);
+  hv_memcpy(h+HV_CAPTURE_HEADER_SIZE-8, "data", 4); hCp_put32(h+HV_CAPTURE_HEADER_SIZE-4, dataSize);
+}
+
+static bool hCp_writeAll(HvCapture *o, const void *p, hv_size_t n) {
+  for (const char *c = (const char *) p; n > 0;) {
+    const ssize_t k = write(o->fd, c, n);
+    if (k < 0 && errno == EINTR) continue;
+    if (k <= 0) {
+      ++o->numWriteErrors;
+      return false;
+    }
+    c += k;
+    n -= (hv_size_t) k;
+  }
+  return true;
+}
+
+static bool hCp_startFile(HvCapture *o) {
+  char path[1100];
+  hv_snprintf(path, sizeof(path), "%s-%04u.wav", o->prefix, o->fileIndex++);
+  o->fd = open(path, O_WRONLY | O_CREAT | O_TRUNC | (o->direct ? O_DIRECT : 0), 0644);
+  if (o->fd < 0 && o->direct) {
+    // not every file system supports O_DIRECT
+    fprintf(stderr, "heavy: could not open %s with O_DIRECT, writing it through the page cache.\n", path);
+    o->direct = false;
+    o->fd = open(path, O_WRONLY | O_CREAT | O_TRUNC, 0644);
+  }
+  if (o->fd < 0) {
+    fprintf(stderr, "heavy: could not open %s: %s\n", path, strerror(errno));
+    ++o->numWriteErrors;
+    return false;
+  }
+  o->fileFrames = 0;
+  // the buffer is empty between files, the header is written from it as it is aligned
+  hCp_fillHeader(o, (char *) o->buffer, 0);
+  return hCp_writeAll(o, o->buffer, HV_CAPTURE_HEADER_SIZE);
+}
+
+static void hCp_finishFile(HvCapture *o) {
+  if (o->fd < 0) return;
+  // neither the tail nor the final header are aligned writes, so they go through the page cache
+  if (o->direct) fcntl(o->fd, F_SETFL, fcntl(o->fd, F_GETFL) & ~O_DIRECT);
+  if (o->bufferFill > 0) {
+    hCp_writeAll(o, o->buffer, o->bufferFill*o->numChannels*sizeof(float));
+    o->bufferFill = 0;
+  }
+  char h[HV_CAPTURE_HEADER_SIZE];
+  hCp_fillHeader(o, h, o->fileFrames);
+  if (pwrite(o->fd, h, sizeof(h), 0) != (ssize_t) sizeof(h)) ++o->numWriteErrors;
+  close(o->fd);
+  o->fd = -1;
+}
+
+// moves all frames in the ring into files
+static void hCp_drain(HvCapture *o) {
+  for (;;) {
+    // all frames up to the write index are complete, see hCp_write()
+    const hv_uint32_t r = o->readIndex;
+    const hv_uint32_t available = o->writeIndex - r;
+    if (available == 0) break;
+    if (o->fd < 0 && !hCp_startFile(o)) {
+      o->readIndex = r + available; // the frames are lost
+      break;
+    }
+
+    hv_uint32_t n = hv_min_ui(available, HV_CAPTURE_BUFFER_FRAMES - o->bufferFill);
+    if (o->maxFileFrames > 0 && o->fileFrames + n > o->maxFileFrames) {
+      n = (hv_uint32_t) (o->maxFileFrames - o->fileFrames);
+    }
+    const hv_uint32_t i = r & (HV_CAPTURE_CAPACITY-1);
+    const hv_uint32_t n0 = hv_min_ui(n, HV_CAPTURE_CAPACITY-i);
+    float *const b = o->buffer + o->bufferFill*o->numChannels;
+    for (int k = 0; k < o->numChannels; ++k) {
+      const float *const ring = o->ring + k*HV_CAPTURE_CAPACITY;
+      for (hv_uint32_t j = 0; j < n0; ++j) b[j*o->numChannels+k] = ring[i+j];
+      for (hv_uint32_t j = n0; j < n; ++j) b[j*o->numChannels+k] = ring[j-n0];
+    }
+    o->readIndex = r + n;
+    o->bufferFill += n;
+    o->fileFrames += n;
+    o->numFrames += n;
+
+    if (o->bufferFill == HV_CAPTURE_BUFFER_FRAMES) {
+      hCp_writeAll(o, o->buffer, HV_CAPTURE_BUFFER_FRAMES*o->numChannels*sizeof(float));
+      o->bufferFill = 0;
+    }
+    if (o->maxFileFrames > 0 && o->fileFrames == o->maxFileFrames) hCp_finishFile(o);
+  }
+
+  const hv_uint32_t numDroppedFrames = o->numDroppedFrames;
+  if (numDroppedFrames != o->numReportedDroppedFrames) {
+    fprintf(stderr, "heavy: capture dropped %u frames (%u new), the writer cannot keep up\n",
+        numDroppedFrames, numDroppedFrames-o->numReportedDroppedFrames);
+    o->numReportedDroppedFrames = numDroppedFrames;
+  }
+}
+
+static void *hCp_run(void *x) {
+  HvCapture *const o = (HvCapture *) x;
+  const struct timespec period = { 0, HV_CAPTURE_WRITER_MS*1000000L };
+  while (o->running) {
+    nanosleep(&period, NULL);
+    hCp_drain(o);
+  }
+  return NULL;
+}
+
+hv_size_t hCp_init(HvCapture *o) {
+  o->ring = NULL;
+  o->buffer = NULL;
+  o->fd = -1;
+  o->running = false;
+  return 0;
+}
+
+bool hCp_open(HvCapture *o, const char *prefix, int numChannels, double sampleRate,
+    double maxSeconds, hv_uint64_t maxBytes, bool direct) {
+  hv_assert(numChannels > 0 && sampleRate > 0.0);
+  hCp_close(o);
+
+  // the ring and the buffer are mapped here, such that the threads never fault on them
+  const hv_size_t ringSize = (hv_size_t) numChannels*HV_CAPTURE_CAPACITY*sizeof(float);
+  const hv_size_t bufferSize = (hv_size_t) numChannels*HV_CAPTURE_BUFFER_FRAMES*sizeof(float);
+  void *ring = NULL, *buffer = NULL;
+  if (posix_memalign(&ring, HV_CAPTURE_HEADER_SIZE, ringSize) != 0) return false;
+  if (posix_memalign(&buffer, HV_CAPTURE_HEADER_SIZE, bufferSize) != 0) {
+    free(ring);
+    return false;
+  }
+  hv_memclear(ring, ringSize);
+  hv_memclear(buffer, bufferSize);
+  o->ring = (float *) ring;
+  o->buffer = (float *) buffer;
+  o->numChannels = numChannels;
+  o->writeIndex = 0;
+  o->readIndex = 0;
+  o->numDroppedFrames = 0;
+  o->numReportedDroppedFrames = 0;
+
+  char date[32];
+  const time_t now = time(NULL);
+  struct tm t;
+  strftime(date, sizeof(date), "%Y%m%d-%H%M%S", localtime_r(&now, &t));
+  hv_snprintf(o->prefix, sizeof(o->prefix), "%s-%s", prefix, date);
+  o->sampleRate = sampleRate;
+  o->direct = direct;
+  o->bufferFill = 0;
+  o->fd = -1;
+  o->fileIndex = 0;
+  o->fileFrames = 0;
+  o->numFrames = 0;
+  o->numWriteErrors = 0;
+
+  // the 32-bit sizes of the header limit a file to 4 GB
+  const hv_uint64_t frameSize = (hv_uint64_t) numChannels*sizeof(float);
+  o->maxFileFrames = (0xFFFFFFFFULL - HV_CAPTURE_HEADER_SIZE)/frameSize;
+  const hv_uint64_t maxSecondsFrames = (hv_uint64_t) (maxSeconds*sampleRate);
+  const hv_uint64_t maxBytesFrames = (maxBytes > frameSize) ? (maxBytes/frameSize) : 1;
+  if (maxSeconds > 0.0 && maxSecondsFrames > 0 && maxSecondsFrames < o->maxFileFrames) o->maxFileFrames = maxSecondsFrames;
+  if (maxBytes > 0 && maxBytesFrames < o->maxFileFrames) o->maxFileFrames = maxBytesFrames;
+
+  o->running = true;
+  if (pthread_create(&o->writer, NULL, &hCp_run, o) != 0) {
+    o->running = false;
+    hCp_close(o);
+    return false;
+  }
+  return true;
+}
+
+void hCp_close(HvCapture *o) {
+  if (o->running) {
+    o->running = false;
+    pthread_join(o->writer, NULL);
+  }
+  if (o->ring != NULL) {
+    hCp_drain(o);
+    hCp_finishFile(o);
+    fprintf(stderr, "heavy: captured %llu frames to %u files in %s-*, %u frames dropped, %u write errors\n",
+        (unsigned long long) o->numFrames, o->fileIndex, o->prefix, o->numDroppedFrames, o->numWriteErrors);
+  }
+  free(o->ring);
+  free(o->buffer);
+  o->ring = NULL;
+  o->buffer = NULL;
+}
+
+#endif // HV_SERVICE
@@ -0,0 +1,132 @@
+/**
+ * Copyright (c) 2014-2018 Enzien Audio Ltd.
+ *
+ * Permission to use, copy, modify, and/or distribute this software for any
+ * purpose with or without fee is hereby granted, provided that the above
+ * copyright notice and this permission notice appear in all copies.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL WARRANTIES WITH
+ * REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED WARRANTIES OF MERCHANTABILITY
+ * AND FITNESS. IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR ANY SPECIAL, DIRECT,
+ * INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES WHATSOEVER RESULTING FROM
+ * LOSS OF USE, DATA OR PROFITS, WHETHER IN AN ACTION OF CONTRACT, NEGLIGENCE OR
+ * OTHER TORTIOUS ACTION, ARISING OUT OF OR IN CONNECTION WITH THE USE OR
+ * PERFORMANCE OF THIS SOFTWARE.
+ */
+
+#ifndef _HEAVY_CAPTURE_H_
+#define _HEAVY_CAPTURE_H_
+
+#include "HvUtils.h"
+
+/**
+ * Records the output of the process thread to 32-bit float WAV files, part of the HV_SERVICE
+ * build (see HvService.h). Linux only.
+ *
+ * The process thread copies each block into a preallocated ring, one memcpy per channel, and
+ * never waits. A writer thread drains the ring every HV_CAPTURE_WRITER_MS, interleaves the frames
+ * into an aligned buffer and writes it out HV_CAPTURE_BUFFER_FRAMES frames at a time, optionally
+ * with O_DIRECT. The data of each file starts at a 4 KB boundary behind a padded header, so that
+ * all full writes are aligned. Blocks that do not fit into the ring are dropped and counted.
+ *
+ * Files are named <prefix>-<date>-<time>-<n>.wav after the time the capture was opened, and a
+ * new file is started whenever one reaches the given duration or size, and at 4 GB at the latest.
+ */
+
+#ifndef HV_SERVICE
+#define HV_SERVICE 0
+#endif
+
+#if HV_SERVICE
+
+#include <pthread.h>
+
+// frames per channel held by the ring, a power of two
+#ifndef HV_CAPTURE_CAPACITY
+#define HV_CAPTURE_CAPACITY 131072
+#endif
+
+// frames per write, such that every write is a multiple of 4 KB
+#define HV_CAPTURE_BUFFER_FRAMES 32768
+
+// period of the writer thread in milliseconds
+#define HV_CAPTURE_WRITER_MS 20
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*
+ * The ring assumes a single producer thread and a single consumer thread, see HvLightPipe.
+ */
+typedef struct HvCapture {
+  float *ring; // HV_CAPTURE_CAPACITY frames of each channel in turn, NULL if closed
+  int numChannels;
+  volatile hv_uint32_t writeIndex; // only advanced by the process thread
+  volatile hv_uint32_t readIndex; // only advanced by the writer thread
+  volatile hv_uint32_t numDroppedFrames; // frames that did not fit into the ring
+
+  // writer thread state
+  pthread_t writer;
+  volatile bool running;
+  char prefix[1024]; // with the date and time of opening
+  double sampleRate;
+  hv_uint64_t maxFileFrames;
+  bool direct;
+  float *buffer; // HV_CAPTURE_BUFFER_FRAMES interleaved frames, aligned to 4 KB
+  hv_uint32_t bufferFill; // frames
+  int fd; // of the current file, -1 if none
+  hv_uint32_t fileIndex; // of the next file
+  hv_uint64_t fileFrames; // frames written to the current file
+  hv_uint64_t numFrames; // frames written to all files
+  hv_uint32_t numWriteErrors;
+  hv_uint32_t numReportedDroppedFrames;
+} HvCapture;
+
+hv_size_t hCp_init(HvCapture *o);
+
+/**
+ * Allocates the ring and starts the writer thread. A new file is started every maxSeconds seconds
+ * or maxBytes bytes of audio, whichever comes first, zero for no limit. Returns false if the
+ * capture could not be started.
+ */
+bool hCp_open(HvCapture *o, const char *prefix, int numChannels, double sampleRate,
+    double maxSeconds, hv_uint64_t maxBytes, bool direct);
+
+/** Stops the writer thread after it has written everything in the ring, and completes the last file. */
+void hCp_close(HvCapture *o);
+
+static inline bool hCp_isOpen(const HvCapture *o) {
+  return (o->ring != NULL);
+}
+
+/** Called by the process thread with each block of numChannels channels, NULL for a silent block. */
+static inline void hCp_write(HvCapture *o, const float *const *channels, hv_uint32_t n) {
+  const hv_uint32_t w = o->writeIndex;
+  if (HV_CAPTURE_CAPACITY - (w - o->readIndex) < n) {
+    o->numDroppedFrames = o->numDroppedFrames+n;
+    return;
+  }
+  const hv_uint32_t i = w & (HV_CAPTURE_CAPACITY-1);
+  const hv_uint32_t n0 = hv_min_ui(n, HV_CAPTURE_CAPACITY-i); // frames before the ring wraps
+  for (int k = 0; k < o->numChannels; ++k) {
+    float *const ring = o->ring + k*HV_CAPTURE_CAPACITY;
+    if (channels == NULL) {
+      hv_memclear(ring+i, n0*sizeof(float));
+      if (n0 < n) hv_memclear(ring, (n-n0)*sizeof(float));
+    } else {
+      hv_memcpy(ring+i, channels[k], n0*sizeof(float));
+      if (n0 < n) hv_memcpy(ring, channels[k]+n0, (n-n0)*sizeof(float));
+    }
+  }
+  hv_sfence(); // the frames must be complete before the writer can see them
+  o->writeIndex = w+n;
+}
+
+#ifdef __cplusplus
+} // extern "C"
+#endif
+
+#endif // HV_SERVICE
+
+#endif // _HEAVY_CAPTURE_H_
@@ -21,7 +21,7 @@ hv_size_t cBinop_init(ControlBinop *o, float k) {
   return 0;
 }
 
-static float cBinop_perform_op(BinopType op, float f, float k) {
+float cBinop_perform_op(BinopType op, float f, float k) {
   switch (op) {
     case HV_BINOP_ADD: return f + k;
     case HV_BINOP_SUBTRACT: return f - k;
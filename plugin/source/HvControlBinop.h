@@ -56,6 +56,12 @@ typedef struct ControlBinop {
 
 hv_size_t cBinop_init(ControlBinop *o, float k);
 
+/**
+ * Returns f op k as the binop objects evaluate it. Native message paths use it to stay
+ * bit-identical to the graph whatever the compiler would make of the arithmetic inline.
+ */
+float cBinop_perform_op(BinopType op, float f, float k);
+
 void cBinop_onMessage(HeavyContextInterface *_c, ControlBinop *o, BinopType op, int letIn,
     const HvMessage *m,
     void (*sendMessage)(HeavyContextInterface *, int, const HvMessage *));
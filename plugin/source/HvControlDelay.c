@@ -16,58 +16,75 @@
 
 #include "HvControlDelay.h"
 
-hv_size_t cDelay_init(HeavyContextInterface *_c, ControlDelay *o, float delayMs) {
-  o->delay = hv_millisecondsToSamples(_c, delayMs);
-  hv_memclear(o->msgs, __HV_DELAY_MAX_MESSAGES*sizeof(HvMessage *));
+hv_size_t cDelay_init(ControlDelay *o, HvMessageQueue *mq, double sampleRate, float delayMs) {
+  o->sampleRate = sampleRate;
+  o->mq = mq;
+  o->delay = hv_millisecondsToSamples_r(o->sampleRate, delayMs);
+  o->head = NULL;
+  o->tail = NULL;
   return 0;
 }
 
+// keeps the pending nodes in the order of the message queue, searching from the latest one
+static void cDelay_link(ControlDelay *o, MessageNode *n) {
+  const hv_uint32_t ts = msg_getTimestamp(mq_node_getMessage(n));
+  MessageNode *node = o->tail;
+  while (node != NULL && msg_isTimestampBefore(ts, msg_getTimestamp(mq_node_getMessage(node)))) {
+    node = node->objPrev;
+  }
+  n->objPrev = node;
+  if (node != NULL) {
+    n->objNext = node->objNext;
+    node->objNext = n;
+  } else {
+    n->objNext = o->head;
+    o->head = n;
+  }
+  if (n->objNext != NULL) n->objNext->objPrev = n;
+  else o->tail = n;
+}
+
+static void cDelay_unlink(ControlDelay *o, MessageNode *n) {
+  if (n->objPrev != NULL) n->objPrev->objNext = n->objNext;
+  else o->head = n->objNext;
+  if (n->objNext != NULL) n->objNext->objPrev = n->objPrev;
+  else o->tail = n->objPrev;
+  n->objPrev = NULL;
+  n->objNext = NULL;
+}
+
+// sends a copy of the pending message now, after taking it out of the queue
+static void cDelay_flushNode(HeavyContextInterface *_c, ControlDelay *o, MessageNode *n, hv_uint32_t timestamp,
+    void (*sendMessage)(HeavyContextInterface *, int, const HvMessage *)) {
+  const HvMessage *const m = mq_node_getMessage(n);
+  HvMessage *f = (HvMessage *) hv_alloca(msg_getSize(m));
+  hv_memcpy(f, m, msg_getSize(m));
+  cDelay_unlink(o, n);
+  mq_removeNode(o->mq, n);
+  msg_setTimestamp(f, timestamp);
+  sendMessage(_c, 0, f);
+}
+
 void cDelay_onMessage(HeavyContextInterface *_c, ControlDelay *o, int letIn, const HvMessage *m,
     void (*sendMessage)(HeavyContextInterface *, int, const HvMessage *)) {
   switch (letIn) {
     case 0: {
-      if (msg_compareSymbol(m, 0, "flush")) {
-        // send all messages immediately
-        for (int i = 0; i < __HV_DELAY_MAX_MESSAGES; i++) {
-          HvMessage *n = o->msgs[i];
-          if (n != NULL) {
-            msg_setTimestamp(n, msg_getTimestamp(m)); // update the timestamp to now
-            sendMessage(_c, 0, n); // send the message
-            hv_cancelMessage(_c, n, sendMessage); // then clear it
-            // NOTE(mhroth): there may be a problem here if a flushed message causes a clear message to return
-            // to this object in the same step
-          }
+      if (msg_compareHash(m, 0, HV_MSG_HASH_FLUSH)) {
+        // send all messages immediately, a flushed message may clear the remaining ones
+        while (o->head != NULL) {
+          cDelay_flushNode(_c, o, o->head, msg_getTimestamp(m), sendMessage);
         }
-        hv_memclear(o->msgs, __HV_DELAY_MAX_MESSAGES*sizeof(HvMessage *));
-      } else if (msg_compareSymbol(m, 0, "clear")) {
-        // cancel (clear) all (pending) messages
-        for (int i = 0; i < __HV_DELAY_MAX_MESSAGES; i++) {
-          HvMessage *n = o->msgs[i];
-          if (n != NULL) {
-            hv_cancelMessage(_c, n, sendMessage);
-          }
-        }
-        hv_memclear(o->msgs, __HV_DELAY_MAX_MESSAGES*sizeof(HvMessage *));
+      } else if (msg_compareHash(m, 0, HV_MSG_HASH_CLEAR)) {
+        cDelay_clear(o);
       } else {
-        hv_uint32_t ts = msg_getTimestamp(m);
-        msg_setTimestamp((HvMessage *) m, ts+o->delay); // update the timestamp to set the delay
-        int i;
-        for (i = 0; i < __HV_DELAY_MAX_MESSAGES; i++) {
-          if (o->msgs[i] == NULL) {
-            o->msgs[i] = hv_scheduleMessageForObject(_c, m, sendMessage, 0);
-            break;
-          }
-        }
-        hv_assert((i < __HV_DELAY_MAX_MESSAGES) && // scheduled message limit reached
-            "[__delay] cannot track any more messages. Try increasing the size of __HV_DELAY_MAX_MESSAGES.");
-        msg_setTimestamp((HvMessage *) m, ts); // return to the original timestamp
+        cDelay_schedule(o, m, sendMessage);
       }
       break;
     }
     case 1: {
       if (msg_isFloat(m,0)) {
         // set delay in milliseconds (cannot be negative!)
-        o->delay = hv_millisecondsToSamples(_c, msg_getFloat(m,0));
+        o->delay = hv_millisecondsToSamples_r(o->sampleRate, msg_getFloat(m,0));
       }
       break;
     }
@@ -82,11 +99,30 @@ void cDelay_onMessage(HeavyContextInterface *_c, ControlDelay *o, int letIn, con
   }
 }
 
+void cDelay_clear(ControlDelay *o) {
+  // cancel (clear) all (pending) messages
+  while (o->head != NULL) {
+    MessageNode *n = o->head;
+    cDelay_unlink(o, n);
+    mq_removeNode(o->mq, n);
+  }
+}
+
+void cDelay_schedule(ControlDelay *o, const HvMessage *m,
+    void (*sendMessage)(HeavyContextInterface *, int, const HvMessage *)) {
+  hv_uint32_t ts = msg_getTimestamp(m);
+  msg_setTimestamp((HvMessage *) m, ts+o->delay); // update the timestamp to set the delay
+  cDelay_link(o, mq_addNodeByTimestamp(o->mq, m, 0, sendMessage));
+  msg_setTimestamp((HvMessage *) m, ts); // return to the original timestamp
+}
+
 void cDelay_clearExecutingMessage(ControlDelay *o, const HvMessage *m) {
-  for (int i = 0; i < __HV_DELAY_MAX_MESSAGES; ++i) {
-    if (o->msgs[i] == m) {
-      o->msgs[i] = NULL;
+  // the message being sent is the one due first, unless it was already flushed or cleared
+  for (MessageNode *n = o->head; n != NULL; n = n->objNext) {
+    if (mq_node_getMessage(n) == m) {
+      cDelay_unlink(o, n);
       break;
     }
+    if (msg_isTimestampBefore(msg_getTimestamp(m), msg_getTimestamp(mq_node_getMessage(n)))) break;
   }
 }
@@ -17,8 +17,6 @@
 #ifndef _HEAVY_CONTROL_DELAY_H_
 #define _HEAVY_CONTROL_DELAY_H_
 
-#define __HV_DELAY_MAX_MESSAGES 8
-
 #include "HvHeavyInternal.h"
 
 #ifdef __cplusplus
@@ -27,16 +25,34 @@ extern "C" {
 
 typedef struct ControlDelay {
   hv_uint32_t delay; // delay in samples
-  HvMessage *msgs[__HV_DELAY_MAX_MESSAGES];
+  double sampleRate;
+  HvMessageQueue *mq; // the message queue of the context, which schedules the pending messages
+  // the queue nodes of all pending messages in the order they are due, chained through their
+  // objPrev and objNext fields, such that any number can be scheduled and each one cancelled directly
+  MessageNode *head;
+  MessageNode *tail;
 } ControlDelay;
 
-hv_size_t cDelay_init(HeavyContextInterface *_c, ControlDelay *o, float delayMs);
+hv_size_t cDelay_init(ControlDelay *o, HvMessageQueue *mq, double sampleRate, float delayMs);
 
 void cDelay_onMessage(HeavyContextInterface *_c, ControlDelay *o, int letIn, const HvMessage *m,
     void (*sendMessage)(HeavyContextInterface *, int, const HvMessage *));
 
 void cDelay_clearExecutingMessage(ControlDelay *o, const HvMessage *m);
 
+/** Cancels all pending messages, as a [clear( message does. */
+void cDelay_clear(ControlDelay *o);
+
+/** Schedules a copy of m to be sent after the delay, as any other message to the left inlet does. */
+void cDelay_schedule(ControlDelay *o, const HvMessage *m,
+    void (*sendMessage)(HeavyContextInterface *, int, const HvMessage *));
+
+/** Forgets the pending messages, once the message queue has been cleared without sending them. */
+static inline void cDelay_forgetPending(ControlDelay *o) {
+  o->head = NULL;
+  o->tail = NULL;
+}
+
 #ifdef __cplusplus
 } // extern "C"
 #endif
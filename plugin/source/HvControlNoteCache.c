@@ -0,0 +1,40 @@
+/**
+ * Copyright (c) 2014-2018 Enzien Audio Ltd.
+ *
+ * Permission to use, copy, modify, and/or distribute this software for any
+ * purpose with or without fee is hereby granted, provided that the above
+ * copyright notice and this permission notice appear in all copies.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL WARRANTIES WITH
+ * REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED WARRANTIES OF MERCHANTABILITY
+ * AND FITNESS. IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR ANY SPECIAL, DIRECT,
+ * INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES WHATSOEVER RESULTING FROM
+ * LOSS OF USE, DATA OR PROFITS, WHETHER IN AN ACTION OF CONTRACT, NEGLIGENCE OR
+ * OTHER TORTIOUS ACTION, ARISING OUT OF OR IN CONNECTION WITH THE USE OR
+ * PERFORMANCE OF THIS SOFTWARE.
+ */
+
+#include "HvControlNoteCache.h"
+
+hv_size_t cNoteCache_init(ControlNoteCache *o) {
+  for (int i = 0; i < HV_NOTE_CACHE_NUM_KEYS; ++i) {
+    // evaluated exactly as the binop chain does, such that the cached values are bit-identical
+    const float x = ((float) i - 69.0f) / 12.0f;
+    o->frequency[i] = hv_pow_f(2.0f, x) * 440.0f;
+  }
+  return 0;
+}
+
+bool cNoteCache_onMessage(HeavyContextInterface *_c, ControlNoteCache *o, const HvMessage *m,
+    void (*sendMessage)(HeavyContextInterface *, int, const HvMessage *)) {
+  if (msg_isFloat(m,0) && !msg_isFloat(m,1)) {
+    const float f = msg_getFloat(m,0);
+    if (cNoteCache_hasKey(f)) {
+      HvMessage *n = HV_MESSAGE_ON_STACK(1);
+      msg_initWithFloat(n, msg_getTimestamp(m), o->frequency[(int) f]);
+      sendMessage(_c, 0, n);
+      return true;
+    }
+  }
+  return false;
+}
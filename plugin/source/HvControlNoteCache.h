@@ -0,0 +1,57 @@
+/**
+ * Copyright (c) 2014-2018 Enzien Audio Ltd.
+ *
+ * Permission to use, copy, modify, and/or distribute this software for any
+ * purpose with or without fee is hereby granted, provided that the above
+ * copyright notice and this permission notice appear in all copies.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL WARRANTIES WITH
+ * REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED WARRANTIES OF MERCHANTABILITY
+ * AND FITNESS. IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR ANY SPECIAL, DIRECT,
+ * INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES WHATSOEVER RESULTING FROM
+ * LOSS OF USE, DATA OR PROFITS, WHETHER IN AN ACTION OF CONTRACT, NEGLIGENCE OR
+ * OTHER TORTIOUS ACTION, ARISING OUT OF OR IN CONNECTION WITH THE USE OR
+ * PERFORMANCE OF THIS SOFTWARE.
+ */
+
+#ifndef _HEAVY_CONTROL_NOTE_CACHE_H_
+#define _HEAVY_CONTROL_NOTE_CACHE_H_
+
+#include "HvHeavyInternal.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#define HV_NOTE_CACHE_NUM_KEYS 128
+
+/**
+ * An mtof table: the result of a patch's mtof chain, [- 69] -> [/ 12] -> [pow 2] -> [* 440], for
+ * every MIDI key. The table is filled when the context is created, so a note-on only indexes it.
+ * Only the frequency is cached. Whatever is derived from it (periods, scalings, filter
+ * coefficients) is still computed on each note, since it also depends on state that other
+ * messages set. Phasors convert it to a step without a division, see sPhasor_k_init().
+ */
+typedef struct ControlNoteCache {
+  float frequency[HV_NOTE_CACHE_NUM_KEYS]; // Hz
+} ControlNoteCache;
+
+hv_size_t cNoteCache_init(ControlNoteCache *o);
+
+/** Returns true if f names a MIDI key, i.e. if its frequency is cached. */
+static inline bool cNoteCache_hasKey(float f) {
+  return (f >= 0.0f) && (f < (float) HV_NOTE_CACHE_NUM_KEYS) && (f == (float) ((int) f));
+}
+
+/**
+ * If the message is a single float naming a MIDI key, its cached frequency is sent and true is returned.
+ * Otherwise (fractional pitches, lists) nothing is sent and the caller must run the full chain.
+ */
+bool cNoteCache_onMessage(HeavyContextInterface *_c, ControlNoteCache *o, const HvMessage *m,
+    void (*sendMessage)(HeavyContextInterface *, int, const HvMessage *));
+
+#ifdef __cplusplus
+} // extern "C"
+#endif
+
+#endif // _HEAVY_CONTROL_NOTE_CACHE_H_
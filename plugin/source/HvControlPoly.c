@@ -0,0 +1,112 @@
+/**
+ * Copyright (c) 2014-2018 Enzien Audio Ltd.
+ *
+ * Permission to use, copy, modify, and/or distribute this software for any
+ * purpose with or without fee is hereby granted, provided that the above
+ * copyright notice and this permission notice appear in all copies.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL WARRANTIES WITH
+ * REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED WARRANTIES OF MERCHANTABILITY
+ * AND FITNESS. IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR ANY SPECIAL, DIRECT,
+ * INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES WHATSOEVER RESULTING FROM
+ * LOSS OF USE, DATA OR PROFITS, WHETHER IN AN ACTION OF CONTRACT, NEGLIGENCE OR
+ * OTHER TORTIOUS ACTION, ARISING OUT OF OR IN CONNECTION WITH THE USE OR
+ * PERFORMANCE OF THIS SOFTWARE.
+ */
+
+#include "HvControlPoly.h"
+
+hv_size_t cPoly_init(ControlPoly *o, int numVoices, HvTable *pitches, HvTable *used, HvTable *ids,
+    ControlVar *serial, ControlBinop *maxVoiceId, ControlIf *steal, ControlIf *stealGate) {
+  o->pitches = pitches;
+  o->used = used;
+  o->ids = ids;
+  o->serial = serial;
+  o->maxVoiceId = maxVoiceId;
+  o->steal = steal;
+  o->stealGate = stealGate;
+  o->numVoices = numVoices;
+  return 0;
+}
+
+// hands out the next serial, wrapping around as [mod] does in the graph
+static float cPoly_nextSerial(ControlPoly *o) {
+  const float k = o->maxVoiceId->k;
+  float f = (o->serial->type == HV_MSG_FLOAT) ? o->serial->e.data.f : 0.0f;
+  f = (k == 0.0f) ? 0.0f : (float) ((int) f % (int) k);
+  if (f < 0.0f) f += hv_abs_f(k);
+  o->serial->type = HV_MSG_FLOAT;
+  o->serial->e.data.f = f + 1.0f;
+  return f;
+}
+
+static void cPoly_sendNote(HeavyContextInterface *_c, int voice, float pitch, float velocity,
+    hv_uint32_t timestamp, void (*sendMessage)(HeavyContextInterface *, int, const HvMessage *)) {
+  HvMessage *n = HV_MESSAGE_ON_STACK(2);
+  msg_init(n, 2, timestamp);
+  msg_setFloat(n, 0, pitch);
+  msg_setFloat(n, 1, velocity);
+  sendMessage(_c, voice, n);
+}
+
+bool cPoly_onMessage(HeavyContextInterface *_c, ControlPoly *o, const HvMessage *m,
+    void (*sendMessage)(HeavyContextInterface *, int, const HvMessage *)) {
+  if (msg_getNumElements(m) != 3 || !msg_isFloat(m,0) || !msg_isFloat(m,1) || !msg_isFloat(m,2)) {
+    return false;
+  }
+  const float f = msg_getFloat(m,0);
+  const float vel = msg_getFloat(m,1);
+  if (vel != vel) return false; // leave NaN to the graph
+
+  float *const pitches = hTable_getBuffer(o->pitches);
+  float *const used = hTable_getBuffer(o->used);
+  float *const ids = hTable_getBuffer(o->ids);
+  const float maxId = o->maxVoiceId->k;
+  const hv_uint32_t ts = msg_getTimestamp(m);
+
+  if (vel > 0.0f) {
+    // take the free voice that has been released the longest, and steal the oldest sounding one
+    // if the gate is open. The gate follows the steal flag on each note-on, i.e. it is open when
+    // no voice is free, but keeps its last state while stealing is switched off, in which case
+    // the graph both steals and takes a free voice. With neither, the note is dropped.
+    int firstOn = -1, firstOff = -1;
+    float idOn = maxId, idOff = maxId;
+    for (int i = 0; i < o->numVoices; ++i) {
+      if (used[i] != 0.0f) {
+        if (ids[i] < idOn) { firstOn = i; idOn = ids[i]; }
+      } else if (ids[i] < idOff) { firstOff = i; idOff = ids[i]; }
+    }
+    if (o->steal->k) o->stealGate->k = (firstOff < 0);
+    if (firstOn >= 0 && o->stealGate->k) {
+      cPoly_sendNote(_c, firstOn, pitches[firstOn], 0.0f, ts, sendMessage);
+      pitches[firstOn] = f;
+      cPoly_sendNote(_c, firstOn, f, vel, ts, sendMessage);
+      ids[firstOn] = cPoly_nextSerial(o);
+    }
+    if (firstOff >= 0) {
+      pitches[firstOff] = f;
+      cPoly_sendNote(_c, firstOff, f, vel, ts, sendMessage);
+      used[firstOff] = 1.0f;
+      ids[firstOff] = cPoly_nextSerial(o);
+    }
+  } else {
+    // release the oldest voice playing this pitch
+    int firstOn = -1;
+    float idOn = maxId;
+    for (int i = 0; i < o->numVoices; ++i) {
+      if (used[i] != 0.0f && pitches[i] == f && ids[i] < idOn) { firstOn = i; idOn = ids[i]; }
+    }
+    if (firstOn >= 0) cPoly_releaseVoice(_c, o, firstOn, ts, sendMessage);
+  }
+  return true;
+}
+
+void cPoly_releaseVoice(HeavyContextInterface *_c, ControlPoly *o, int voice, hv_uint32_t timestamp,
+    void (*sendMessage)(HeavyContextInterface *, int, const HvMessage *)) {
+  hv_assert(voice >= 0 && voice < o->numVoices);
+  float *const used = hTable_getBuffer(o->used);
+  if (used[voice] == 0.0f) return;
+  used[voice] = 0.0f;
+  hTable_getBuffer(o->ids)[voice] = cPoly_nextSerial(o);
+  cPoly_sendNote(_c, voice, hTable_getBuffer(o->pitches)[voice], 0.0f, timestamp, sendMessage);
+}
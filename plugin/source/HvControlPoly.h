@@ -0,0 +1,82 @@
+/**
+ * Copyright (c) 2014-2018 Enzien Audio Ltd.
+ *
+ * Permission to use, copy, modify, and/or distribute this software for any
+ * purpose with or without fee is hereby granted, provided that the above
+ * copyright notice and this permission notice appear in all copies.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL WARRANTIES WITH
+ * REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED WARRANTIES OF MERCHANTABILITY
+ * AND FITNESS. IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR ANY SPECIAL, DIRECT,
+ * INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES WHATSOEVER RESULTING FROM
+ * LOSS OF USE, DATA OR PROFITS, WHETHER IN AN ACTION OF CONTRACT, NEGLIGENCE OR
+ * OTHER TORTIOUS ACTION, ARISING OUT OF OR IN CONNECTION WITH THE USE OR
+ * PERFORMANCE OF THIS SOFTWARE.
+ */
+
+#ifndef _HEAVY_CONTROL_POLY_H_
+#define _HEAVY_CONTROL_POLY_H_
+
+#include "HvHeavyInternal.h"
+#include "HvTable.h"
+#include "HvControlVar.h"
+#include "HvControlBinop.h"
+#include "HvControlIf.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * A native implementation of a patch's [poly] voice allocator, including voice stealing.
+ * It works on the state of the generated graph, i.e. its pitches, used and ids tables, the
+ * voice serial counter, the serial wrap-around, the steal flag and its gate, such that the
+ * tables can be read back from outside as before. Only the graph's allocation state is kept in
+ * sync, so the native path must not be mixed with the graph's [poly] for regular notes.
+ */
+typedef struct ControlPoly {
+  HvTable *pitches;
+  HvTable *used;
+  HvTable *ids;
+  ControlVar *serial; // the serial number of the next allocation
+  ControlBinop *maxVoiceId; // the serial counter wraps around at this value
+  ControlIf *steal; // the oldest sounding voice is taken when none is free
+  ControlIf *stealGate; // latched from steal on note-on, decides whether a full pool steals
+  int numVoices;
+} ControlPoly;
+
+hv_size_t cPoly_init(ControlPoly *o, int numVoices, HvTable *pitches, HvTable *used, HvTable *ids,
+    ControlVar *serial, ControlBinop *maxVoiceId, ControlIf *steal, ControlIf *stealGate);
+
+/**
+ * If the message is a note of the form [pitch velocity channel( it is allocated to a voice
+ * and true is returned. Each resulting [pitch velocity( message is sent with the voice index
+ * as outlet, a stolen voice first receiving the note-off of its old pitch.
+ * With stealing switched off, a note finding no free voice is dropped unless the graph's steal
+ * gate is still open from before. Otherwise, i.e. for malformed or NaN input, nothing is changed
+ * and the caller must run the full graph.
+ */
+bool cPoly_onMessage(HeavyContextInterface *_c, ControlPoly *o, const HvMessage *m,
+    void (*sendMessage)(HeavyContextInterface *, int, const HvMessage *));
+
+/**
+ * Releases the note held by the given voice, if any, as a note-off of its pitch would, and
+ * sends the voice that note-off. This frees a voice from outside of the note stream.
+ */
+void cPoly_releaseVoice(HeavyContextInterface *_c, ControlPoly *o, int voice, hv_uint32_t timestamp,
+    void (*sendMessage)(HeavyContextInterface *, int, const HvMessage *));
+
+/** Returns true if no voice is holding a note, whichever path allocated it. */
+static inline bool cPoly_isIdle(ControlPoly *o) {
+  const float *const used = hTable_getBuffer(o->used);
+  for (int i = 0; i < o->numVoices; ++i) {
+    if (used[i] != 0.0f) return false;
+  }
+  return true;
+}
+
+#ifdef __cplusplus
+} // extern "C"
+#endif
+
+#endif // _HEAVY_CONTROL_POLY_H_
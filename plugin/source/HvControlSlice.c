@@ -32,7 +32,7 @@ void cSlice_onMessage(HeavyContextInterface *_c, ControlSlice *o, int letIn, con
         if (o->n > 0) x = hv_min_i(x, o->n);
         HvMessage *n = HV_MESSAGE_ON_STACK(x);
         msg_init(n, x, msg_getTimestamp(m));
-        hv_memcpy(&n->elem, &m->elem+o->i, x*sizeof(Element));
+        for (int i = 0; i < x; ++i) msg_setElementToFrom(n, i, m, o->i+i);
         sendMessage(_c, 0, n);
       } else {
         // if nothing can be sliced, send a bang out of the right outlet
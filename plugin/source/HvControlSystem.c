@@ -16,28 +16,28 @@
 
 #include "HvControlSystem.h"
 
-void cSystem_onMessage(HeavyContextInterface *_c, void *o, int letIn, const HvMessage *m,
+void cSystem_onMessage(HeavyContextInterface *_c, double sampleRate, int letIn, const HvMessage *m,
     void (*sendMessage)(HeavyContextInterface *, int, const HvMessage *)) {
 
   HvMessage *n = HV_MESSAGE_ON_STACK(1);
-  if (msg_compareSymbol(m, 0, "samplerate")) {
+  if (msg_compareHash(m, 0, HV_MSG_HASH_SAMPLERATE)) {
 
-    msg_initWithFloat(n, msg_getTimestamp(m), (float) hv_getSampleRate(_c));
-  } else if (msg_compareSymbol(m, 0, "numInputChannels")) {
+    msg_initWithFloat(n, msg_getTimestamp(m), (float) sampleRate);
+  } else if (msg_compareHash(m, 0, HV_MSG_HASH_NUMINPUTCHANNELS)) {
     msg_initWithFloat(n, msg_getTimestamp(m), (float) hv_getNumInputChannels(_c));
-  } else if (msg_compareSymbol(m, 0, "numOutputChannels")) {
+  } else if (msg_compareHash(m, 0, HV_MSG_HASH_NUMOUTPUTCHANNELS)) {
     msg_initWithFloat(n, msg_getTimestamp(m), (float) hv_getNumOutputChannels(_c));
-  } else if (msg_compareSymbol(m, 0, "currentTime")) {
+  } else if (msg_compareHash(m, 0, HV_MSG_HASH_CURRENTTIME)) {
     msg_initWithFloat(n, msg_getTimestamp(m), (float) msg_getTimestamp(m));
-  } else if (msg_compareSymbol(m, 0, "table")) {
+  } else if (msg_compareHash(m, 0, HV_MSG_HASH_TABLE)) {
     // NOTE(mhroth): no need to check message format for symbols as table lookup will fail otherwise
     HvTable *table = hv_table_get(_c, msg_getHash(m,1));
     if (table != NULL) {
-      if (msg_compareSymbol(m, 2, "length")) {
+      if (msg_compareHash(m, 2, HV_MSG_HASH_LENGTH)) {
         msg_initWithFloat(n, msg_getTimestamp(m), (float) hTable_getLength(table));
-      } else if (msg_compareSymbol(m, 2, "size")) {
+      } else if (msg_compareHash(m, 2, HV_MSG_HASH_SIZE)) {
         msg_initWithFloat(n, msg_getTimestamp(m), (float) hTable_getSize(table));
-      } else if (msg_compareSymbol(m, 2, "head")) {
+      } else if (msg_compareHash(m, 2, HV_MSG_HASH_HEAD)) {
         msg_initWithFloat(n, msg_getTimestamp(m), (float) hTable_getHead(table));
       } else return;
     } else return;
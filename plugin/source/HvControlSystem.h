@@ -23,7 +23,7 @@
 extern "C" {
 #endif
 
-void cSystem_onMessage(HeavyContextInterface *_c, void *o, int letIn, const HvMessage *m,
+void cSystem_onMessage(HeavyContextInterface *_c, double sampleRate, int letIn, const HvMessage *m,
     void (*sendMessage)(HeavyContextInterface *, int, const HvMessage *));
 
 #ifdef __cplusplus
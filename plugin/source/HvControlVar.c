@@ -17,13 +17,13 @@
 #include "HvControlVar.h"
 
 hv_size_t cVar_init_f(ControlVar *o, float k) {
-  o->e.type = HV_MSG_FLOAT;
+  o->type = HV_MSG_FLOAT;
   o->e.data.f = k;
   return 0;
 }
 
 hv_size_t cVar_init_s(ControlVar *o, const char *s) {
-  o->e.type = HV_MSG_HASH;
+  o->type = HV_MSG_HASH;
   o->e.data.h = hv_string_to_hash(s);
   return 0;
 }
@@ -39,21 +39,21 @@ void cVar_onMessage(HeavyContextInterface *_c, ControlVar *o, int letIn, const H
       switch (msg_getType(m,0)) {
         case HV_MSG_BANG: {
           HvMessage *n = HV_MESSAGE_ON_STACK(1);
-          if (o->e.type == HV_MSG_FLOAT) msg_initWithFloat(n, msg_getTimestamp(m), o->e.data.f);
-          else if (o->e.type == HV_MSG_HASH) msg_initWithHash(n, msg_getTimestamp(m), o->e.data.h);
+          if (o->type == HV_MSG_FLOAT) msg_initWithFloat(n, msg_getTimestamp(m), o->e.data.f);
+          else if (o->type == HV_MSG_HASH) msg_initWithHash(n, msg_getTimestamp(m), o->e.data.h);
           else return;
           sendMessage(_c, 0, n);
           break;
         }
         case HV_MSG_FLOAT: {
-          o->e.type = HV_MSG_FLOAT;
+          o->type = HV_MSG_FLOAT;
           o->e.data.f = msg_getFloat(m,0);
           sendMessage(_c, 0, m);
           break;
         }
         case HV_MSG_SYMBOL:
         case HV_MSG_HASH: {
-          o->e.type = HV_MSG_HASH;
+          o->type = HV_MSG_HASH;
           o->e.data.h = msg_getHash(m,0);
           sendMessage(_c, 0, m);
           break;
@@ -65,13 +65,13 @@ void cVar_onMessage(HeavyContextInterface *_c, ControlVar *o, int letIn, const H
     case 1: {
       switch (msg_getType(m,0)) {
         case HV_MSG_FLOAT: {
-          o->e.type = HV_MSG_FLOAT;
+          o->type = HV_MSG_FLOAT;
           o->e.data.f = msg_getFloat(m,0);
           break;
         }
         case HV_MSG_SYMBOL:
         case HV_MSG_HASH: {
-          o->e.type = HV_MSG_HASH;
+          o->type = HV_MSG_HASH;
           o->e.data.h = msg_getHash(m,0);
           break;
         }
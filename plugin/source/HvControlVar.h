@@ -24,7 +24,8 @@ extern "C" {
 #endif
 
 typedef struct ControlVar {
-  Element e; // type is only every HV_MSG_FLOAT or HV_MSG_HASH
+  ElementType type; // type is only every HV_MSG_FLOAT or HV_MSG_HASH
+  Element e;
 } ControlVar;
 
 hv_size_t cVar_init_f(ControlVar *o, float k);
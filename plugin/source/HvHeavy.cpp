@@ -39,6 +39,16 @@ HV_EXPORT hv_uint32_t hv_table_getLength(HeavyContextInterface *c, hv_uint32_t t
   return c->getLengthForTable(tableHash);
 }
 
+HV_EXPORT float *hv_table_prepareUpdate(HeavyContextInterface *c, hv_uint32_t tableHash, hv_uint32_t newSampleLength) {
+  hv_assert(c != nullptr);
+  return c->prepareTableUpdate(tableHash, newSampleLength);
+}
+
+HV_EXPORT bool hv_table_publishUpdate(HeavyContextInterface *c, hv_uint32_t tableHash) {
+  hv_assert(c != nullptr);
+  return c->publishTableUpdate(tableHash);
+}
+
 
 
 #if !HV_WIN
@@ -181,17 +191,9 @@ HV_EXPORT bool hv_sendSymbolToReceiver(HeavyContextInterface *c, hv_uint32_t rec
   return c->sendSymbolToReceiver(receiverHash, s);
 }
 
-HV_EXPORT bool hv_sendMessageToReceiverV(
-    HeavyContextInterface *c, hv_uint32_t receiverHash, double delayMs, const char *format, ...) {
-  hv_assert(c != nullptr);
-  hv_assert(delayMs >= 0.0);
-  hv_assert(format != nullptr);
-
-  va_list ap;
-  va_start(ap, format);
-  const int numElem = (int) hv_strlen(format);
-  HvMessage *m = HV_MESSAGE_ON_STACK(numElem);
-  msg_init(m, numElem, c->getCurrentSample() + (hv_uint32_t) (hv_max_d(0.0, delayMs)*c->getSampleRate()/1000.0));
+// builds a formatted message on the stack. The timestamp is left to the context.
+static HvMessage *hv_msg_initV(HvMessage *m, int numElem, const char *format, va_list ap) {
+  msg_init(m, numElem, 0);
   for (int i = 0; i < numElem; i++) {
     switch (format[i]) {
       case 'b': msg_setBang(m, i); break;
@@ -201,6 +203,19 @@ HV_EXPORT bool hv_sendMessageToReceiverV(
       default: break;
     }
   }
+  return m;
+}
+
+HV_EXPORT bool hv_sendMessageToReceiverV(
+    HeavyContextInterface *c, hv_uint32_t receiverHash, double delayMs, const char *format, ...) {
+  hv_assert(c != nullptr);
+  hv_assert(delayMs >= 0.0);
+  hv_assert(format != nullptr);
+
+  va_list ap;
+  va_start(ap, format);
+  const int numElem = (int) hv_strlen(format);
+  HvMessage *m = hv_msg_initV(HV_MESSAGE_ON_STACK(numElem), numElem, format, ap);
   va_end(ap);
 
   return c->sendMessageToReceiver(receiverHash, delayMs, m);
@@ -212,6 +227,48 @@ HV_EXPORT bool hv_sendMessageToReceiver(
   return c->sendMessageToReceiver(receiverHash, delayMs, m);
 }
 
+HV_EXPORT bool hv_sendMessageAtSampleV(
+    HeavyContextInterface *c, hv_uint32_t receiverHash, hv_uint64_t sample, const char *format, ...) {
+  hv_assert(c != nullptr);
+  hv_assert(format != nullptr);
+
+  va_list ap;
+  va_start(ap, format);
+  const int numElem = (int) hv_strlen(format);
+  HvMessage *m = hv_msg_initV(HV_MESSAGE_ON_STACK(numElem), numElem, format, ap);
+  va_end(ap);
+
+  return c->sendMessageAtSample(receiverHash, sample, m);
+}
+
+HV_EXPORT bool hv_sendMessageAtSample(
+    HeavyContextInterface *c, hv_uint32_t receiverHash, hv_uint64_t sample, HvMessage *m) {
+  hv_assert(c != nullptr);
+  return c->sendMessageAtSample(receiverHash, sample, m);
+}
+
+HV_EXPORT bool hv_sendFloats1(HeavyContextInterface *c, hv_uint32_t receiverHash, hv_uint32_t sampleOffset, float x) {
+  hv_assert(c != nullptr);
+  return c->sendFloats1(receiverHash, sampleOffset, x);
+}
+
+HV_EXPORT bool hv_sendFloats2(HeavyContextInterface *c, hv_uint32_t receiverHash, hv_uint32_t sampleOffset,
+    float x, float y) {
+  hv_assert(c != nullptr);
+  return c->sendFloats2(receiverHash, sampleOffset, x, y);
+}
+
+HV_EXPORT bool hv_sendFloats3(HeavyContextInterface *c, hv_uint32_t receiverHash, hv_uint32_t sampleOffset,
+    float x, float y, float z) {
+  hv_assert(c != nullptr);
+  return c->sendFloats3(receiverHash, sampleOffset, x, y, z);
+}
+
+HV_EXPORT int hv_sendFloatEvents(HeavyContextInterface *c, const HvFloatEvent *events, int numEvents) {
+  hv_assert(c != nullptr);
+  return c->sendFloatEvents(events, numEvents);
+}
+
 HV_EXPORT void hv_cancelMessage(HeavyContextInterface *c, HvMessage *m, void (*sendMessage)(HeavyContextInterface *, int, const HvMessage *)) {
   hv_assert(c != nullptr);
   c->cancelMessage(m, sendMessage);
@@ -234,7 +291,7 @@ HV_EXPORT void *hv_getUserData(HeavyContextInterface *c) {
 
 HV_EXPORT double hv_getCurrentTime(HeavyContextInterface *c) {
   hv_assert(c != nullptr);
-  return (double) c->samplesToMilliseconds(c->getCurrentSample());
+  return 1000.0 * (double) c->getCurrentSample64() / c->getSampleRate();
 }
 
 HV_EXPORT hv_uint32_t hv_getCurrentSample(HeavyContextInterface *c) {
@@ -242,6 +299,11 @@ HV_EXPORT hv_uint32_t hv_getCurrentSample(HeavyContextInterface *c) {
   return c->getCurrentSample();
 }
 
+HV_EXPORT hv_uint64_t hv_getCurrentSample64(HeavyContextInterface *c) {
+  hv_assert(c != nullptr);
+  return c->getCurrentSample64();
+}
+
 HV_EXPORT float hv_samplesToMilliseconds(HeavyContextInterface *c, hv_uint32_t numSamples) {
   hv_assert(c != nullptr);
   return c->samplesToMilliseconds(numSamples);
@@ -309,6 +371,46 @@ HV_EXPORT int hv_processInlineInterleaved(HeavyContextInterface *c, float *input
   return c->processInlineInterleaved(inputBuffers, outputBuffers, n);
 }
 
+HV_EXPORT bool hv_isOutputSilent(HeavyContextInterface *c) {
+  hv_assert(c != nullptr);
+  return c->isOutputSilent();
+}
+
+HV_EXPORT void hv_setSilentBlocksBeforeSleep(HeavyContextInterface *c, int numBlocks) {
+  hv_assert(c != nullptr);
+  c->setSilentBlocksBeforeSleep(numBlocks);
+}
+
+HV_EXPORT void hv_setCpuBudget(HeavyContextInterface *c, float fraction) {
+  hv_assert(c != nullptr);
+  c->setCpuBudget(fraction);
+}
+
+HV_EXPORT float hv_getCpuLoad(HeavyContextInterface *c) {
+  hv_assert(c != nullptr);
+  return c->getCpuLoad();
+}
+
+HV_EXPORT int hv_getLoadTier(HeavyContextInterface *c) {
+  hv_assert(c != nullptr);
+  return c->getLoadTier();
+}
+
+HV_EXPORT bool hv_setRenderThreads(HeavyContextInterface *c, int numThreads, int minBlockSize) {
+  hv_assert(c != nullptr);
+  return c->setRenderThreads(numThreads, minBlockSize);
+}
+
+HV_EXPORT void hv_warmUp(HeavyContextInterface *c) {
+  hv_assert(c != nullptr);
+  c->warmUp();
+}
+
+HV_EXPORT void hv_clearMessages(HeavyContextInterface *c) {
+  hv_assert(c != nullptr);
+  c->clearMessages();
+}
+
 HV_EXPORT void hv_delete(HeavyContextInterface *c) {
   delete c;
 }
@@ -50,6 +50,13 @@ typedef struct HvParameterInfo {
   float defaultVal;     // the default value of this parameter
 } HvParameterInfo;
 
+typedef struct HvFloatEvent {
+  hv_uint32_t receiverHash; // the hash of the receiver, as from hv_stringToHash()
+  hv_uint32_t sampleOffset; // the number of samples after the start of the next processed block
+  hv_uint32_t numFloats;    // the number of values, from 1 to 3
+  float f[3];               // the message values
+} HvFloatEvent;
+
 typedef void (HvSendHook_t) (HeavyContextInterface *context, const char *sendName, hv_uint32_t sendHash, const HvMessage *msg);
 typedef void (HvPrintHook_t) (HeavyContextInterface *context, const char *printName, const char *str, const HvMessage *msg);
 
@@ -112,6 +119,62 @@ int hv_processInline(HeavyContextInterface *c, float *inputBuffers, float *outpu
  */
 int hv_processInlineInterleaved(HeavyContextInterface *c, float *inputBuffers, float *outputBuffers, int n);
 
+/**
+ * Returns true if the most recently processed block was skipped because the context is asleep.
+ * The output buffers of that block have been zero-filled and need not be mixed downstream.
+ */
+bool hv_isOutputSilent(HeavyContextInterface *c);
+
+/**
+ * Sets the number of consecutive blocks whose output must stay below -120 dBFS before the
+ * context goes to sleep. While asleep, processing zero-fills the outputs and skips the signal
+ * graph until a message is due in the current block. Zero disables sleeping.
+ */
+void hv_setSilentBlocksBeforeSleep(HeavyContextInterface *c, int numBlocks);
+
+/**
+ * Sets the share of the real-time duration of a block that processing it may take, e.g. 0.7.
+ * While the measured load stays above the budget, the patch degrades its quality one tier at a
+ * time, and restores it once the load stays well below the budget. Zero disables load shedding.
+ * Without effect in builds with HV_LOAD_SHEDDING=0, which do not measure the load at all.
+ */
+void hv_setCpuBudget(HeavyContextInterface *c, float fraction);
+
+/** Returns the smoothed processing time of recent blocks as a share of their real-time duration. */
+float hv_getCpuLoad(HeavyContextInterface *c);
+
+/**
+ * Returns the current load tier. Zero is full quality, higher tiers are cheaper to render.
+ * Each change of the tier is also sent to the send hook as a message [tier load( to
+ * HV_LOAD_TIER_SEND_NAME, with the load at which it changed.
+ */
+int hv_getLoadTier(HeavyContextInterface *c);
+
+#define HV_LOAD_TIER_SEND_NAME "__hv_loadtier"
+#define HV_LOAD_TIER_SEND_HASH 0x1CE59F01
+
+/**
+ * Renders independent voices of blocks of at least minBlockSize frames on numThreads worker threads,
+ * in addition to the calling thread. Smaller blocks are rendered on the calling thread only.
+ * Zero threads disables parallel rendering. Intended for offline rendering.
+ * The output is not bit-identical to rendering on the calling thread, with -ffast-math the compiler
+ * may contract the voice arithmetic differently on both paths. The tests allow 1e-4.
+ * Returns false if the patch does not support parallel rendering.
+ */
+bool hv_setRenderThreads(HeavyContextInterface *c, int numThreads, int minBlockSize);
+
+/**
+ * Removes first-use costs from the next blocks, without changing the state of the context.
+ * Allocates, so it is intended for plugin activation. Must not be called while processing.
+ */
+void hv_warmUp(HeavyContextInterface *c);
+
+/**
+ * Drops all pending messages, except those that the patch scheduled before the first block.
+ * Must not be called while processing.
+ */
+void hv_clearMessages(HeavyContextInterface *c);
+
 
 
 #if HV_APPLE
@@ -140,7 +203,8 @@ void hv_setPrintHook(HeavyContextInterface *c, HvPrintHook_t *f);
 HvPrintHook_t *hv_getPrintHook(HeavyContextInterface *c);
 
 /**
- * Set the send hook. The function is called whenever a message is sent to any send object.
+ * Set the send hook. The function is called whenever a message is sent to any send object, and
+ * whenever the load tier changes, see hv_getLoadTier().
  * Messages returned by this function should NEVER be freed. If the message must persist, call
  * hv_msg_copy() first.
  */
@@ -199,6 +263,48 @@ bool hv_sendMessageToReceiverV(HeavyContextInterface *c, hv_uint32_t receiverHas
  */
 bool hv_sendMessageToReceiver(HeavyContextInterface *c, hv_uint32_t receiverHash, double delayMs, HvMessage *m);
 
+/**
+ * Sends a formatted message to a receiver, to be processed at the given sample of the 64-bit
+ * timeline (see hv_getCurrentSample64()). A sample that has already passed is processed at the
+ * start of the next block. A sample 2^31 or more samples ahead of the current time is processed
+ * 2^31-1 samples ahead instead, as the queue could not order it.
+ * This function is thread-safe.
+ *
+ * @return  True if the message was accepted. False if the message could not fit onto
+ *          the message queue to be processed this block.
+ */
+bool hv_sendMessageAtSampleV(HeavyContextInterface *c, hv_uint32_t receiverHash, hv_uint64_t sample, const char *format, ...);
+
+/**
+ * Sends a message to a receiver, to be processed at the given sample of the 64-bit timeline.
+ * This function is thread-safe.
+ *
+ * @return  True if the message was accepted. False if the message could not fit onto
+ *          the message queue to be processed this block.
+ */
+bool hv_sendMessageAtSample(HeavyContextInterface *c, hv_uint32_t receiverHash, hv_uint64_t sample, HvMessage *m);
+
+/**
+ * Sends a message of one, two or three floats to a receiver, to be processed sampleOffset samples
+ * after the start of the next processed block, without interpreting a format string. Offsets past
+ * 2^31-1 are clamped to it.
+ * This function is thread-safe.
+ *
+ * @return  True if the message was accepted. False if the message could not fit onto
+ *          the message queue to be processed this block.
+ */
+bool hv_sendFloats1(HeavyContextInterface *c, hv_uint32_t receiverHash, hv_uint32_t sampleOffset, float x);
+bool hv_sendFloats2(HeavyContextInterface *c, hv_uint32_t receiverHash, hv_uint32_t sampleOffset, float x, float y);
+bool hv_sendFloats3(HeavyContextInterface *c, hv_uint32_t receiverHash, hv_uint32_t sampleOffset, float x, float y, float z);
+
+/**
+ * Sends a batch of float events, taking the input queue lock only once.
+ * This function is thread-safe.
+ *
+ * @return  The number of events accepted, in order.
+ */
+int hv_sendFloatEvents(HeavyContextInterface *c, const HvFloatEvent *events, int numEvents);
+
 /**
  * Cancels a previously scheduled message.
  *
@@ -218,9 +324,15 @@ void *hv_getUserData(HeavyContextInterface *c);
 /** Returns the current patch time in milliseconds. This value may have rounding errors. */
 double hv_getCurrentTime(HeavyContextInterface *c);
 
-/** Returns the current patch time in samples. This value is always exact. */
+/**
+ * Returns the current patch time in samples. This value is always exact, but it wraps
+ * after 2^32 samples (about 24.8 hours at 48kHz).
+ */
 hv_uint32_t hv_getCurrentSample(HeavyContextInterface *c);
 
+/** Returns the current patch time in samples on the 64-bit timeline, which does not wrap. */
+hv_uint64_t hv_getCurrentSample64(HeavyContextInterface *c);
+
 /**
  * Returns information about each parameter such as name, hash, and range.
  * The total number of parameters is always returned.
@@ -354,7 +466,10 @@ bool hv_msg_isHash(const HvMessage *const m, int i);
 /** Returns the indexed element as a hash value. Index is not bounds checked. */
 hv_uint32_t hv_msg_getHash(const HvMessage *const m, int i);
 
-/** Sets the indexed element to symbol value. Index is not bounds checked. */
+/**
+ * Sets the indexed element to symbol value. Index is not bounds checked.
+ * The string is interned in a global symbol table and need not outlive the message.
+ */
 void hv_msg_setSymbol(HvMessage *m, int i, const char *s);
 
 /**
@@ -390,8 +505,9 @@ void hv_msg_free(HvMessage *m);
 /**
  * Resizes the table to the given length.
  *
- * Existing contents are copied to the new table. Remaining space is cleared
- * if the table is longer than the original, truncated otherwise.
+ * Existing contents are copied to the new table, including those written by the patch until
+ * the audio thread swaps it in. Remaining space is cleared if the table is longer than the
+ * original, truncated otherwise. The new table is published as by hv_table_publishUpdate().
  *
  * @param tableHash  The table identifier.
  * @param newSampleLength  The new length of the table, in samples. Must be positive.
@@ -400,12 +516,35 @@ void hv_msg_free(HvMessage *m);
  */
 bool hv_table_setLength(HeavyContextInterface *c, hv_uint32_t tableHash, hv_uint32_t newSampleLength);
 
-/** Returns a pointer to the raw buffer backing this table. DO NOT free it. */
+/**
+ * Returns a pointer to the raw buffer backing this table. DO NOT free it.
+ * The audio thread may replace the buffer at the start of each block. The pointer is invalid
+ * once a buffer published by hv_table_publishUpdate() or hv_table_setLength() has been swapped
+ * in, i.e. after the next block, and must then be fetched again.
+ */
 float *hv_table_getBuffer(HeavyContextInterface *c, hv_uint32_t tableHash);
 
 /** Returns the length of this table in samples. */
 hv_uint32_t hv_table_getLength(HeavyContextInterface *c, hv_uint32_t tableHash);
 
+/**
+ * Returns a new buffer of the given length for the table, holding its last published
+ * contents. Fill it and publish it with hv_table_publishUpdate(). Table updates are
+ * lock-free and may be made from one thread while another processes, but never from
+ * the audio thread.
+ *
+ * @return  NULL if the table could not be found.
+ */
+float *hv_table_prepareUpdate(HeavyContextInterface *c, hv_uint32_t tableHash, hv_uint32_t newSampleLength);
+
+/**
+ * Publishes the buffer returned by hv_table_prepareUpdate(), which the audio thread
+ * swaps in at the start of its next block.
+ *
+ * @return  False if the table could not be found or no buffer was prepared. True otherwise.
+ */
+bool hv_table_publishUpdate(HeavyContextInterface *c, hv_uint32_t tableHash);
+
 #ifdef __cplusplus
 } // extern "C"
 #endif
@@ -21,6 +21,7 @@
 #include "HvUtils.h"
 #include "HvTable.h"
 #include "HvMessage.h"
+#include "HvMessageQueue.h"
 #include "HvMath.h"
 
 #ifdef __cplusplus
@@ -33,16 +34,17 @@ extern "C" {
 HvTable *hv_table_get(HeavyContextInterface *c, hv_uint32_t tableHash);
 
 /**
- *
+ * Converts milliseconds to samples like hv_millisecondsToSamples(). Objects keep the sample rate
+ * that they were initialised with, the context is recreated when it changes.
  */
-void hv_scheduleMessageForReceiver(HeavyContextInterface *c, hv_uint32_t receiverHash, HvMessage *m);
+static inline hv_uint32_t hv_millisecondsToSamples_r(double sampleRate, float ms) {
+  return (hv_uint32_t) (hv_max_f(0.0f,ms)*sampleRate/1000.0);
+}
 
 /**
  *
  */
-HvMessage *hv_scheduleMessageForObject(HeavyContextInterface *c, const HvMessage *m,
-    void (*sendMessage)(HeavyContextInterface *, int, const HvMessage *),
-    int letIndex);
+void hv_scheduleMessageForReceiver(HeavyContextInterface *c, hv_uint32_t receiverHash, HvMessage *m);
 
 #ifdef __cplusplus
 }
@@ -16,28 +16,6 @@
 
 #include "HvLightPipe.h"
 
-#if __SSE__ || HV_SIMD_SSE
-#include <xmmintrin.h>
-#define hv_sfence() _mm_sfence()
-#elif __arm__ || HV_SIMD_NEON
-  #if __ARM_ACLE
-    #include <arm_acle.h>
-    // https://msdn.microsoft.com/en-us/library/hh875058.aspx#BarrierRestrictions
-    // http://doxygen.reactos.org/d8/d47/armintr_8h_a02be7ec76ca51842bc90d9b466b54752.html
-    #define hv_sfence() __dmb(0xE) /* _ARM_BARRIER_ST */
-  #elif defined(__GNUC__)
-    #define hv_sfence() __asm__ volatile ("dmb 0xE":::"memory")
-  #else
-    // http://stackoverflow.com/questions/19965076/gcc-memory-barrier-sync-synchronize-vs-asm-volatile-memory
-    #define hv_sfence() __sync_synchronize()
-  #endif
-#elif HV_WIN
-// https://msdn.microsoft.com/en-us/library/windows/desktop/ms684208(v=vs.85).aspx
-#define hv_sfence() _WriteBarrier()
-#else
-#define hv_sfence() __asm__ volatile("" : : : "memory")
-#endif
-
 #define HLP_STOP 0
 #define HLP_LOOP 0xFFFFFFFF
 #define HLP_SET_UINT32_AT_BUFFER(a, b) (*((hv_uint32_t *) (a)) = (b))
@@ -313,7 +313,7 @@ static inline void __hv_neg_f(hv_bInf_t bIn, hv_bOutf_t bOut) {
 static inline void __hv_exp_f(hv_bInf_t bIn, hv_bOutf_t bOut) {
 #if HV_SIMD_AVX
   float *const b = (float *) hv_alloca(HV_N_SIMD*sizeof(float));
-  _mm256_store_ps(b, bIn);
+  _mm256_storeu_ps(b, bIn); // alloca only guarantees 16 byte alignment
   *bOut = _mm256_set_ps(
       hv_exp_f(b[7]), hv_exp_f(b[6]), hv_exp_f(b[5]), hv_exp_f(b[4]),
       hv_exp_f(b[3]), hv_exp_f(b[2]), hv_exp_f(b[1]), hv_exp_f(b[0]));
@@ -536,17 +536,17 @@ static inline void __hv_max_i(hv_bIni_t bIn0, hv_bIni_t bIn1, hv_bOuti_t bOut) {
 static inline void __hv_pow_f(hv_bInf_t bIn0, hv_bInf_t bIn1, hv_bOutf_t bOut) {
 #if HV_SIMD_AVX
   float *b = (float *) hv_alloca(16*sizeof(float));
-  _mm256_store_ps(b, bIn0);
-  _mm256_store_ps(b+8, bIn1);
+  _mm256_storeu_ps(b, bIn0); // alloca only guarantees 16 byte alignment
+  _mm256_storeu_ps(b+8, bIn1);
   *bOut = _mm256_set_ps(
-      hv_pow_f(b[7], b[7]),
-      hv_pow_f(b[6], b[6]),
-      hv_pow_f(b[5], b[5]),
-      hv_pow_f(b[4], b[4]),
-      hv_pow_f(b[3], b[3]),
-      hv_pow_f(b[2], b[2]),
-      hv_pow_f(b[1], b[1]),
-      hv_pow_f(b[0], b[0]));
+      hv_pow_f(b[7], b[15]),
+      hv_pow_f(b[6], b[14]),
+      hv_pow_f(b[5], b[13]),
+      hv_pow_f(b[4], b[12]),
+      hv_pow_f(b[3], b[11]),
+      hv_pow_f(b[2], b[10]),
+      hv_pow_f(b[1], b[9]),
+      hv_pow_f(b[0], b[8]));
 #elif HV_SIMD_SSE
   float *b = (float *) hv_alloca(8*sizeof(float));
   _mm_store_ps(b, bIn0);
@@ -721,4 +721,60 @@ static inline void __hv_fms_f(hv_bInf_t bIn0, hv_bInf_t bIn1, hv_bInf_t bIn2, hv
 #endif
 }
 
+// returns true if all elements of bIn are equal, and writes the first element to x
+static inline bool __hv_uniform_f(hv_bInf_t bIn, float *x) {
+#if HV_SIMD_AVX
+  __m256 a = _mm256_permute_ps(bIn, _MM_SHUFFLE(0,0,0,0));
+  a = _mm256_permute2f128_ps(a, a, 0x00);
+  *x = _mm_cvtss_f32(_mm256_castps256_ps128(bIn));
+  return _mm256_movemask_ps(_mm256_cmp_ps(bIn, a, _CMP_NEQ_UQ)) == 0;
+#elif HV_SIMD_SSE
+  __m128 a = _mm_shuffle_ps(bIn, bIn, _MM_SHUFFLE(0,0,0,0));
+  *x = _mm_cvtss_f32(bIn);
+  return _mm_movemask_ps(_mm_cmpneq_ps(bIn, a)) == 0;
+#elif HV_SIMD_NEON
+  *x = vgetq_lane_f32(bIn, 0);
+  uint32x4_t a = vceqq_f32(bIn, vdupq_n_f32(*x));
+  uint32x2_t b = vand_u32(vget_low_u32(a), vget_high_u32(a));
+  return (vget_lane_u32(b, 0) & vget_lane_u32(b, 1)) != 0;
+#else // HV_SIMD_NONE
+  *x = bIn;
+  return true;
+#endif
+}
+
+// sets all elements of bOut to the first element of bIn
+static inline void __hv_broadcast_f(hv_bInf_t bIn, hv_bOutf_t bOut) {
+#if HV_SIMD_AVX
+  __m256 a = _mm256_permute_ps(bIn, _MM_SHUFFLE(0,0,0,0));
+  *bOut = _mm256_permute2f128_ps(a, a, 0x00);
+#elif HV_SIMD_SSE
+  *bOut = _mm_shuffle_ps(bIn, bIn, _MM_SHUFFLE(0,0,0,0));
+#elif HV_SIMD_NEON
+  *bOut = vdupq_lane_f32(vget_low_f32(bIn), 0);
+#else // HV_SIMD_NONE
+  *bOut = bIn;
+#endif
+}
+
+// returns the largest absolute value of the elements of bIn
+static inline float __hv_peak_f(hv_bInf_t bIn) {
+#if HV_SIMD_AVX
+  __m256 a = _mm256_andnot_ps(_mm256_set1_ps(-0.0f), bIn);
+  __m128 b = _mm_max_ps(_mm256_castps256_ps128(a), _mm256_extractf128_ps(a, 1));
+  b = _mm_max_ps(b, _mm_movehl_ps(b, b));
+  return _mm_cvtss_f32(_mm_max_ss(b, _mm_shuffle_ps(b, b, _MM_SHUFFLE(1,1,1,1))));
+#elif HV_SIMD_SSE
+  __m128 a = _mm_andnot_ps(_mm_set1_ps(-0.0f), bIn);
+  a = _mm_max_ps(a, _mm_movehl_ps(a, a));
+  return _mm_cvtss_f32(_mm_max_ss(a, _mm_shuffle_ps(a, a, _MM_SHUFFLE(1,1,1,1))));
+#elif HV_SIMD_NEON
+  float32x4_t a = vabsq_f32(bIn);
+  float32x2_t b = vpmax_f32(vget_low_f32(a), vget_high_f32(a));
+  return vget_lane_f32(vpmax_f32(b, b), 0);
+#else // HV_SIMD_NONE
+  return hv_abs_f(bIn);
+#endif
+}
+
 #endif // _HEAVY_MATH_H_
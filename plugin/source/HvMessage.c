@@ -16,6 +16,85 @@
 
 #include "HvMessage.h"
 
+// the global symbol table. Entries are published atomically and read with acquire loads.
+static const HvMessageSymbol *volatile __hv_msg_symbols[HV_MSG_SYMBOL_TABLE_SIZE];
+static hv_uint32_t __hv_msg_symbolBuffer[HV_MSG_SYMBOL_TABLE_KB*256]; // word aligned
+static hv_size_t __hv_msg_symbolBufferIndex = 0;
+static hv_atomic_bool __hv_msg_symbolLock;
+static volatile hv_uint32_t __hv_msg_numSymbolOverflows = 0;
+
+static hv_uint32_t msg_findSymbol(const char *s, hv_uint32_t hash, hv_uint32_t *freeIndex) {
+  hv_uint32_t i = hash & (HV_MSG_SYMBOL_TABLE_SIZE-1);
+  for (int n = 0; n < HV_MSG_SYMBOL_TABLE_SIZE; ++n) {
+    const HvMessageSymbol *const e = (const HvMessageSymbol *) hv_atomic_load_ptr(&__hv_msg_symbols[i]);
+    if (e == NULL) {
+      *freeIndex = i;
+      return HV_MSG_SYMBOL_TABLE_SIZE;
+    }
+    if (e->hash == hash && !hv_strcmp(e->str, s)) return i;
+    i = (i+1) & (HV_MSG_SYMBOL_TABLE_SIZE-1);
+  }
+  *freeIndex = HV_MSG_SYMBOL_TABLE_SIZE; // the table is full
+  return HV_MSG_SYMBOL_TABLE_SIZE;
+}
+
+bool msg_internSymbol(const char *s, hv_uint32_t *index) {
+  const hv_uint32_t hash = hv_string_to_hash(s);
+  hv_uint32_t freeIndex = HV_MSG_SYMBOL_TABLE_SIZE;
+  hv_uint32_t i = msg_findSymbol(s, hash, &freeIndex);
+  if (i < HV_MSG_SYMBOL_TABLE_SIZE) {
+    *index = i;
+    return true;
+  }
+
+  HV_SPINLOCK_ACQUIRE(__hv_msg_symbolLock);
+  // look again, another thread may have added the symbol in the meantime
+  i = msg_findSymbol(s, hash, &freeIndex);
+  if (i == HV_MSG_SYMBOL_TABLE_SIZE && freeIndex < HV_MSG_SYMBOL_TABLE_SIZE) {
+    // keep each entry word aligned
+    const hv_size_t numBytes = (sizeof(hv_uint32_t) + hv_strlen(s) + 1 + 3) & ~((hv_size_t) 3);
+    if (__hv_msg_symbolBufferIndex + numBytes <= sizeof(__hv_msg_symbolBuffer)) {
+      HvMessageSymbol *e = (HvMessageSymbol *) (((char *) __hv_msg_symbolBuffer) + __hv_msg_symbolBufferIndex);
+      e->hash = hash;
+      hv_memcpy(e->str, s, hv_strlen(s) + 1);
+      __hv_msg_symbolBufferIndex += numBytes;
+      // the entry must be complete before it is published
+      (void) hv_atomic_exchange_ptr(&__hv_msg_symbols[freeIndex], e);
+      i = freeIndex;
+    }
+  }
+  if (i == HV_MSG_SYMBOL_TABLE_SIZE) {
+    // the table or its string storage is full, see HV_MSG_SYMBOL_TABLE_SIZE and HV_MSG_SYMBOL_TABLE_KB
+    __hv_msg_numSymbolOverflows = __hv_msg_numSymbolOverflows+1;
+  }
+  HV_SPINLOCK_RELEASE(__hv_msg_symbolLock);
+
+  *index = i;
+  return (i < HV_MSG_SYMBOL_TABLE_SIZE);
+}
+
+const HvMessageSymbol *msg_getInternedSymbol(hv_uint32_t index) {
+  hv_assert(index < HV_MSG_SYMBOL_TABLE_SIZE);
+  return (const HvMessageSymbol *) hv_atomic_load_ptr(&__hv_msg_symbols[index]);
+}
+
+hv_uint32_t msg_getNumSymbolOverflows() {
+  return __hv_msg_numSymbolOverflows;
+}
+
+void msg_setSymbol(HvMessage *m, int index, const char *s) {
+  hv_assert(index < msg_getNumElements(m)); // invalid index
+  hv_assert(s != NULL);
+  hv_uint32_t i = 0;
+  if (msg_internSymbol(s, &i)) {
+    __msg_setType(m, index, HV_MSG_SYMBOL);
+    (&(m->elem)+index)->data.s = i;
+  } else {
+    // keep what can be kept, the element still compares and hashes like the symbol
+    msg_setHash(m, index, hv_string_to_hash(s));
+  }
+}
+
 HvMessage *msg_init(HvMessage *m, hv_size_t numElements, hv_uint32_t timestamp) {
   m->timestamp = timestamp;
   m->numElements = (hv_uint16_t) numElements;
@@ -42,7 +121,7 @@ HvMessage *msg_initWithBang(HvMessage *m, hv_uint32_t timestamp) {
 HvMessage *msg_initWithSymbol(HvMessage *m, hv_uint32_t timestamp, const char *s) {
   m->timestamp = timestamp;
   m->numElements = 1;
-  m->numBytes = sizeof(HvMessage) + (hv_uint16_t) hv_strlen(s);
+  m->numBytes = sizeof(HvMessage);
   msg_setSymbol(m, 0, s);
   return m;
 }
@@ -58,30 +137,16 @@ HvMessage *msg_initWithHash(HvMessage *m, hv_uint32_t timestamp, hv_uint32_t h)
 void msg_copyToBuffer(const HvMessage *m, char *buffer, hv_size_t len) {
   HvMessage *r = (HvMessage *) buffer;
 
-  hv_size_t len_r = msg_getCoreSize(msg_getNumElements(m));
+  const hv_size_t len_r = msg_getCoreSize(msg_getNumElements(m));
 
   // assert that the message is not already larger than the length of the buffer
   hv_assert(len_r <= len);
 
-  // copy the basic message to the buffer
+  // symbols are interned, so the message is entirely self-contained
   hv_memcpy(r, m, len_r);
-
-  char *p = buffer + len_r; // points to the end of the base message
-  for (int i = 0; i < msg_getNumElements(m); ++i) {
-    if (msg_isSymbol(m,i)) {
-      const hv_size_t symLen = (hv_size_t) hv_strlen(msg_getSymbol(m,i)) + 1; // include the trailing null char
-      hv_assert(len_r + symLen <= len); // stay safe!
-      hv_strncpy(p, msg_getSymbol(m,i), symLen);
-      msg_setSymbol(r, i, p);
-      p += symLen;
-      len_r += symLen;
-    }
-  }
-
-  r->numBytes = (hv_uint16_t) len_r; // update the message size in memory
+  r->numBytes = (hv_uint16_t) len_r;
 }
 
-// the message is serialised such that all symbol elements are placed in order at the end of the buffer
 HvMessage *msg_copy(const HvMessage *m) {
   const hv_uint32_t heapSize = msg_getSize(m);
   char *r = (char *) hv_malloc(heapSize);
@@ -123,7 +188,7 @@ bool msg_equalsElement(const HvMessage *m, int i_m, const HvMessage *n, int i_n)
       switch (msg_getType(m, i_m)) {
         case HV_MSG_BANG: return true;
         case HV_MSG_FLOAT: return (msg_getFloat(m, i_m) == msg_getFloat(n, i_n));
-        case HV_MSG_SYMBOL: return msg_compareSymbol(m, i_m, msg_getSymbol(n, i_n));
+        case HV_MSG_SYMBOL: return (&(m->elem)+i_m)->data.s == (&(n->elem)+i_n)->data.s;
         case HV_MSG_HASH: return msg_getHash(m,i_m) == msg_getHash(n,i_n);
         default: break;
       }
@@ -136,7 +201,11 @@ void msg_setElementToFrom(HvMessage *n, int i_n, const HvMessage *const m, int i
   switch (msg_getType(m, i_m)) {
     case HV_MSG_BANG: msg_setBang(n, i_n); break;
     case HV_MSG_FLOAT: msg_setFloat(n, i_n, msg_getFloat(m, i_m)); break;
-    case HV_MSG_SYMBOL: msg_setSymbol(n, i_n, msg_getSymbol(m, i_m)); break;
+    case HV_MSG_SYMBOL: {
+      __msg_setType(n, i_n, HV_MSG_SYMBOL);
+      (&(n->elem)+i_n)->data.s = (&(m->elem)+i_m)->data.s; // already interned
+      break;
+    }
     case HV_MSG_HASH: msg_setHash(n, i_n, msg_getHash(m, i_m));
     default: break;
   }
@@ -150,7 +219,7 @@ hv_uint32_t msg_getHash(const HvMessage *const m, int i) {
       float f = msg_getFloat(m,i);
       return *((hv_uint32_t *) &f);
     }
-    case HV_MSG_SYMBOL: return hv_string_to_hash(msg_getSymbol(m,i));
+    case HV_MSG_SYMBOL: return msg_getInternedSymbol((&(m->elem)+i)->data.s)->hash;
     case HV_MSG_HASH: return (&(m->elem)+i)->data.h;
     default: return 0;
   }
@@ -30,22 +30,44 @@ typedef enum ElementType {
   HV_MSG_HASH = 3
 } ElementType;
 
+// Element types are packed 2 bits each into HvMessage.types, leaving each element with a 4-byte payload.
 typedef struct Element {
-  ElementType type;
   union {
     float f; // float
-    const char *s; // symbol
+    hv_uint32_t s; // symbol, an index into the global symbol table
     hv_uint32_t h; // hash
   } data;
 } Element;
 
+/**
+ * The types of the first 16 elements are kept in the header. The types of any further elements
+ * are kept in additional words following the last element, 16 elements per word.
+ */
 typedef struct HvMessage {
   hv_uint32_t timestamp; // the sample at which this message should be processed
   hv_uint16_t numElements;
-  hv_uint16_t numBytes; // the total number of bytes that this message occupies in memory, including strings
+  hv_uint16_t numBytes; // the total number of bytes that this message occupies in memory
+  hv_uint32_t types; // 2-bit ElementType of elements 0-15
   Element elem;
 } HvMessage;
 
+/**
+ * Symbols are interned by content into a global table shared by all contexts, such that messages
+ * only ever carry a 4-byte index and never string data. Entries are never removed, so the table
+ * bounds the number of distinct symbols that a process may ever use. Beyond it, see msg_setSymbol().
+ */
+#ifndef HV_MSG_SYMBOL_TABLE_SIZE
+#define HV_MSG_SYMBOL_TABLE_SIZE 512 // must be a power of two
+#endif
+#ifndef HV_MSG_SYMBOL_TABLE_KB
+#define HV_MSG_SYMBOL_TABLE_KB 8 // storage for the interned strings
+#endif
+
+typedef struct HvMessageSymbol {
+  hv_uint32_t hash; // hv_string_to_hash() of str
+  char str[4]; // the null-terminated string, which may extend beyond the struct
+} HvMessageSymbol;
+
 typedef struct ReceiverMessagePair {
   hv_uint32_t receiverHash;
   HvMessage msg;
@@ -56,9 +78,23 @@ typedef struct ReceiverMessagePair {
 /** Returns the number of bytes that this message consumes in memory, not including strings. */
 static inline hv_size_t msg_getCoreSize(hv_size_t numElements) {
   hv_assert(numElements > 0);
-  return sizeof(HvMessage) + ((numElements-1) * sizeof(Element));
+  return sizeof(HvMessage) + ((numElements-1) * sizeof(Element))
+      + (((numElements-1) >> 4) * sizeof(hv_uint32_t)); // overflow type words
 }
 
+/**
+ * Sets index to the position of the given string in the global symbol table, adding it if
+ * necessary. Lookups are lock-free. Only the first use of a new string takes a lock. Returns
+ * false if the string is new and the table is full.
+ */
+bool msg_internSymbol(const char *s, hv_uint32_t *index);
+
+/** Returns the number of times that a symbol could not be interned because the table was full. */
+hv_uint32_t msg_getNumSymbolOverflows();
+
+/** Returns the interned symbol at the given index of the global symbol table. */
+const HvMessageSymbol *msg_getInternedSymbol(hv_uint32_t index);
+
 HvMessage *msg_copy(const HvMessage *m);
 
 /** Copies the message into the given buffer. The buffer must be at least as large as msg_getNumHeapBytes(). */
@@ -87,6 +123,18 @@ static inline void msg_setTimestamp(HvMessage *m, hv_uint32_t timestamp) {
   m->timestamp = timestamp;
 }
 
+/**
+ * Returns true if timestamp a occurs before timestamp b. Timestamps are the low 32 bits of the
+ * context's 64-bit sample timeline and are compared modulo 2^32, which holds as long as no two
+ * pending messages are more than 2^31 samples (about 12 hours at 48kHz) apart.
+ */
+static inline bool msg_isTimestampBefore(hv_uint32_t a, hv_uint32_t b) {
+  return (hv_int32_t) (a - b) < 0;
+}
+
+// the furthest ahead of the current block that a message can be scheduled and still be ordered
+#define HV_MAX_TIMESTAMP_OFFSET 0x7FFFFFFFU
+
 static inline int msg_getNumElements(const HvMessage *m) {
   return (int) m->numElements;
 }
@@ -96,15 +144,26 @@ static inline hv_uint32_t msg_getSize(const HvMessage *m) {
   return m->numBytes;
 }
 
+static inline hv_uint32_t *__msg_getTypeWord(const HvMessage *m, int index) {
+  return (index < 16) ? (hv_uint32_t *) &m->types
+      : ((hv_uint32_t *) (&(m->elem)+m->numElements)) + ((index-16) >> 4);
+}
+
 static inline ElementType msg_getType(const HvMessage *m, int index) {
   hv_assert(index < msg_getNumElements(m)); // invalid index
-  return (&(m->elem)+index)->type;
+  return (ElementType) ((*__msg_getTypeWord(m, index) >> ((index & 0xF) << 1)) & 0x3);
+}
+
+static inline void __msg_setType(HvMessage *m, int index, ElementType type) {
+  hv_uint32_t *const w = __msg_getTypeWord(m, index);
+  const int shift = (index & 0xF) << 1;
+  *w = (*w & ~(0x3U << shift)) | (((hv_uint32_t) type) << shift);
 }
 
 static inline void msg_setBang(HvMessage *m, int index) {
   hv_assert(index < msg_getNumElements(m)); // invalid index
-  (&(m->elem)+index)->type = HV_MSG_BANG;
-  (&(m->elem)+index)->data.s = NULL;
+  __msg_setType(m, index, HV_MSG_BANG);
+  (&(m->elem)+index)->data.h = 0;
 }
 
 static inline bool msg_isBang(const HvMessage *m, int index) {
@@ -113,7 +172,7 @@ static inline bool msg_isBang(const HvMessage *m, int index) {
 
 static inline void msg_setFloat(HvMessage *m, int index, float f) {
   hv_assert(index < msg_getNumElements(m)); // invalid index
-  (&(m->elem)+index)->type = HV_MSG_FLOAT;
+  __msg_setType(m, index, HV_MSG_FLOAT);
   (&(m->elem)+index)->data.f = f;
 }
 
@@ -128,7 +187,7 @@ static inline bool msg_isFloat(const HvMessage *const m, int index) {
 
 static inline void msg_setHash(HvMessage *m, int index, hv_uint32_t h) {
   hv_assert(index < msg_getNumElements(m)); // invalid index
-  (&(m->elem)+index)->type = HV_MSG_HASH;
+  __msg_setType(m, index, HV_MSG_HASH);
   (&(m->elem)+index)->data.h = h;
 }
 
@@ -144,19 +203,31 @@ static inline bool msg_isHashLike(const HvMessage *m, int index) {
 /** Returns a 32-bit hash of the given element. */
 hv_uint32_t msg_getHash(const HvMessage *const m, int i);
 
-static inline void msg_setSymbol(HvMessage *m, int index, const char *s) {
+/**
+ * Sets the element to the interned symbol. If the symbol table is full, the element becomes the
+ * hash of the string instead, such that it is still matched by msg_compareHash() and
+ * msg_compareSymbol(), though msg_isSymbol() is false. msg_getNumSymbolOverflows() counts these.
+ */
+void msg_setSymbol(HvMessage *m, int index, const char *s);
+
+/**
+ * Sets the element to a symbol interned beforehand with msg_internSymbol(), without looking it
+ * up again. Where interning failed, symbolIndex is HV_MSG_SYMBOL_TABLE_SIZE and the element
+ * becomes the hash h of the symbol, as in msg_setSymbol().
+ */
+static inline void msg_setInternedSymbol(HvMessage *m, int index, hv_uint32_t symbolIndex, hv_uint32_t h) {
   hv_assert(index < msg_getNumElements(m)); // invalid index
-  hv_assert(s != NULL);
-  (&(m->elem)+index)->type = HV_MSG_SYMBOL;
-  (&(m->elem)+index)->data.s = s;
-  // NOTE(mhroth): if the same message container is reused and string reset,
-  // then the message size will be overcounted
-  m->numBytes += (hv_uint16_t) (hv_strlen(s) + 1); // also count '\0'
+  if (symbolIndex < HV_MSG_SYMBOL_TABLE_SIZE) {
+    __msg_setType(m, index, HV_MSG_SYMBOL);
+    (&(m->elem)+index)->data.s = symbolIndex;
+  } else {
+    msg_setHash(m, index, h);
+  }
 }
 
 static inline const char *msg_getSymbol(const HvMessage *m, int index) {
   hv_assert(index < msg_getNumElements(m)); // invalid index
-  return (&(m->elem)+index)->data.s;
+  return msg_getInternedSymbol((&(m->elem)+index)->data.s)->str;
 }
 
 static inline bool msg_isSymbol(const HvMessage *m, int index) {
@@ -165,6 +236,35 @@ static inline bool msg_isSymbol(const HvMessage *m, int index) {
 
 bool msg_compareSymbol(const HvMessage *m, int i, const char *s);
 
+/**
+ * Returns true if element i of message m is a symbol or hash matching the hash h.
+ * Prefer this to msg_compareSymbol() when h is known ahead of time, e.g. one of the
+ * HV_MSG_HASH_* constants below or hv_string_to_hash_k() of a literal in C++.
+ */
+static inline bool msg_compareHash(const HvMessage *m, int i, hv_uint32_t h) {
+  switch (msg_getType(m,i)) {
+    case HV_MSG_HASH: return ((&(m->elem)+i)->data.h == h);
+    case HV_MSG_SYMBOL: return (msg_getInternedSymbol((&(m->elem)+i)->data.s)->hash == h);
+    default: return false;
+  }
+}
+
+// Precomputed hashes of the symbols understood by the runtime objects.
+// These are checked against hv_string_to_hash_k() in HeavyContext.cpp.
+#define HV_MSG_HASH_FLUSH 0x6974723D // "flush"
+#define HV_MSG_HASH_CLEAR 0x47BE8354 // "clear"
+#define HV_MSG_HASH_STOP 0x7A5B032D // "stop"
+#define HV_MSG_HASH_RESIZE 0x190B711F // "resize"
+#define HV_MSG_HASH_MIRROR 0x78F019F0 // "mirror"
+#define HV_MSG_HASH_SAMPLERATE 0x8A83DA69 // "samplerate"
+#define HV_MSG_HASH_NUMINPUTCHANNELS 0xD5FAD3DB // "numInputChannels"
+#define HV_MSG_HASH_NUMOUTPUTCHANNELS 0x82B113B7 // "numOutputChannels"
+#define HV_MSG_HASH_CURRENTTIME 0x58DFAE4B // "currentTime"
+#define HV_MSG_HASH_TABLE 0x1443F360 // "table"
+#define HV_MSG_HASH_LENGTH 0x99557E93 // "length"
+#define HV_MSG_HASH_SIZE 0x4AD2D14C // "size"
+#define HV_MSG_HASH_HEAD 0xDDE687C9 // "head"
+
 /** Returns 1 if the element i_m of message m is equal to element i_n of message n. */
 bool msg_equalsElement(const HvMessage *m, int i_m, const HvMessage *n, int i_n);
 
@@ -103,12 +103,33 @@ void mp_free(HvMessagePool *mp) {
   }
 }
 
+void mp_reserve(HvMessagePool *mp) {
+  for (int i = 0; i < MP_NUM_MESSAGE_LISTS; i++) {
+    // a list never holds more nodes than there are chunks of its size in the buffer
+    HvMessagePoolList *ml = &mp->lists[i];
+    hv_size_t numNodes = 0;
+    for (MessageListNode *n = ml->head; n != NULL; n = n->next) ++numNodes;
+    for (MessageListNode *n = ml->pool; n != NULL; n = n->next) ++numNodes;
+    for (; numNodes < mp->bufferSize/(32 << i); ++numNodes) {
+      MessageListNode *n = (MessageListNode *) hv_malloc(sizeof(MessageListNode));
+      hv_assert(n != NULL);
+      n->p = NULL;
+      n->next = ml->pool;
+      ml->pool = n;
+    }
+  }
+  hv_prefault(mp->buffer, mp->bufferSize);
+}
+
 void mp_freeMessage(HvMessagePool *mp, HvMessage *m) {
   const hv_size_t b = msg_getSize(m); // the number of bytes that a message occupies in memory
   const hv_size_t i = mp_messagelistIndexForSize(b); // the HvMessagePoolList index in the pool
   HvMessagePoolList *ml = &mp->lists[i];
-  const hv_size_t chunkSize = 32 << i;
-  hv_memclear(m, chunkSize); // clear the chunk, just in case
+#ifndef NDEBUG
+  // only debug builds clear the chunk, so that stale references to it show up.
+  // Release builds skip it, every chunk is fully overwritten when it is next used.
+  hv_memclear(m, 32 << i);
+#endif
   ml_push(ml, m);
 }
 
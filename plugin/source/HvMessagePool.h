@@ -46,12 +46,23 @@ typedef struct HvMessagePool {
  * that point at each subblock (e.g. each 32-byte block of a 512-block chunk).
  *
  * HvMessagePool is loosely inspired by TCMalloc. http://goog-perftools.sourceforge.net/doc/tcmalloc.html
+ *
+ * A message is copied into the pool once, when the context takes it from its input queue or an object
+ * schedules it, and the pool owns it until the message queue pops it. Objects are handed const references
+ * and copy what they keep, e.g. [delay] schedules a copy with its own timestamp. A message therefore never
+ * has more than one owner and is not reference counted.
  */
 
 hv_size_t mp_init(struct HvMessagePool *mp, hv_size_t numKB);
 
 void mp_free(struct HvMessagePool *mp);
 
+/**
+ * Allocates the list nodes of every chunk size up front, such that adding and freeing
+ * messages never allocates while the pool has space left. Also maps the pool buffer.
+ */
+void mp_reserve(struct HvMessagePool *mp);
+
 /**
  * Adds a message to the pool and returns a pointer to the copy. Returns NULL
  * if no space was available in the pool.
@@ -56,6 +56,20 @@ int mq_size(HvMessageQueue *q) {
   return size;
 }
 
+void mq_reserve(HvMessageQueue *q) {
+  // the smallest message takes 32 bytes of the pool
+  hv_size_t numNodes = (hv_size_t) mq_size(q);
+  for (MessageNode *n = q->pool; n != NULL; n = n->next) ++numNodes;
+  for (; numNodes < q->mp.bufferSize/32; ++numNodes) {
+    MessageNode *n = (MessageNode *) hv_malloc(sizeof(MessageNode));
+    hv_assert(n != NULL);
+    n->prev = NULL;
+    n->next = q->pool;
+    q->pool = n;
+  }
+  mp_reserve(&q->mp);
+}
+
 HvMessage *mq_addMessage(HvMessageQueue *q, const HvMessage *m, int let,
     void (*sendMessage)(HeavyContextInterface *, int, const HvMessage *)) {
   MessageNode *node = mq_getOrCreateNodeFromPool(q);
@@ -64,6 +78,8 @@ HvMessage *mq_addMessage(HvMessageQueue *q, const HvMessage *m, int let,
   node->sendMessage = sendMessage;
   node->prev = NULL;
   node->next = NULL;
+  node->objPrev = NULL;
+  node->objNext = NULL;
 
   if (q->tail != NULL) {
     // the list already contains elements
@@ -79,46 +95,39 @@ HvMessage *mq_addMessage(HvMessageQueue *q, const HvMessage *m, int let,
   return mq_node_getMessage(node);
 }
 
-HvMessage *mq_addMessageByTimestamp(HvMessageQueue *q, const HvMessage *m, int let,
+MessageNode *mq_addNodeByTimestamp(HvMessageQueue *q, const HvMessage *m, int let,
     void (*sendMessage)(HeavyContextInterface *, int, const HvMessage *)) {
-  if (mq_hasMessage(q)) {
-    MessageNode *n = mq_getOrCreateNodeFromPool(q);
-    n->m = mp_addMessage(&q->mp, m);
-    n->let = let;
-    n->sendMessage = sendMessage;
-
-    if (msg_getTimestamp(m) < msg_getTimestamp(q->head->m)) {
-      // the message occurs before the current head
-      n->next = q->head;
-      q->head->prev = n;
-      n->prev = NULL;
-      q->head = n;
-    } else if (msg_getTimestamp(m) >= msg_getTimestamp(q->tail->m)) {
-      // the message occurs after the current tail
-      n->next = NULL;
-      n->prev = q->tail;
-      q->tail->next = n;
-      q->tail = n;
-    } else {
-      // the message occurs somewhere between the head and tail
-      MessageNode *node = q->head;
-      while (node != NULL) {
-        if (msg_getTimestamp(m) < msg_getTimestamp(node->next->m)) {
-          MessageNode *r = node->next;
-          node->next = n;
-          n->next = r;
-          n->prev = node;
-          r->prev = n;
-          break;
-        }
-        node = node->next;
-      }
-    }
-    return n->m;
+  MessageNode *n = mq_getOrCreateNodeFromPool(q);
+  n->m = mp_addMessage(&q->mp, m);
+  n->let = let;
+  n->sendMessage = sendMessage;
+  n->objPrev = NULL;
+  n->objNext = NULL;
+
+  // messages are mostly scheduled at or after the current tail, so search from there,
+  // inserting after any message with the same timestamp
+  const hv_uint32_t ts = msg_getTimestamp(m);
+  MessageNode *node = q->tail;
+  while (node != NULL && msg_isTimestampBefore(ts, msg_getTimestamp(node->m))) {
+    node = node->prev;
+  }
+  n->prev = node;
+  if (node != NULL) {
+    n->next = node->next;
+    node->next = n;
   } else {
-    // add a message to the head
-    return mq_addMessage(q, m, let, sendMessage);
+    // the message occurs before the current head
+    n->next = q->head;
+    q->head = n;
   }
+  if (n->next != NULL) n->next->prev = n;
+  else q->tail = n;
+  return n;
+}
+
+HvMessage *mq_addMessageByTimestamp(HvMessageQueue *q, const HvMessage *m, int let,
+    void (*sendMessage)(HeavyContextInterface *, int, const HvMessage *)) {
+  return mq_node_getMessage(mq_addNodeByTimestamp(q, m, let, sendMessage));
 }
 
 void mq_pop(HvMessageQueue *q) {
@@ -183,6 +192,22 @@ bool mq_removeMessage(HvMessageQueue *q, HvMessage *m, void (*sendMessage)(Heavy
   return false;
 }
 
+void mq_removeNode(HvMessageQueue *q, MessageNode *n) {
+  mp_freeMessage(&q->mp, n->m);
+  n->m = NULL;
+  n->let = 0;
+  n->sendMessage = NULL;
+
+  if (n->prev != NULL) n->prev->next = n->next;
+  else q->head = n->next;
+  if (n->next != NULL) n->next->prev = n->prev;
+  else q->tail = n->prev;
+
+  n->next = q->pool;
+  n->prev = NULL;
+  q->pool = n;
+}
+
 void mq_clear(HvMessageQueue *q) {
   while (mq_hasMessage(q)) {
     mq_pop(q);
@@ -191,7 +216,7 @@ void mq_clear(HvMessageQueue *q) {
 
 void mq_clearAfter(HvMessageQueue *q, const hv_uint32_t timestamp) {
   MessageNode *n = q->tail;
-  while (n != NULL && timestamp <= msg_getTimestamp(n->m)) {
+  while (n != NULL && !msg_isTimestampBefore(msg_getTimestamp(n->m), timestamp)) {
     // free the node's message
     mp_freeMessage(&q->mp, n->m);
     n->m = NULL;
@@ -36,6 +36,8 @@ typedef struct MessageNode {
   HvMessage *m;
   void (*sendMessage)(HeavyContextInterface *, int, const HvMessage *);
   int let;
+  struct MessageNode *objPrev; // the object that scheduled the message may chain its nodes here
+  struct MessageNode *objNext;
 } MessageNode;
 
 /** A doubly linked list containing scheduled messages. */
@@ -52,6 +54,12 @@ void mq_free(HvMessageQueue *q);
 
 int mq_size(HvMessageQueue *q);
 
+/**
+ * Allocates a node for every message that fits into the message pool and reserves the pool,
+ * such that scheduling messages never allocates until the pool is exhausted.
+ */
+void mq_reserve(HvMessageQueue *q);
+
 static inline HvMessage *mq_node_getMessage(MessageNode *n) {
   return n->m;
 }
@@ -66,7 +74,7 @@ static inline bool mq_hasMessage(HvMessageQueue *q) {
 
 // true if there is a message and it occurs before (<) timestamp
 static inline bool mq_hasMessageBefore(HvMessageQueue *const q, const hv_uint32_t timestamp) {
-  return mq_hasMessage(q) && (msg_getTimestamp(mq_node_getMessage(q->head)) < timestamp);
+  return mq_hasMessage(q) && msg_isTimestampBefore(msg_getTimestamp(mq_node_getMessage(q->head)), timestamp);
 }
 
 static inline MessageNode *mq_peek(HvMessageQueue *q) {
@@ -81,6 +89,13 @@ HvMessage *mq_addMessage(HvMessageQueue *q, const HvMessage *m, int let,
 HvMessage *mq_addMessageByTimestamp(HvMessageQueue *q, const HvMessage *m, int let,
     void (*sendMessage)(HeavyContextInterface *, int, const HvMessage *));
 
+/**
+ * As mq_addMessageByTimestamp(), but returns the node holding the message. The node stays valid
+ * until the message is popped or the node is removed with mq_removeNode().
+ */
+MessageNode *mq_addNodeByTimestamp(HvMessageQueue *q, const HvMessage *m, int let,
+    void (*sendMessage)(HeavyContextInterface *, int, const HvMessage *));
+
 /** Pop the message at the head of the queue (and free its memory). */
 void mq_pop(HvMessageQueue *q);
 
@@ -88,6 +103,9 @@ void mq_pop(HvMessageQueue *q);
 bool mq_removeMessage(HvMessageQueue *q, HvMessage *m,
     void (*sendMessage)(HeavyContextInterface *, int, const HvMessage *));
 
+/** Remove a node from the queue (and free its message) in constant time. */
+void mq_removeNode(HvMessageQueue *q, MessageNode *n);
+
 /** Clears (and frees) all messages in the queue. */
 void mq_clear(HvMessageQueue *q);
 
@@ -0,0 +1,35 @@
+/**
+ * Copyright (c) 2014-2018 Enzien Audio Ltd.
+ *
+ * Permission to use, copy, modify, and/or distribute this software for any
+ * purpose with or without fee is hereby granted, provided that the above
+ * copyright notice and this permission notice appear in all copies.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL WARRANTIES WITH
+ * REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED WARRANTIES OF MERCHANTABILITY
+ * AND FITNESS. IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR ANY SPECIAL, DIRECT,
+ * INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES WHATSOEVER RESULTING FROM
+ * LOSS OF USE, DATA OR PROFITS, WHETHER IN AN ACTION OF CONTRACT, NEGLIGENCE OR
+ * OTHER TORTIOUS ACTION, ARISING OUT OF OR IN CONNECTION WITH THE USE OR
+ * PERFORMANCE OF THIS SOFTWARE.
+ */
+
+#include "HvProfile.h"
+
+hv_size_t hPf_format(char *buffer, hv_size_t size, const char *title,
+    const char *const *names, const hv_uint64_t *ticks, int numSections, hv_uint64_t numFrames) {
+  hv_uint64_t total = 0;
+  for (int i = 0; i < numSections; ++i) total += ticks[i];
+  const double perFrame = (numFrames > 0) ? (1.0/numFrames) : 0.0;
+  const double perTotal = (total > 0) ? (100.0/total) : 0.0;
+
+  // the length is accumulated as by snprintf, such that a short buffer reports the length it needs
+  hv_size_t n = 0;
+  n += hv_snprintf(buffer, size, "%s: %llu frames, %.1f " HV_PROFILE_TICK_NAME "/frame\n",
+      title, (unsigned long long) numFrames, total*perFrame);
+  for (int i = 0; i < numSections; ++i) {
+    n += hv_snprintf(buffer+hv_min_ui(n, size), size-hv_min_ui(n, size), "  %-12s %10.1f %6.1f%%\n",
+        names[i], ticks[i]*perFrame, ticks[i]*perTotal);
+  }
+  return n;
+}
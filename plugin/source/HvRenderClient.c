@@ -0,0 +1,214 @@
+/**
+ * Copyright (c) 2014-2018 Enzien Audio Ltd.
+ *
+ * Permission to use, copy, modify, and/or distribute this software for any
+ * purpose with or without fee is hereby granted, provided that the above
+ * copyright notice and this permission notice appear in all copies.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL WARRANTIES WITH
+ * REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED WARRANTIES OF MERCHANTABILITY
+ * AND FITNESS. IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR ANY SPECIAL, DIRECT,
+ * INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES WHATSOEVER RESULTING FROM
+ * LOSS OF USE, DATA OR PROFITS, WHETHER IN AN ACTION OF CONTRACT, NEGLIGENCE OR
+ * OTHER TORTIOUS ACTION, ARISING OUT OF OR IN CONNECTION WITH THE USE OR
+ * PERFORMANCE OF THIS SOFTWARE.
+ */
+
+#include "HvRenderClient.h"
+
+#if HV_RENDER_SERVER
+
+#include <errno.h>
+#include <fcntl.h>
+#include <signal.h>
+#include <string.h>
+#include <sys/mman.h>
+#include <unistd.h>
+
+// the server creates and warms up the context before it responds to an open request
+#define HV_RENDER_OPEN_TIMEOUT_MS 5000
+
+// the receivers of the MIDI inputs, as in the plugins
+#define HV_HASH_NOTEIN          0x67E37CA3
+#define HV_HASH_CTLIN           0x41BE0f9C
+#define HV_HASH_PGMIN           0x2E1EA03D
+#define HV_HASH_TOUCHIN         0x553925BD
+#define HV_HASH_BENDIN          0x3083F0F7
+#define HV_HASH_MIDIIN          0x149631bE
+#define HV_HASH_MIDIREALTIMEIN  0x6FFF0BCF
+
+// sends a request and waits for its response, returns its result or -1 on a timeout
+static int hRc_call(HvRenderClient *o, HvRenderOp op, int timeoutMs) {
+  HvRenderSlot *const s = o->slot;
+  if (!o->header->ready) return -1; // the server has stopped
+  s->op = (hv_uint32_t) op;
+  const hv_uint32_t request = ++o->request;
+  hRs_post(&s->request, request, &s->serverWaiting);
+  if (hRs_wait(&s->response, request-1, &s->clientWaiting, timeoutMs) != request) return -1;
+  return s->result;
+}
+
+// claims the first slot that is free or whose owner is gone
+static HvRenderSlot *hRc_claim(HvRenderHeader *h) {
+  const hv_int32_t pid = (hv_int32_t) getpid();
+  for (hv_uint32_t i = 0; i < h->numSlots; ++i) {
+    HvRenderSlot *const s = hRs_getSlot(h, (int) i);
+    const hv_int32_t owner = s->clientPid;
+    if (owner != 0 && (kill(owner, 0) == 0 || errno != ESRCH)) continue;
+    if (__sync_bool_compare_and_swap(&s->clientPid, owner, pid)) return s;
+  }
+  return NULL;
+}
+
+bool hRc_open(HvRenderClient *o, const char *name, int timeoutMs) {
+  o->header = NULL;
+  o->slot = NULL;
+  o->timeoutMs = timeoutMs;
+  o->numChannels = 0;
+
+  char path[256];
+  hv_snprintf(path, sizeof(path), "/%s", name);
+  const int fd = shm_open(path, O_RDWR, 0);
+  if (fd < 0) return false;
+  HvRenderHeader h;
+  if (read(fd, &h, sizeof(h)) != (ssize_t) sizeof(h) || h.magic != HV_RENDER_MAGIC
+      || h.version != HV_RENDER_VERSION || !h.ready) {
+    close(fd);
+    return false;
+  }
+  o->size = hRs_getSize((int) h.numSlots);
+  void *const p = mmap(NULL, o->size, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+  close(fd);
+  if (p == MAP_FAILED) return false;
+  o->header = (HvRenderHeader *) p;
+
+  o->slot = hRc_claim(o->header);
+  if (o->slot == NULL) {
+    fprintf(stderr, "heavy: all %u slots of the render server %s are in use\n", h.numSlots, path);
+    munmap(p, o->size);
+    o->header = NULL;
+    return false;
+  }
+
+  // a previous owner may have gone in the middle of a request
+  HvRenderSlot *const s = o->slot;
+  o->request = s->request;
+  if (s->response != o->request
+      && hRs_wait(&s->response, s->response, &s->clientWaiting, HV_RENDER_OPEN_TIMEOUT_MS) != o->request) {
+    hRc_close(o);
+    return false;
+  }
+
+  o->numChannels = hRc_call(o, HV_RENDER_OP_OPEN, hv_max_i(timeoutMs, HV_RENDER_OPEN_TIMEOUT_MS));
+  if (o->numChannels < 0) {
+    o->numChannels = 0;
+    hRc_close(o);
+    return false;
+  }
+  for (int k = 0; k < o->numChannels; ++k) o->outputs[k] = s->outputs[k];
+  hv_prefault(s->events, sizeof(s->events));
+  return true;
+}
+
+void hRc_close(HvRenderClient *o) {
+  if (o->header == NULL) return;
+  if (o->numChannels > 0) hRc_call(o, HV_RENDER_OP_CLOSE, o->timeoutMs);
+  __atomic_store_n(&o->slot->clientPid, 0, __ATOMIC_RELEASE);
+  munmap(o->header, o->size);
+  o->header = NULL;
+  o->slot = NULL;
+}
+
+// returns the space left in the event ring
+static hv_uint32_t hRc_getEventSpace(const HvRenderClient *o) {
+  const HvRenderSlot *const s = o->slot;
+  return HV_RENDER_EVENT_CAPACITY - (s->eventWriteIndex - __atomic_load_n(&s->eventReadIndex, __ATOMIC_ACQUIRE));
+}
+
+// writes an event into the ring without publishing it
+static void hRc_putEvent(HvRenderClient *o, hv_uint32_t *w, hv_uint32_t receiverHash,
+    hv_uint32_t sampleOffset, int numFloats, float x, float y, float z) {
+  HvFloatEvent *const e = o->slot->events + (*w & (HV_RENDER_EVENT_CAPACITY-1));
+  e->receiverHash = receiverHash;
+  e->sampleOffset = sampleOffset;
+  e->numFloats = (hv_uint32_t) numFloats;
+  e->f[0] = x;
+  e->f[1] = y;
+  e->f[2] = z;
+  ++*w;
+}
+
+bool hRc_sendFloats(HvRenderClient *o, hv_uint32_t receiverHash, hv_uint32_t sampleOffset,
+    int numFloats, float x, float y, float z) {
+  hv_assert(numFloats >= 1 && numFloats <= 3);
+  if (hRc_getEventSpace(o) < 1) return false;
+  hv_uint32_t w = o->slot->eventWriteIndex;
+  hRc_putEvent(o, &w, receiverHash, sampleOffset, numFloats, x, y, z);
+  __atomic_store_n(&o->slot->eventWriteIndex, w, __ATOMIC_RELEASE);
+  return true;
+}
+
+bool hRc_sendMidi(HvRenderClient *o, hv_uint32_t sampleOffset, const hv_uint8_t *data, hv_uint32_t size) {
+  if (size == 0) return true;
+  size = hv_min_ui(size, 4);
+  const int status = data[0];
+  const int command = status & 0xF0;
+  const int channel = status & 0x0F;
+  const int data1 = (size > 1) ? data[1] : 0;
+  const int data2 = (size > 2) ? data[2] : 0;
+  const bool realtime = (status == 0xF8 || status == 0xFA || status == 0xFB || status == 0xFC || status == 0xFF);
+  const bool voice = (command >= 0x80 && command <= 0xE0 && command != 0xA0);
+
+  // a message is queued whole or not at all
+  if (hRc_getEventSpace(o) < size + (realtime ? 1 : 0) + (voice ? 1 : 0)) return false;
+  hv_uint32_t w = o->slot->eventWriteIndex;
+
+  // raw [midiin] messages
+  for (hv_uint32_t j = 0; j < size; ++j) {
+    hRc_putEvent(o, &w, HV_HASH_MIDIIN, sampleOffset, 2, (float) data[j], (float) channel, 0.0f);
+  }
+  if (realtime) {
+    hRc_putEvent(o, &w, HV_HASH_MIDIREALTIMEIN, sampleOffset, 2, (float) status, 0.0f, 0.0f);
+  }
+
+  // typical midi messages
+  switch (command) {
+    case 0x80: { // note off
+      hRc_putEvent(o, &w, HV_HASH_NOTEIN, sampleOffset, 3, (float) data1, 0.0f, (float) channel);
+      break;
+    }
+    case 0x90: { // note on
+      hRc_putEvent(o, &w, HV_HASH_NOTEIN, sampleOffset, 3, (float) data1, (float) data2, (float) channel);
+      break;
+    }
+    case 0xB0: { // control change
+      hRc_putEvent(o, &w, HV_HASH_CTLIN, sampleOffset, 3, (float) data2, (float) data1, (float) channel);
+      break;
+    }
+    case 0xC0: { // program change
+      hRc_putEvent(o, &w, HV_HASH_PGMIN, sampleOffset, 2, (float) data1, (float) channel, 0.0f);
+      break;
+    }
+    case 0xD0: { // aftertouch
+      hRc_putEvent(o, &w, HV_HASH_TOUCHIN, sampleOffset, 2, (float) data1, (float) channel, 0.0f);
+      break;
+    }
+    case 0xE0: { // pitch bend
+      // combine 7bit lsb and msb into 32bit int
+      const hv_uint32_t value = (((hv_uint32_t) data2) << 7) | ((hv_uint32_t) data1);
+      hRc_putEvent(o, &w, HV_HASH_BENDIN, sampleOffset, 2, (float) value, (float) channel, 0.0f);
+      break;
+    }
+    default: break;
+  }
+  __atomic_store_n(&o->slot->eventWriteIndex, w, __ATOMIC_RELEASE);
+  return true;
+}
+
+int hRc_process(HvRenderClient *o, int n) {
+  hv_assert(n >= 0 && n <= HV_RENDER_MAX_FRAMES);
+  o->slot->numFrames = (hv_uint32_t) n;
+  return hRc_call(o, HV_RENDER_OP_PROCESS, o->timeoutMs);
+}
+
+#endif // HV_RENDER_SERVER
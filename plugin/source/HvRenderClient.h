@@ -0,0 +1,94 @@
+/**
+ * Copyright (c) 2014-2018 Enzien Audio Ltd.
+ *
+ * Permission to use, copy, modify, and/or distribute this software for any
+ * purpose with or without fee is hereby granted, provided that the above
+ * copyright notice and this permission notice appear in all copies.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL WARRANTIES WITH
+ * REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED WARRANTIES OF MERCHANTABILITY
+ * AND FITNESS. IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR ANY SPECIAL, DIRECT,
+ * INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES WHATSOEVER RESULTING FROM
+ * LOSS OF USE, DATA OR PROFITS, WHETHER IN AN ACTION OF CONTRACT, NEGLIGENCE OR
+ * OTHER TORTIOUS ACTION, ARISING OUT OF OR IN CONNECTION WITH THE USE OR
+ * PERFORMANCE OF THIS SOFTWARE.
+ */
+
+#ifndef _HEAVY_RENDER_CLIENT_H_
+#define _HEAVY_RENDER_CLIENT_H_
+
+#include "HvRenderServer.h"
+
+/**
+ * Renders a context hosted by a render server in another process, see HvRenderServer.h. Linux
+ * only.
+ *
+ * A client owns one slot of the server and must be used from one thread at a time. Events are
+ * written straight into the ring of the slot and are handed to the context at the start of the
+ * next block, with their sample offsets relative to it. hRc_process() blocks until the server has
+ * rendered the block, and the output can then be read in place until the next call.
+ */
+
+#if HV_RENDER_SERVER
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+typedef struct HvRenderClient {
+  HvRenderHeader *header; // NULL if closed
+  hv_size_t size; // of the mapping
+  HvRenderSlot *slot;
+  hv_uint32_t request; // the last request sent
+  int timeoutMs;
+  int numChannels;
+  const float *outputs[HV_RENDER_MAX_CHANNELS]; // of the last block, in the shared memory
+} HvRenderClient;
+
+/**
+ * Maps the shared memory object of the server /<name>, claims a free slot, or the slot of a client
+ * that is gone, and has the server create its context. The server must respond to each request
+ * within timeoutMs milliseconds, or the client gives up. Returns false if no slot could be opened.
+ */
+bool hRc_open(HvRenderClient *o, const char *name, int timeoutMs);
+
+/** Has the server free the context and releases the slot. */
+void hRc_close(HvRenderClient *o);
+
+static inline bool hRc_isOpen(const HvRenderClient *o) {
+  return (o->header != NULL);
+}
+
+/**
+ * Queues an event of 1 to 3 floats for the next block. Returns false if the ring of the slot is
+ * full.
+ */
+bool hRc_sendFloats(HvRenderClient *o, hv_uint32_t receiverHash, hv_uint32_t sampleOffset,
+    int numFloats, float x, float y, float z);
+
+/**
+ * Queues a MIDI channel message for the next block, as the plugins turn it into messages to
+ * __hv_notein, __hv_ctlin, __hv_pgmin, __hv_touchin, __hv_bendin and __hv_midiin. Returns false
+ * if the ring of the slot is full.
+ */
+bool hRc_sendMidi(HvRenderClient *o, hv_uint32_t sampleOffset, const hv_uint8_t *data, hv_uint32_t size);
+
+/**
+ * Renders a block of n frames, a multiple of HV_N_SIMD of at most HV_RENDER_MAX_FRAMES. Returns the
+ * number of frames rendered into o->outputs, or -1 if the server failed or did not respond in
+ * time, after which the client should be closed.
+ */
+int hRc_process(HvRenderClient *o, int n);
+
+/** Returns the number of events that did not fit into the input queue of the context. */
+static inline hv_uint32_t hRc_getNumDroppedEvents(const HvRenderClient *o) {
+  return o->slot->numDroppedEvents;
+}
+
+#ifdef __cplusplus
+} // extern "C"
+#endif
+
+#endif // HV_RENDER_SERVER
+
+#endif // _HEAVY_RENDER_CLIENT_H_
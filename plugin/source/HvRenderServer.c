@@ -0,0 +1,312 @@
+/**
+ * Copyright (c) 2014-2018 Enzien Audio Ltd.
+ *
+ * Permission to use, copy, modify, and/or distribute this software for any
+ * purpose with or without fee is hereby granted, provided that the above
+ * copyright notice and this permission notice appear in all copies.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL WARRANTIES WITH
+ * REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED WARRANTIES OF MERCHANTABILITY
+ * AND FITNESS. IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR ANY SPECIAL, DIRECT,
+ * INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES WHATSOEVER RESULTING FROM
+ * LOSS OF USE, DATA OR PROFITS, WHETHER IN AN ACTION OF CONTRACT, NEGLIGENCE OR
+ * OTHER TORTIOUS ACTION, ARISING OUT OF OR IN CONNECTION WITH THE USE OR
+ * PERFORMANCE OF THIS SOFTWARE.
+ */
+
+#include "HvRenderServer.h"
+#include "HvMessage.h"
+
+#if HV_RENDER_SERVER
+
+#if !defined(__linux__)
+#error "HV_RENDER_SERVER is only supported on Linux"
+#endif
+
+#include <errno.h>
+#include <fcntl.h>
+#include <limits.h>
+#include <linux/futex.h>
+#include <sched.h>
+#include <signal.h>
+#include <string.h>
+#include <sys/mman.h>
+#include <sys/syscall.h>
+#include <time.h>
+#include <unistd.h>
+
+static inline void hRs_pause(void) {
+#if defined(__x86_64__) || defined(__i386__)
+  __builtin_ia32_pause();
+#elif defined(__aarch64__)
+  __asm__ volatile ("yield");
+#endif
+}
+
+static hv_uint64_t hRs_getClockNs(void) {
+  struct timespec t;
+  clock_gettime(CLOCK_MONOTONIC, &t);
+  return (hv_uint64_t) t.tv_sec*1000000000 + (hv_uint64_t) t.tv_nsec;
+}
+
+// the futexes are shared between processes, so the private operations cannot be used
+static long hRs_futex(volatile hv_uint32_t *word, int op, hv_uint32_t value, const struct timespec *timeout) {
+  return syscall(SYS_futex, (hv_uint32_t *) word, op, value, timeout, NULL, 0);
+}
+
+// spinning only delays the other side if both share a single core
+static int hRs_getSpin(void) {
+  static int spin = -1;
+  if (spin < 0) spin = (sysconf(_SC_NPROCESSORS_ONLN) > 1) ? HV_RENDER_SPIN : 0;
+  return spin;
+}
+
+hv_uint32_t hRs_wait(volatile hv_uint32_t *seq, hv_uint32_t old, volatile hv_uint32_t *waiting, int timeoutMs) {
+  const int spin = hRs_getSpin();
+  for (int i = 0; i < spin; ++i) {
+    const hv_uint32_t v = __atomic_load_n(seq, __ATOMIC_ACQUIRE);
+    if (v != old) return v;
+    hRs_pause();
+  }
+
+  const hv_uint64_t deadline = (timeoutMs >= 0) ? hRs_getClockNs() + (hv_uint64_t) timeoutMs*1000000 : 0;
+  while (true) {
+    // either the other side sees the flag after publishing, or this side sees the new value,
+    // see hRs_post()
+    *waiting = 1;
+    __atomic_thread_fence(__ATOMIC_SEQ_CST);
+    hv_uint32_t v = __atomic_load_n(seq, __ATOMIC_ACQUIRE);
+    if (v != old) {
+      *waiting = 0;
+      return v;
+    }
+
+    struct timespec t;
+    if (timeoutMs >= 0) {
+      const hv_uint64_t now = hRs_getClockNs();
+      if (now >= deadline) {
+        *waiting = 0;
+        return v;
+      }
+      t.tv_sec = (time_t) ((deadline-now) / 1000000000);
+      t.tv_nsec = (long) ((deadline-now) % 1000000000);
+    }
+    // returns at once if the value has changed since it was read
+    hRs_futex(seq, FUTEX_WAIT, old, (timeoutMs >= 0) ? &t : NULL);
+    *waiting = 0;
+    v = __atomic_load_n(seq, __ATOMIC_ACQUIRE);
+    if (v != old) return v;
+  }
+}
+
+void hRs_post(volatile hv_uint32_t *seq, hv_uint32_t value, volatile hv_uint32_t *waiting) {
+  __atomic_store_n(seq, value, __ATOMIC_RELEASE);
+  __atomic_thread_fence(__ATOMIC_SEQ_CST);
+  if (*waiting) hRs_futex(seq, FUTEX_WAKE, INT_MAX, NULL);
+}
+
+// number of events copied out of the ring at a time
+#define HV_RENDER_EVENT_BATCH 64
+
+// hands the pending events to the context, dropping invalid ones. The client can write to the ring
+// at any time, so each event is copied before it is checked.
+static void hRs_sendEvents(HvRenderThread *t) {
+  HvRenderSlot *const s = t->slot;
+  const hv_uint32_t w = __atomic_load_n(&s->eventWriteIndex, __ATOMIC_ACQUIRE);
+  hv_uint32_t r = s->eventReadIndex;
+  hv_uint32_t numDropped = 0;
+  HvFloatEvent events[HV_RENDER_EVENT_BATCH];
+  while (r != w) {
+    const int n = (int) hv_min_ui(w-r, HV_RENDER_EVENT_BATCH);
+    int numValid = 0;
+    for (int i = 0; i < n; ++i) {
+      HvFloatEvent *const e = events+numValid;
+      memcpy(e, (const void *) (s->events + ((r+(hv_uint32_t) i) & (HV_RENDER_EVENT_CAPACITY-1))), sizeof(HvFloatEvent));
+      if (e->numFloats >= 1 && e->numFloats <= 3 && e->sampleOffset <= HV_MAX_TIMESTAMP_OFFSET) ++numValid;
+    }
+    const int numSent = (numValid > 0) ? hv_sendFloatEvents(t->context, events, numValid) : 0;
+    numDropped += (hv_uint32_t) (n-numSent);
+    r += (hv_uint32_t) n;
+  }
+  if (numDropped > 0) s->numDroppedEvents = s->numDroppedEvents + numDropped;
+  __atomic_store_n(&s->eventReadIndex, r, __ATOMIC_RELEASE);
+}
+
+static hv_int32_t hRs_handle(HvRenderThread *t) {
+  HvRenderServer *const o = t->server;
+  HvRenderSlot *const s = t->slot;
+  switch (s->op) {
+    case HV_RENDER_OP_OPEN: {
+      // the previous owner may have gone without closing the slot
+      if (t->context != NULL) o->freeContext(t->context);
+      t->context = o->newContext(o->sampleRate);
+      if (t->context == NULL) return -1;
+      hv_warmUp(t->context);
+      s->eventReadIndex = s->eventWriteIndex; // events of a previous owner
+      s->numDroppedEvents = 0;
+      return (hv_int32_t) o->numChannels;
+    }
+    case HV_RENDER_OP_PROCESS: {
+      const hv_uint32_t n = s->numFrames;
+      if (t->context == NULL || n > HV_RENDER_MAX_FRAMES) return -1;
+      hRs_sendEvents(t);
+      float *outputs[HV_RENDER_MAX_CHANNELS];
+      for (hv_uint32_t k = 0; k < o->numChannels; ++k) outputs[k] = s->outputs[k];
+      return (hv_int32_t) hv_process(t->context, NULL, outputs, (int) n);
+    }
+    case HV_RENDER_OP_CLOSE: {
+      if (t->context != NULL) o->freeContext(t->context);
+      t->context = NULL;
+      return 0;
+    }
+    default: return -1;
+  }
+}
+
+static void *hRs_run(void *x) {
+  HvRenderThread *const t = (HvRenderThread *) x;
+  HvRenderSlot *const s = t->slot;
+  hv_uint32_t seq = s->response;
+  while (t->server->running) {
+    const hv_uint32_t request = hRs_wait(&s->request, seq, &s->serverWaiting, HV_RENDER_IDLE_MS);
+    if (request == seq) continue;
+    seq = request;
+    s->result = hRs_handle(t);
+    hRs_post(&s->response, seq, &s->clientWaiting);
+  }
+  return NULL;
+}
+
+// maps a new shared memory object, returns false if another server uses the name
+static bool hRs_create(HvRenderServer *o, int numSlots) {
+  int fd = shm_open(o->name, O_RDWR | O_CREAT | O_EXCL, 0600);
+  if (fd < 0 && errno == EEXIST) {
+    // replace the object of a server that is gone
+    const int oldFd = shm_open(o->name, O_RDONLY, 0);
+    if (oldFd >= 0) {
+      HvRenderHeader h;
+      const bool live = (read(oldFd, &h, sizeof(h)) == (ssize_t) sizeof(h)) && h.magic == HV_RENDER_MAGIC
+          && (kill(h.serverPid, 0) == 0 || errno != ESRCH);
+      close(oldFd);
+      if (live) {
+        fprintf(stderr, "heavy: the render server %s is already running as pid %d\n", o->name, h.serverPid);
+        return false;
+      }
+    }
+    shm_unlink(o->name);
+    fd = shm_open(o->name, O_RDWR | O_CREAT | O_EXCL, 0600);
+  }
+  if (fd < 0) {
+    fprintf(stderr, "heavy: could not create %s: %s\n", o->name, strerror(errno));
+    return false;
+  }
+
+  o->size = hRs_getSize(numSlots);
+  void *const p = (ftruncate(fd, (off_t) o->size) == 0)
+      ? mmap(NULL, o->size, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0) : MAP_FAILED;
+  if (p == MAP_FAILED) {
+    fprintf(stderr, "heavy: could not map %s: %s\n", o->name, strerror(errno));
+    close(fd);
+    shm_unlink(o->name);
+    return false;
+  }
+  close(fd); // the mapping holds the object
+  hv_prefault(p, o->size); // the object starts out zeroed
+  o->header = (HvRenderHeader *) p;
+  return true;
+}
+
+bool hRs_open(HvRenderServer *o, const char *name, int numSlots, double sampleRate, int priority,
+    HeavyContextInterface *(*newContext)(double sampleRate), void (*freeContext)(HeavyContextInterface *c)) {
+  hv_assert(numSlots > 0);
+  o->header = NULL;
+  o->threads = NULL;
+  o->running = false;
+  o->newContext = newContext;
+  o->freeContext = freeContext;
+  o->numSlots = (hv_uint32_t) numSlots;
+  o->numChannels = 0;
+  o->sampleRate = sampleRate;
+  hv_snprintf(o->name, sizeof(o->name), "/%s", name);
+
+  // every slot has the channels of the first context
+  HeavyContextInterface *const c = newContext(sampleRate);
+  if (c == NULL) return false;
+  const int numChannels = hv_getNumOutputChannels(c);
+  freeContext(c);
+  if (numChannels > HV_RENDER_MAX_CHANNELS) {
+    fprintf(stderr, "heavy: the render server supports at most %d channels\n", HV_RENDER_MAX_CHANNELS);
+    return false;
+  }
+  o->numChannels = (hv_uint32_t) numChannels;
+
+  if (!hRs_create(o, numSlots)) return false;
+  HvRenderHeader *const h = o->header;
+  h->version = HV_RENDER_VERSION;
+  h->numSlots = (hv_uint32_t) numSlots;
+  h->numChannels = (hv_uint32_t) numChannels;
+  h->maxFrames = HV_RENDER_MAX_FRAMES;
+  h->serverPid = (hv_int32_t) getpid();
+  h->sampleRate = sampleRate;
+
+  pthread_attr_t attr;
+  pthread_attr_init(&attr);
+  if (priority > 0) {
+    struct sched_param param;
+    param.sched_priority = priority;
+    pthread_attr_setinheritsched(&attr, PTHREAD_EXPLICIT_SCHED);
+    pthread_attr_setschedpolicy(&attr, SCHED_FIFO);
+    pthread_attr_setschedparam(&attr, &param);
+  }
+
+  o->threads = (HvRenderThread *) hv_malloc(numSlots*sizeof(HvRenderThread));
+  hv_assert(o->threads != NULL);
+  o->running = true;
+  bool success = true;
+  for (int i = 0; i < numSlots; ++i) {
+    HvRenderThread *const t = o->threads+i;
+    t->server = o;
+    t->slot = hRs_getSlot(h, i);
+    t->context = NULL;
+    t->started = success && (pthread_create(&t->thread, &attr, &hRs_run, t) == 0);
+    if (!t->started && success) {
+      fprintf(stderr, "heavy: could not start the render threads%s\n",
+          (priority > 0) ? ", check the rtprio limit of the user" : "");
+      success = false;
+    }
+  }
+  pthread_attr_destroy(&attr);
+  if (!success) {
+    hRs_close(o);
+    return false;
+  }
+
+  // clients only use the object once it is complete
+  __atomic_store_n(&h->magic, HV_RENDER_MAGIC, __ATOMIC_RELEASE);
+  __atomic_store_n(&h->ready, 1, __ATOMIC_RELEASE);
+  return true;
+}
+
+void hRs_close(HvRenderServer *o) {
+  if (o->header == NULL) return;
+  o->running = false;
+  const int numSlots = (int) o->numSlots;
+  for (int i = 0; i < numSlots; ++i) {
+    HvRenderThread *const t = o->threads+i;
+    if (t->started) {
+      hRs_futex(&t->slot->request, FUTEX_WAKE, INT_MAX, NULL);
+      pthread_join(t->thread, NULL);
+    }
+    if (t->context != NULL) o->freeContext(t->context);
+  }
+  hv_free(o->threads);
+  o->threads = NULL;
+
+  // clients waiting on a response time out
+  o->header->ready = 0;
+  shm_unlink(o->name);
+  munmap(o->header, o->size);
+  o->header = NULL;
+}
+
+#endif // HV_RENDER_SERVER
@@ -0,0 +1,177 @@
+/**
+ * Copyright (c) 2014-2018 Enzien Audio Ltd.
+ *
+ * Permission to use, copy, modify, and/or distribute this software for any
+ * purpose with or without fee is hereby granted, provided that the above
+ * copyright notice and this permission notice appear in all copies.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL WARRANTIES WITH
+ * REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED WARRANTIES OF MERCHANTABILITY
+ * AND FITNESS. IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR ANY SPECIAL, DIRECT,
+ * INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES WHATSOEVER RESULTING FROM
+ * LOSS OF USE, DATA OR PROFITS, WHETHER IN AN ACTION OF CONTRACT, NEGLIGENCE OR
+ * OTHER TORTIOUS ACTION, ARISING OUT OF OR IN CONNECTION WITH THE USE OR
+ * PERFORMANCE OF THIS SOFTWARE.
+ */
+
+#ifndef _HEAVY_RENDER_SERVER_H_
+#define _HEAVY_RENDER_SERVER_H_
+
+#include "HvHeavy.h"
+
+/**
+ * Hosts many contexts in a server process and renders them for clients in other processes, such
+ * that a crashing context cannot take its host down. Built with HV_RENDER_SERVER, see
+ * plugin/server. Linux only.
+ *
+ * The server creates a POSIX shared memory object of numSlots slots. A client claims a free slot
+ * (see HvRenderClient.h) and owns the context of that slot until it closes it or exits. Each slot
+ * holds a ring of float events written by the client and the output buffers of one block, which
+ * the server renders into in place, so that nothing is copied on either side. Each slot has its
+ * own server thread.
+ *
+ * A request is a sequence number in the slot. The client writes its events and the block size,
+ * advances the request and waits until the server has advanced the response to the same number.
+ * On machines with more than one core, both sides spin for HV_RENDER_SPIN iterations before they
+ * sleep on a futex. A side only makes the wake up system call if the other side sleeps.
+ */
+
+#ifndef HV_RENDER_SERVER
+#define HV_RENDER_SERVER 0
+#endif
+
+#if HV_RENDER_SERVER
+
+#include <pthread.h>
+
+#define HV_RENDER_MAGIC 0x73527648 // "HvRs"
+#define HV_RENDER_VERSION 1
+
+// the largest block a client can request
+#ifndef HV_RENDER_MAX_FRAMES
+#define HV_RENDER_MAX_FRAMES 2048
+#endif
+
+#define HV_RENDER_MAX_CHANNELS 8
+
+// number of float events held by the ring of each slot, a power of two
+#ifndef HV_RENDER_EVENT_CAPACITY
+#define HV_RENDER_EVENT_CAPACITY 1024
+#endif
+
+// polls of a sequence number before waiting on its futex
+#ifndef HV_RENDER_SPIN
+#define HV_RENDER_SPIN 4000
+#endif
+
+// wake up period of an idle slot thread, such that it notices when the server stops
+#define HV_RENDER_IDLE_MS 100
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+typedef enum HvRenderOp {
+  HV_RENDER_OP_OPEN, // create the context of the slot, freeing the one of a previous owner
+  HV_RENDER_OP_PROCESS, // send the pending events and render numFrames frames
+  HV_RENDER_OP_CLOSE // free the context of the slot
+} HvRenderOp;
+
+typedef struct HvRenderSlot {
+  // written by the client
+  volatile hv_uint32_t request __attribute__((aligned(64))); // futex
+  volatile hv_uint32_t op;
+  volatile hv_uint32_t numFrames;
+  volatile hv_uint32_t eventWriteIndex;
+  volatile hv_int32_t clientPid; // of the owner, 0 if the slot is free
+  volatile hv_uint32_t clientWaiting; // the client sleeps on the response futex
+
+  // written by the server
+  volatile hv_uint32_t response __attribute__((aligned(64))); // futex, the last request handled
+  volatile hv_int32_t result; // of the last request, frames rendered or -1 on failure
+  volatile hv_uint32_t eventReadIndex;
+  volatile hv_uint32_t numDroppedEvents; // invalid or not accepted by a full input queue
+  volatile hv_uint32_t serverWaiting; // the server sleeps on the request futex
+
+  HvFloatEvent events[HV_RENDER_EVENT_CAPACITY] __attribute__((aligned(64)));
+  float outputs[HV_RENDER_MAX_CHANNELS][HV_RENDER_MAX_FRAMES] __attribute__((aligned(64)));
+} HvRenderSlot;
+
+typedef struct HvRenderHeader {
+  hv_uint32_t magic;
+  hv_uint32_t version;
+  hv_uint32_t numSlots;
+  hv_uint32_t numChannels; // output channels of each context
+  hv_uint32_t maxFrames;
+  hv_int32_t serverPid;
+  double sampleRate;
+  volatile hv_uint32_t ready; // set once all slot threads run
+} HvRenderHeader;
+
+// the slots start at this offset into the shared memory object
+#define HV_RENDER_HEADER_SIZE 4096
+
+typedef struct HvRenderServer HvRenderServer;
+
+typedef struct HvRenderThread {
+  HvRenderServer *server;
+  HvRenderSlot *slot;
+  HeavyContextInterface *context; // NULL while the slot is closed
+  pthread_t thread;
+  bool started;
+} HvRenderThread;
+
+struct HvRenderServer {
+  char name[256]; // of the shared memory object, with a leading slash
+  HvRenderHeader *header; // NULL if closed
+  hv_size_t size; // of the mapping
+  HvRenderThread *threads; // one per slot
+  // the server only trusts its own copies, as clients can write to the header
+  hv_uint32_t numSlots;
+  hv_uint32_t numChannels; // output channels of each context
+  double sampleRate;
+  volatile bool running;
+  HeavyContextInterface *(*newContext)(double sampleRate);
+  void (*freeContext)(HeavyContextInterface *c);
+};
+
+/**
+ * Creates the shared memory object /<name> with numSlots slots, replacing a stale one left by a
+ * server that is gone, and starts a thread per slot. The threads run SCHED_FIFO at the given
+ * priority, or inherit the scheduling of the caller if it is zero. Contexts are made and freed
+ * with the given functions, e.g. hv_EP_MK1_new() and hv_EP_MK1_free(). Returns false if the
+ * server could not be started.
+ */
+bool hRs_open(HvRenderServer *o, const char *name, int numSlots, double sampleRate, int priority,
+    HeavyContextInterface *(*newContext)(double sampleRate), void (*freeContext)(HeavyContextInterface *c));
+
+/** Stops the slot threads, frees all contexts and removes the shared memory object. */
+void hRs_close(HvRenderServer *o);
+
+/** Returns the slot at the given index of a mapped shared memory object. */
+static inline HvRenderSlot *hRs_getSlot(HvRenderHeader *h, int index) {
+  return ((HvRenderSlot *) (((char *) h) + HV_RENDER_HEADER_SIZE)) + index;
+}
+
+/** Returns the size of a shared memory object of numSlots slots. */
+static inline hv_size_t hRs_getSize(int numSlots) {
+  return HV_RENDER_HEADER_SIZE + numSlots*sizeof(HvRenderSlot);
+}
+
+/**
+ * Waits while the sequence number *seq equals old, for at most timeoutMs milliseconds or forever
+ * if it is negative. *waiting tells the other side to wake this one. Returns the sequence number,
+ * which still equals old after a timeout.
+ */
+hv_uint32_t hRs_wait(volatile hv_uint32_t *seq, hv_uint32_t old, volatile hv_uint32_t *waiting, int timeoutMs);
+
+/** Publishes a new sequence number and wakes the other side if it waits on it. */
+void hRs_post(volatile hv_uint32_t *seq, hv_uint32_t value, volatile hv_uint32_t *waiting);
+
+#ifdef __cplusplus
+} // extern "C"
+#endif
+
+#endif // HV_RENDER_SERVER
+
+#endif // _HEAVY_RENDER_SERVER_H_
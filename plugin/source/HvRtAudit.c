@@ -0,0 +1,334 @@
+/**
+ * Copyright (c) 2014-2018 Enzien Audio Ltd.
+ *
+ * Permission to use, copy, modify, and/or distribute this software for any
+ * purpose with or without fee is hereby granted, provided that the above
+ * copyright notice and this permission notice appear in all copies.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL WARRANTIES WITH
+ * REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED WARRANTIES OF MERCHANTABILITY
+ * AND FITNESS. IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR ANY SPECIAL, DIRECT,
+ * INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES WHATSOEVER RESULTING FROM
+ * LOSS OF USE, DATA OR PROFITS, WHETHER IN AN ACTION OF CONTRACT, NEGLIGENCE OR
+ * OTHER TORTIOUS ACTION, ARISING OUT OF OR IN CONNECTION WITH THE USE OR
+ * PERFORMANCE OF THIS SOFTWARE.
+ */
+
+#if defined(__linux__) && !defined(_GNU_SOURCE)
+#define _GNU_SOURCE // RTLD_NEXT, dlvsym()
+#endif
+
+#include "HvRtAudit.h"
+
+#if HV_RT_AUDIT
+
+#if defined(__GLIBC__)
+
+#include <dlfcn.h>
+#include <errno.h>
+#include <execinfo.h>
+#include <pthread.h>
+#include <stdarg.h>
+#include <stdlib.h>
+#include <time.h>
+#include <unistd.h>
+#include <sys/syscall.h>
+#if defined(__linux__)
+#include <linux/futex.h>
+#endif
+
+// the C library entry points behind the interposed functions
+extern void *__libc_malloc(size_t n);
+extern void *__libc_calloc(size_t m, size_t n);
+extern void *__libc_realloc(void *p, size_t n);
+extern void __libc_free(void *p);
+extern void *__libc_memalign(size_t alignment, size_t n);
+extern ssize_t __write(int fd, const void *buffer, size_t n);
+extern ssize_t __read(int fd, void *buffer, size_t n);
+extern int __nanosleep(const struct timespec *t, struct timespec *remaining);
+
+typedef struct RtTrace {
+  const char *call;
+  hv_uint32_t hash;
+  hv_uint32_t count;
+  int numFrames;
+  void *frames[HV_RT_AUDIT_MAX_FRAMES];
+} RtTrace;
+
+static __thread int rtDepth; // nesting of realtime regions on this thread
+static __thread int rtInHook; // a violation is being recorded on this thread
+
+static RtTrace rtTraces[HV_RT_AUDIT_MAX_TRACES];
+static hv_uint32_t rtNumTraces;
+static hv_uint32_t rtNumViolations;
+static bool rtAbortOnViolation;
+
+// the next definitions of the interposed functions that the C library does not export under
+// another name, see hRt_resolve()
+static int (*rtMutexLock)(pthread_mutex_t *m);
+static int (*rtMutexTimedLock)(pthread_mutex_t *m, const struct timespec *t);
+static int (*rtRwlockRdLock)(pthread_rwlock_t *l);
+static int (*rtRwlockWrLock)(pthread_rwlock_t *l);
+static int (*rtRwlockTimedRdLock)(pthread_rwlock_t *l, const struct timespec *t);
+static int (*rtRwlockTimedWrLock)(pthread_rwlock_t *l, const struct timespec *t);
+static int (*rtCondWait)(pthread_cond_t *c, pthread_mutex_t *m);
+static int (*rtCondTimedWait)(pthread_cond_t *c, pthread_mutex_t *m, const struct timespec *t);
+static int (*rtClockNanosleep)(clockid_t clock, int flags, const struct timespec *t, struct timespec *remaining);
+static long (*rtSyscall)(long number, ...);
+
+// the condition variable functions have two versions, and dlsym() may find the old one
+static void *hRt_nextVersioned(const char *name) {
+  void *const f = dlvsym(RTLD_NEXT, name, "GLIBC_2.3.2");
+  return (f != NULL) ? f : dlsym(RTLD_NEXT, name);
+}
+
+// other constructors may call the interposed functions before hRt_init(), so each resolves the
+// next definitions on its first call
+static void hRt_resolve(void) {
+  *(void **) &rtMutexLock = dlsym(RTLD_NEXT, "pthread_mutex_lock");
+  *(void **) &rtMutexTimedLock = dlsym(RTLD_NEXT, "pthread_mutex_timedlock");
+  *(void **) &rtRwlockRdLock = dlsym(RTLD_NEXT, "pthread_rwlock_rdlock");
+  *(void **) &rtRwlockWrLock = dlsym(RTLD_NEXT, "pthread_rwlock_wrlock");
+  *(void **) &rtRwlockTimedRdLock = dlsym(RTLD_NEXT, "pthread_rwlock_timedrdlock");
+  *(void **) &rtRwlockTimedWrLock = dlsym(RTLD_NEXT, "pthread_rwlock_timedwrlock");
+  *(void **) &rtCondWait = hRt_nextVersioned("pthread_cond_wait");
+  *(void **) &rtCondTimedWait = hRt_nextVersioned("pthread_cond_timedwait");
+  *(void **) &rtClockNanosleep = dlsym(RTLD_NEXT, "clock_nanosleep");
+  *(void **) &rtSyscall = dlsym(RTLD_NEXT, "syscall");
+}
+
+static void hRt_print(int fd, const char *s) {
+  __write(fd, s, strlen(s));
+}
+
+static void hRt_violation(const char *call) {
+  if (rtDepth == 0 || rtInHook) return;
+  rtInHook = 1;
+  __atomic_fetch_add(&rtNumViolations, 1, __ATOMIC_RELAXED);
+
+  void *frames[HV_RT_AUDIT_MAX_FRAMES];
+  const int numFrames = backtrace(frames, HV_RT_AUDIT_MAX_FRAMES);
+  if (rtAbortOnViolation) {
+    char s[128];
+    hv_snprintf(s, sizeof(s), "heavy: %s called in realtime code from:\n", call);
+    hRt_print(STDERR_FILENO, s);
+    backtrace_symbols_fd(frames+2, numFrames-2, STDERR_FILENO); // skip the hooks
+    abort();
+  }
+
+  hv_uint32_t hash = 0;
+  for (int i = 0; i < numFrames; ++i) hash = hash*31 + (hv_uint32_t) (hv_size_t) frames[i];
+
+  // count the trace if it was seen before, otherwise keep it. Concurrent callers may keep a
+  // trace twice, which only shows up as two entries in the report.
+  const hv_uint32_t n = hv_min_ui(__atomic_load_n(&rtNumTraces, __ATOMIC_ACQUIRE), HV_RT_AUDIT_MAX_TRACES);
+  for (hv_uint32_t i = 0; i < n; ++i) {
+    RtTrace *const t = rtTraces+i;
+    if (__atomic_load_n(&t->hash, __ATOMIC_ACQUIRE) == hash && t->call == call) {
+      __atomic_fetch_add(&t->count, 1, __ATOMIC_RELAXED);
+      rtInHook = 0;
+      return;
+    }
+  }
+  const hv_uint32_t i = __atomic_fetch_add(&rtNumTraces, 1, __ATOMIC_ACQ_REL);
+  if (i < HV_RT_AUDIT_MAX_TRACES) {
+    RtTrace *const t = rtTraces+i;
+    t->call = call;
+    t->count = 1;
+    t->numFrames = numFrames;
+    hv_memcpy(t->frames, frames, numFrames*sizeof(void *));
+    __atomic_store_n(&t->hash, hash, __ATOMIC_RELEASE);
+  }
+  rtInHook = 0;
+}
+
+void hRt_enter(void) {
+  ++rtDepth;
+}
+
+void hRt_leave(void) {
+  hv_assert(rtDepth > 0);
+  --rtDepth;
+}
+
+hv_uint32_t hRt_getNumViolations(void) {
+  return __atomic_load_n(&rtNumViolations, __ATOMIC_RELAXED);
+}
+
+hv_uint32_t hRt_report(int fd) {
+  const hv_uint32_t numViolations = hRt_getNumViolations();
+  const hv_uint32_t numSites = __atomic_load_n(&rtNumTraces, __ATOMIC_ACQUIRE);
+  const hv_uint32_t numTraces = hv_min_ui(numSites, HV_RT_AUDIT_MAX_TRACES);
+  char s[128];
+  hv_snprintf(s, sizeof(s), "heavy: %u blocking calls in realtime code, from %u call sites\n",
+      numViolations, numSites);
+  hRt_print(fd, s);
+  if (numSites > numTraces) {
+    hv_snprintf(s, sizeof(s), "heavy: only the first %u call sites were kept\n", numTraces);
+    hRt_print(fd, s);
+  }
+  ++rtInHook; // reporting from realtime code must not record itself
+  for (hv_uint32_t i = 0; i < numTraces; ++i) {
+    const RtTrace *const t = rtTraces+i;
+    hv_snprintf(s, sizeof(s), "\nheavy: %s called %u times from:\n", t->call, t->count);
+    hRt_print(fd, s);
+    backtrace_symbols_fd((void *const *) t->frames+2, t->numFrames-2, fd); // skip the hooks
+  }
+  --rtInHook;
+  return numViolations;
+}
+
+static void hRt_reportAtExit(void) {
+  if (hRt_getNumViolations() > 0) hRt_report(STDERR_FILENO);
+}
+
+__attribute__((constructor)) static void hRt_init(void) {
+  // backtrace() loads the unwinder on its first call, which allocates
+  void *frames[1];
+  backtrace(frames, 1);
+  if (rtSyscall == NULL) hRt_resolve();
+  rtAbortOnViolation = (getenv("HV_RT_AUDIT_ABORT") != NULL);
+  atexit(&hRt_reportAtExit);
+}
+
+/*
+ * Interposed functions
+ */
+
+void *malloc(size_t n) {
+  hRt_violation("malloc");
+  return __libc_malloc(n);
+}
+
+void *calloc(size_t m, size_t n) {
+  hRt_violation("calloc");
+  return __libc_calloc(m, n);
+}
+
+void *realloc(void *p, size_t n) {
+  hRt_violation("realloc");
+  return __libc_realloc(p, n);
+}
+
+void free(void *p) {
+  if (p != NULL) hRt_violation("free");
+  __libc_free(p);
+}
+
+void *aligned_alloc(size_t alignment, size_t n) {
+  hRt_violation("aligned_alloc");
+  return __libc_memalign(alignment, n);
+}
+
+int posix_memalign(void **p, size_t alignment, size_t n) {
+  hRt_violation("posix_memalign");
+  if (alignment < sizeof(void *) || (alignment & (alignment-1))) return EINVAL;
+  *p = __libc_memalign(alignment, n);
+  return (*p != NULL) ? 0 : ENOMEM;
+}
+
+int pthread_mutex_lock(pthread_mutex_t *m) {
+  hRt_violation("pthread_mutex_lock");
+  if (rtMutexLock == NULL) hRt_resolve();
+  return rtMutexLock(m);
+}
+
+int pthread_mutex_timedlock(pthread_mutex_t *m, const struct timespec *t) {
+  hRt_violation("pthread_mutex_timedlock");
+  if (rtMutexTimedLock == NULL) hRt_resolve();
+  return rtMutexTimedLock(m, t);
+}
+
+int pthread_rwlock_rdlock(pthread_rwlock_t *l) {
+  hRt_violation("pthread_rwlock_rdlock");
+  if (rtRwlockRdLock == NULL) hRt_resolve();
+  return rtRwlockRdLock(l);
+}
+
+int pthread_rwlock_wrlock(pthread_rwlock_t *l) {
+  hRt_violation("pthread_rwlock_wrlock");
+  if (rtRwlockWrLock == NULL) hRt_resolve();
+  return rtRwlockWrLock(l);
+}
+
+int pthread_rwlock_timedrdlock(pthread_rwlock_t *l, const struct timespec *t) {
+  hRt_violation("pthread_rwlock_timedrdlock");
+  if (rtRwlockTimedRdLock == NULL) hRt_resolve();
+  return rtRwlockTimedRdLock(l, t);
+}
+
+int pthread_rwlock_timedwrlock(pthread_rwlock_t *l, const struct timespec *t) {
+  hRt_violation("pthread_rwlock_timedwrlock");
+  if (rtRwlockTimedWrLock == NULL) hRt_resolve();
+  return rtRwlockTimedWrLock(l, t);
+}
+
+int pthread_cond_wait(pthread_cond_t *c, pthread_mutex_t *m) {
+  hRt_violation("pthread_cond_wait");
+  if (rtCondWait == NULL) hRt_resolve();
+  return rtCondWait(c, m);
+}
+
+int pthread_cond_timedwait(pthread_cond_t *c, pthread_mutex_t *m, const struct timespec *t) {
+  hRt_violation("pthread_cond_timedwait");
+  if (rtCondTimedWait == NULL) hRt_resolve();
+  return rtCondTimedWait(c, m, t);
+}
+
+ssize_t write(int fd, const void *buffer, size_t n) {
+  hRt_violation("write");
+  return __write(fd, buffer, n);
+}
+
+ssize_t read(int fd, void *buffer, size_t n) {
+  hRt_violation("read");
+  return __read(fd, buffer, n);
+}
+
+int nanosleep(const struct timespec *t, struct timespec *remaining) {
+  hRt_violation("nanosleep");
+  return __nanosleep(t, remaining);
+}
+
+int clock_nanosleep(clockid_t clock, int flags, const struct timespec *t, struct timespec *remaining) {
+  hRt_violation("clock_nanosleep");
+  if (rtClockNanosleep == NULL) hRt_resolve();
+  return rtClockNanosleep(clock, flags, t, remaining);
+}
+
+long syscall(long number, ...) {
+  // every system call takes at most six arguments, reading unused ones is harmless
+  long a[6];
+  va_list args;
+  va_start(args, number);
+  for (int i = 0; i < 6; ++i) a[i] = va_arg(args, long);
+  va_end(args);
+#if defined(SYS_futex) && defined(FUTEX_CMD_MASK)
+  if (number == SYS_futex) {
+    // waking a waiter does not block, waiting and the lock operations do
+    const int op = (int) a[1] & FUTEX_CMD_MASK;
+    if (op != FUTEX_WAKE && op != FUTEX_WAKE_BITSET && op != FUTEX_WAKE_OP) hRt_violation("futex");
+  } else
+#endif
+  hRt_violation("syscall");
+  if (rtSyscall == NULL) hRt_resolve();
+  return rtSyscall(number, a[0], a[1], a[2], a[3], a[4], a[5]);
+}
+
+#else // !__GLIBC__
+
+void hRt_enter(void) {}
+
+void hRt_leave(void) {}
+
+hv_uint32_t hRt_getNumViolations(void) {
+  return 0;
+}
+
+hv_uint32_t hRt_report(int fd) {
+  return 0;
+}
+
+#endif // __GLIBC__
+
+#endif // HV_RT_AUDIT
@@ -0,0 +1,84 @@
+/**
+ * Copyright (c) 2014-2018 Enzien Audio Ltd.
+ *
+ * Permission to use, copy, modify, and/or distribute this software for any
+ * purpose with or without fee is hereby granted, provided that the above
+ * copyright notice and this permission notice appear in all copies.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL WARRANTIES WITH
+ * REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED WARRANTIES OF MERCHANTABILITY
+ * AND FITNESS. IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR ANY SPECIAL, DIRECT,
+ * INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES WHATSOEVER RESULTING FROM
+ * LOSS OF USE, DATA OR PROFITS, WHETHER IN AN ACTION OF CONTRACT, NEGLIGENCE OR
+ * OTHER TORTIOUS ACTION, ARISING OUT OF OR IN CONNECTION WITH THE USE OR
+ * PERFORMANCE OF THIS SOFTWARE.
+ */
+
+#ifndef _HEAVY_RT_AUDIT_H_
+#define _HEAVY_RT_AUDIT_H_
+
+#include "HvUtils.h"
+
+/**
+ * A test mode that reports every call on the audio thread that may block it.
+ *
+ * Build all sources with HV_RT_AUDIT=1 and link the result into an executable, such as the JACK
+ * standalone (make HV_RT_AUDIT=true) or the benchmark (make audit). The runtime then defines
+ *   - malloc, calloc, realloc, free, aligned_alloc and posix_memalign,
+ *   - pthread_mutex_lock, pthread_mutex_timedlock and the pthread_rwlock_ lock functions,
+ *   - pthread_cond_wait and pthread_cond_timedwait,
+ *   - read, write, nanosleep and clock_nanosleep,
+ *   - syscall, of which only the futex wake operations are allowed,
+ * which forward to the C library and record a stack trace whenever they are called between
+ * HV_RT_AUDIT_ENTER() and HV_RT_AUDIT_LEAVE() on the same thread. Joining a thread waits on a
+ * futex inside the C library, which is not seen, and printing ends in write(). Interposition
+ * needs glibc, elsewhere nothing is recorded.
+ *
+ * Set the environment variable HV_RT_AUDIT_ABORT to abort at the first violation, e.g. to break
+ * in a debugger. Otherwise all violations are reported on stderr at exit, see hRt_report().
+ */
+
+#ifndef HV_RT_AUDIT
+#define HV_RT_AUDIT 0
+#endif
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#if HV_RT_AUDIT
+
+#define HV_RT_AUDIT_ENTER() hRt_enter()
+#define HV_RT_AUDIT_LEAVE() hRt_leave()
+
+// number of distinct stack traces kept, and frames per trace
+#define HV_RT_AUDIT_MAX_TRACES 256
+#define HV_RT_AUDIT_MAX_FRAMES 24
+
+/** Marks the start of realtime code on this thread. Regions may nest. */
+void hRt_enter(void);
+
+/** Marks the end of realtime code on this thread. */
+void hRt_leave(void);
+
+/** Returns the number of blocking calls made in realtime code so far. */
+hv_uint32_t hRt_getNumViolations(void);
+
+/**
+ * Writes each distinct stack trace of a blocking call to the file descriptor, with the call
+ * and the number of times it was made, and returns the number of violations.
+ */
+hv_uint32_t hRt_report(int fd);
+
+#else // !HV_RT_AUDIT
+
+#define HV_RT_AUDIT_ENTER()
+#define HV_RT_AUDIT_LEAVE()
+
+#endif // HV_RT_AUDIT
+
+#ifdef __cplusplus
+} // extern "C"
+#endif
+
+#endif // _HEAVY_RT_AUDIT_H_
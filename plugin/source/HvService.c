@@ -0,0 +1,213 @@
+/**
+ * Copyright (c) 2014-2018 Enzien Audio Ltd.
+ *
+ * Permission to use, copy, modify, and/or distribute this software for any
+ * purpose with or without fee is hereby granted, provided that the above
+ * copyright notice and this permission notice appear in all copies.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL WARRANTIES WITH
+ * REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED WARRANTIES OF MERCHANTABILITY
+ * AND FITNESS. IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR ANY SPECIAL, DIRECT,
+ * INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES WHATSOEVER RESULTING FROM
+ * LOSS OF USE, DATA OR PROFITS, WHETHER IN AN ACTION OF CONTRACT, NEGLIGENCE OR
+ * OTHER TORTIOUS ACTION, ARISING OUT OF OR IN CONNECTION WITH THE USE OR
+ * PERFORMANCE OF THIS SOFTWARE.
+ */
+
+#if defined(__linux__) && !defined(_GNU_SOURCE)
+#define _GNU_SOURCE // pthread_setaffinity_np()
+#endif
+
+#include "HvService.h"
+
+#if HV_SERVICE
+
+#if !defined(__linux__)
+#error "HV_SERVICE is only supported on Linux"
+#endif
+
+#include <errno.h>
+#include <sched.h>
+#include <string.h>
+#include <sys/mman.h>
+#include <time.h>
+
+static hv_uint64_t hSv_getClockNs(void) {
+  struct timespec t;
+  clock_gettime(CLOCK_MONOTONIC, &t);
+  return (hv_uint64_t) t.tv_sec*1000000000 + (hv_uint64_t) t.tv_nsec;
+}
+
+hv_uint64_t hSv_now(const HvService *o) {
+  return hSv_getClockNs() - o->startNs;
+}
+
+// parses a list of cores such as "0,2-3", returns false if it is malformed
+static bool hSv_parseCpus(const char *s, cpu_set_t *set) {
+  CPU_ZERO(set);
+  while (*s != '\0') {
+    char *end = NULL;
+    const long first = strtol(s, &end, 10);
+    long last = first;
+    if (end == s || first < 0) return false;
+    if (*end == '-') {
+      s = end+1;
+      last = strtol(s, &end, 10);
+      if (end == s || last < first) return false;
+    }
+    if (last >= CPU_SETSIZE) return false;
+    for (long i = first; i <= last; ++i) CPU_SET((int) i, set);
+    s = (*end == ',') ? end+1 : end;
+    if (*end != ',' && *end != '\0') return false;
+  }
+  return CPU_COUNT(set) > 0;
+}
+
+static void hSv_checkProcessThread(HvService *o) {
+  int policy = 0;
+  struct sched_param param;
+  if (o->priority > 0 && pthread_getschedparam(o->processThread, &policy, &param) == 0) {
+    if (policy != SCHED_FIFO || param.sched_priority < o->priority) {
+      fprintf(stderr, "heavy: the process thread runs %s at priority %d, expected SCHED_FIFO at %d or above. "
+          "Check the realtime options of the JACK server and the rtprio limit of the user.\n",
+          (policy == SCHED_FIFO) ? "SCHED_FIFO" : (policy == SCHED_RR) ? "SCHED_RR" : "SCHED_OTHER",
+          param.sched_priority, o->priority);
+    }
+  }
+
+  if (o->cpus[0] != '\0') {
+    cpu_set_t set;
+    if (!hSv_parseCpus(o->cpus, &set)) {
+      fprintf(stderr, "heavy: HV_SERVICE_CPUS=%s is not a list of cores such as 2,3 or 2-3.\n", o->cpus);
+    } else {
+      const int err = pthread_setaffinity_np(o->processThread, sizeof(set), &set);
+      if (err != 0) {
+        fprintf(stderr, "heavy: could not pin the process thread to cores %s: %s\n", o->cpus, strerror(err));
+      }
+    }
+  }
+}
+
+// drains the ring into the log
+static void hSv_drain(HvService *o) {
+  // all timings up to the write index are complete, see hSv_leave()
+  const hv_uint32_t w = o->writeIndex;
+  for (hv_uint32_t r = o->readIndex; r != w; ++r) {
+    const HvServiceTiming *const t = o->timings + (r & (HV_SERVICE_CAPACITY-1));
+    if (o->log != NULL) {
+      fprintf(o->log, "%llu,%u,%u,%u\n", (unsigned long long) t->start, t->duration, t->frames, t->xrun);
+    }
+  }
+  o->readIndex = w;
+  if (o->log != NULL) fflush(o->log);
+
+  const hv_uint32_t numXruns = o->numXruns;
+  if (numXruns != o->numReportedXruns) {
+    fprintf(stderr, "heavy: %u xruns (%u new)\n", numXruns, numXruns-o->numReportedXruns);
+    o->numReportedXruns = numXruns;
+  }
+}
+
+static void hSv_openCapture(HvService *o, double sampleRate, int numChannels) {
+  const char *const prefix = getenv("HV_SERVICE_CAPTURE");
+  if (prefix == NULL || prefix[0] == '\0') return;
+  const char *const seconds = getenv("HV_SERVICE_CAPTURE_SECONDS");
+  const char *const mb = getenv("HV_SERVICE_CAPTURE_MB");
+  const char *const direct = getenv("HV_SERVICE_CAPTURE_DIRECT");
+  if (!hCp_open(&o->capture, prefix, numChannels, sampleRate,
+      (seconds != NULL) ? atof(seconds) : 0.0,
+      (mb != NULL) ? (hv_uint64_t) (atof(mb)*1024.0*1024.0) : 0,
+      (direct != NULL) && (atoi(direct) != 0))) {
+    fprintf(stderr, "heavy: could not start the capture to %s\n", prefix);
+  }
+}
+
+static void *hSv_run(void *x) {
+  HvService *const o = (HvService *) x;
+  const struct timespec period = { 0, HV_SERVICE_MONITOR_MS*1000000L };
+  while (o->running) {
+    nanosleep(&period, NULL);
+    if (o->hasProcessThread && !o->processThreadChecked) {
+      hSv_checkProcessThread(o);
+      o->processThreadChecked = true;
+    }
+    hSv_drain(o);
+  }
+  return NULL;
+}
+
+hv_size_t hSv_init(HvService *o, double sampleRate, int numChannels) {
+  o->timings = (HvServiceTiming *) hv_malloc(HV_SERVICE_CAPACITY*sizeof(HvServiceTiming));
+  hv_assert(o->timings != NULL);
+  hv_memclear(o->timings, HV_SERVICE_CAPACITY*sizeof(HvServiceTiming)); // maps the ring
+  o->writeIndex = 0;
+  o->readIndex = 0;
+  o->numDropped = 0;
+  o->sampleRate = sampleRate;
+  o->lastStart = 0;
+  o->lastFrames = 0;
+  o->numXruns = 0;
+  o->maxDuration = 0;
+  o->numCallbacks = 0;
+  o->hasProcessThread = false;
+  o->processThreadChecked = false;
+  o->numReportedXruns = 0;
+  o->startNs = hSv_getClockNs();
+
+  const char *const priority = getenv("HV_SERVICE_PRIORITY");
+  o->priority = (priority != NULL) ? atoi(priority) : 0;
+  const char *const cpus = getenv("HV_SERVICE_CPUS");
+  hv_snprintf(o->cpus, sizeof(o->cpus), "%s", (cpus != NULL) ? cpus : "");
+
+  const char *const log = getenv("HV_SERVICE_LOG");
+  o->log = NULL;
+  if (log != NULL && strcmp(log, "-") == 0) {
+    o->log = stderr;
+  } else if (log != NULL && log[0] != '\0') {
+    o->log = fopen(log, "a");
+    if (o->log == NULL) fprintf(stderr, "heavy: could not open HV_SERVICE_LOG=%s: %s\n", log, strerror(errno));
+  }
+  if (o->log != NULL) fprintf(o->log, "start_ns,duration_ns,frames,xrun\n");
+
+  hCp_init(&o->capture);
+  hSv_openCapture(o, sampleRate, numChannels);
+
+  // the lock covers everything allocated so far and all later mappings, such as thread stacks
+  const char *const mlock = getenv("HV_SERVICE_MLOCK");
+  if (mlock != NULL && atoi(mlock) != 0 && mlockall(MCL_CURRENT | MCL_FUTURE) != 0) {
+    fprintf(stderr, "heavy: could not lock memory: %s. Check the memlock limit of the user.\n", strerror(errno));
+  }
+
+  o->running = true;
+  if (pthread_create(&o->monitor, NULL, &hSv_run, o) != 0) {
+    o->running = false;
+    fprintf(stderr, "heavy: could not start the service monitor thread.\n");
+  }
+  return HV_SERVICE_CAPACITY*sizeof(HvServiceTiming);
+}
+
+void hSv_activate(HvService *o, double sampleRate) {
+  // each capture file holds a single sample rate
+  if (hCp_isOpen(&o->capture) && sampleRate != o->capture.sampleRate) {
+    const int numChannels = o->capture.numChannels;
+    hCp_close(&o->capture);
+    hSv_openCapture(o, sampleRate, numChannels);
+  }
+  o->sampleRate = sampleRate;
+  o->lastStart = 0;
+}
+
+void hSv_free(HvService *o) {
+  if (o->running) {
+    o->running = false;
+    pthread_join(o->monitor, NULL);
+  }
+  hSv_drain(o);
+  hCp_close(&o->capture);
+  fprintf(stderr, "heavy: %llu callbacks, %u xruns, longest %.3f ms, %u timings dropped\n",
+      (unsigned long long) o->numCallbacks, o->numXruns, o->maxDuration*1.0e-6, o->numDropped);
+  if (o->log != NULL && o->log != stderr) fclose(o->log);
+  hv_free(o->timings);
+}
+
+#endif // HV_SERVICE
@@ -0,0 +1,168 @@
+/**
+ * Copyright (c) 2014-2018 Enzien Audio Ltd.
+ *
+ * Permission to use, copy, modify, and/or distribute this software for any
+ * purpose with or without fee is hereby granted, provided that the above
+ * copyright notice and this permission notice appear in all copies.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL WARRANTIES WITH
+ * REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED WARRANTIES OF MERCHANTABILITY
+ * AND FITNESS. IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR ANY SPECIAL, DIRECT,
+ * INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES WHATSOEVER RESULTING FROM
+ * LOSS OF USE, DATA OR PROFITS, WHETHER IN AN ACTION OF CONTRACT, NEGLIGENCE OR
+ * OTHER TORTIOUS ACTION, ARISING OUT OF OR IN CONNECTION WITH THE USE OR
+ * PERFORMANCE OF THIS SOFTWARE.
+ */
+
+#ifndef _HEAVY_SERVICE_H_
+#define _HEAVY_SERVICE_H_
+
+#include "HvCapture.h"
+
+/**
+ * Runtime setup of the JACK standalone running headless as a low-latency service, enabled by
+ * building with HV_SERVICE=1 (make HV_SERVICE=true builds the standalone only). Linux only.
+ *
+ * The command line of the standalone belongs to DPF, so the options are read from the
+ * environment when the plugin is created:
+ *   HV_SERVICE_MLOCK=1       lock all current and future pages of the process into memory
+ *   HV_SERVICE_PRIORITY=n    warn unless the process thread runs SCHED_FIFO at priority n or above
+ *   HV_SERVICE_CPUS=list     pin the process thread to the given cores, e.g. "2,3" or "2-3"
+ *   HV_SERVICE_LOG=path      append the timing of every callback to path as CSV, "-" for stderr
+ *   HV_SERVICE_CAPTURE=prefix          record the output to WAV files, see HvCapture.h
+ *   HV_SERVICE_CAPTURE_SECONDS=n       start a new capture file every n seconds
+ *   HV_SERVICE_CAPTURE_MB=n            start a new capture file every n MB
+ *   HV_SERVICE_CAPTURE_DIRECT=1        write capture files with O_DIRECT, bypassing the page cache
+ *
+ * The process thread only reads the clock and writes into a fixed ring. A monitor thread checks
+ * the scheduling of the process thread and pins it once it has seen it, drains the ring into the
+ * log and reports xruns on stderr. An xrun is a callback that started more than half a period
+ * late or took longer than its period. Timings are dropped while the ring is full.
+ */
+
+#ifndef HV_SERVICE
+#define HV_SERVICE 0
+#endif
+
+#if HV_SERVICE
+
+#include <pthread.h>
+
+// number of callback timings held by the ring, a power of two
+#ifndef HV_SERVICE_CAPACITY
+#define HV_SERVICE_CAPACITY 4096
+#endif
+
+// period of the monitor thread in milliseconds
+#define HV_SERVICE_MONITOR_MS 100
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+typedef struct HvServiceTiming {
+  hv_uint64_t start; // ns since the service was initialised
+  hv_uint32_t duration; // ns
+  hv_uint32_t frames;
+  hv_uint32_t xrun; // 1 if the callback started late, 2 if it overran, 3 if both
+} HvServiceTiming;
+
+/*
+ * The ring assumes a single producer thread and a single consumer thread, see HvLightPipe.
+ */
+typedef struct HvService {
+  HvServiceTiming *timings;
+  volatile hv_uint32_t writeIndex; // only advanced by the process thread
+  volatile hv_uint32_t readIndex; // only advanced by the monitor thread
+  hv_uint32_t numDropped; // timings not recorded because the ring was full
+
+  // process thread state
+  double sampleRate;
+  hv_uint64_t lastStart; // of the previous callback, 0 after activation
+  hv_uint32_t lastFrames;
+  volatile hv_uint32_t numXruns;
+  volatile hv_uint32_t maxDuration; // ns
+  hv_uint64_t numCallbacks;
+  pthread_t processThread;
+  volatile bool hasProcessThread;
+
+  // monitor thread state
+  pthread_t monitor;
+  volatile bool running;
+  bool processThreadChecked;
+  hv_uint32_t numReportedXruns;
+  int priority; // HV_SERVICE_PRIORITY, 0 if unset
+  char cpus[64]; // HV_SERVICE_CPUS, empty if unset
+  FILE *log; // HV_SERVICE_LOG, NULL if unset
+  hv_uint64_t startNs;
+
+  HvCapture capture; // HV_SERVICE_CAPTURE, closed if unset
+} HvService;
+
+/**
+ * Reads the options, starts the capture of numChannels output channels if asked to, locks memory
+ * if asked to and starts the monitor thread.
+ */
+hv_size_t hSv_init(HvService *o, double sampleRate, int numChannels);
+
+/** Stops the monitor thread, flushes the log and prints a summary on stderr. */
+void hSv_free(HvService *o);
+
+/** Returns the current time in ns since the service was initialised. */
+hv_uint64_t hSv_now(const HvService *o);
+
+/**
+ * Forgets the previous callback, such that the gap across a deactivation is not an xrun.
+ * Starts new capture files if the sample rate has changed.
+ */
+void hSv_activate(HvService *o, double sampleRate);
+
+/** Called by the process thread at the start of a callback, returns its start time. */
+static inline hv_uint64_t hSv_enter(HvService *o) {
+  if (!o->hasProcessThread) {
+    o->processThread = pthread_self();
+    hv_sfence(); // the thread must be set before the monitor can see it
+    o->hasProcessThread = true;
+  }
+  return hSv_now(o);
+}
+
+/** Called by the process thread with the output of the callback, NULL if it was silent. */
+static inline void hSv_capture(HvService *o, const float *const *channels, hv_uint32_t n) {
+  if (hCp_isOpen(&o->capture)) hCp_write(&o->capture, channels, n);
+}
+
+/** Called by the process thread at the end of a callback of the given number of frames. */
+static inline void hSv_leave(HvService *o, hv_uint64_t start, hv_uint32_t frames) {
+  const hv_uint64_t end = hSv_now(o);
+  const hv_uint32_t duration = (hv_uint32_t) (end-start);
+  hv_uint32_t xrun = 0;
+  if (o->lastStart > 0 && (double) (start-o->lastStart) > 1.5e9*o->lastFrames/o->sampleRate) xrun |= 1;
+  if ((double) duration > 1.0e9*frames/o->sampleRate) xrun |= 2;
+  if (xrun) o->numXruns = o->numXruns+1;
+  if (duration > o->maxDuration) o->maxDuration = duration;
+  o->lastStart = start;
+  o->lastFrames = frames;
+  ++o->numCallbacks;
+
+  const hv_uint32_t w = o->writeIndex;
+  if (w - o->readIndex < HV_SERVICE_CAPACITY) {
+    HvServiceTiming *const t = o->timings + (w & (HV_SERVICE_CAPACITY-1));
+    t->start = start;
+    t->duration = duration;
+    t->frames = frames;
+    t->xrun = xrun;
+    hv_sfence(); // the timing must be complete before the monitor can see it
+    o->writeIndex = w+1;
+  } else {
+    ++o->numDropped;
+  }
+}
+
+#ifdef __cplusplus
+} // extern "C"
+#endif
+
+#endif // HV_SERVICE
+
+#endif // _HEAVY_SERVICE_H_
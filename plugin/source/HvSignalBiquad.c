@@ -19,6 +19,54 @@
 // http://reanimator-web.appspot.com/articles/simdiir
 // http://musicdsp.org/files/Audio-EQ-Cookbook.txt
 
+#if HV_SIMD_AVX || HV_SIMD_SSE
+// The feedback of y[n] = e[n] - a1*y[n-1] - a2*y[n-2] is solved for a whole block as
+// y = M*e + coeff_ym1*y[-1] + coeff_ym2*y[-2], where column j of the lower triangular
+// matrix M is the impulse response of the feedback path delayed by j samples.
+static void sBiquad_updateCoefficients(SignalBiquad *const o, float y1, float y2) {
+  // calculate all filter coefficients in the double domain
+  double a1 = (double) -y1;
+  double a2 = (double) -y2;
+
+  double h[HV_N_SIMD]; // impulse response
+  double p[HV_N_SIMD]; // response to y[-1]
+  double q[HV_N_SIMD]; // response to y[-2]
+  h[0] = 1.0; h[1] = a1;
+  p[0] = a1;  p[1] = a1*a1 + a2;
+  q[0] = a2;  q[1] = a1*a2;
+  for (int i = 2; i < HV_N_SIMD; i++) {
+    h[i] = a1*h[i-1] + a2*h[i-2];
+    p[i] = a1*p[i-1] + a2*p[i-2];
+    q[i] = a1*q[i-1] + a2*q[i-2];
+  }
+
+  float c[HV_N_SIMD];
+  for (int j = 0; j < HV_N_SIMD; j++) {
+    for (int i = 0; i < HV_N_SIMD; i++) c[i] = (i < j) ? 0.0f : (float) h[i-j];
+#if HV_SIMD_AVX
+    o->coeff_e[j] = _mm256_loadu_ps(c);
+#else // HV_SIMD_SSE
+    o->coeff_e[j] = _mm_loadu_ps(c);
+#endif
+  }
+  for (int i = 0; i < HV_N_SIMD; i++) c[i] = (float) p[i];
+#if HV_SIMD_AVX
+  o->coeff_ym1 = _mm256_loadu_ps(c);
+#else // HV_SIMD_SSE
+  o->coeff_ym1 = _mm_loadu_ps(c);
+#endif
+  for (int i = 0; i < HV_N_SIMD; i++) c[i] = (float) q[i];
+#if HV_SIMD_AVX
+  o->coeff_ym2 = _mm256_loadu_ps(c);
+#else // HV_SIMD_SSE
+  o->coeff_ym2 = _mm_loadu_ps(c);
+#endif
+
+  o->a1 = y1;
+  o->a2 = y2;
+}
+#endif
+
 hv_size_t sBiquad_init(SignalBiquad *o) {
 #if HV_SIMD_AVX
   o->x = _mm256_setzero_ps();
@@ -32,6 +80,9 @@ hv_size_t sBiquad_init(SignalBiquad *o) {
 #endif
   o->ym1 = 0.0f;
   o->ym2 = 0.0f;
+#if HV_SIMD_AVX || HV_SIMD_SSE
+  sBiquad_updateCoefficients(o, 0.0f, 0.0f);
+#endif
   return 0;
 }
 
@@ -63,20 +114,52 @@ void __hv_biquad_f(SignalBiquad *o, hv_bInf_t bIn, hv_bInf_t bX0, hv_bInf_t bX1,
   __m256 d = _mm256_add_ps(a, b);
   __m256 e = _mm256_add_ps(c, d); // bIn*bX0 + o->x1*bX1 + o->x2*bX2
 
-  float y0 = e[0] - o->ym1*bY1[0] - o->ym2*bY2[0];
-  float y1 = e[1] - y0*bY1[1] - o->ym1*bY2[1];
-  float y2 = e[2] - y1*bY1[2] - y0*bY2[2];
-  float y3 = e[3] - y2*bY1[3] - y1*bY2[3];
-  float y4 = e[4] - y3*bY1[4] - y2*bY2[4];
-  float y5 = e[5] - y4*bY1[5] - y3*bY2[5];
-  float y6 = e[6] - y5*bY1[6] - y4*bY2[6];
-  float y7 = e[7] - y6*bY1[7] - y5*bY2[7];
+  float a1, a2;
+  if (__hv_uniform_f(bY1, &a1) && __hv_uniform_f(bY2, &a2)) {
+    if (a1 != o->a1 || a2 != o->a2) sBiquad_updateCoefficients(o, a1, a2);
 
-  o->x = bIn;
-  o->ym1 = y7;
-  o->ym2 = y6;
+    // the whole block at once, y = M*e + coeff_ym1*ym1 + coeff_ym2*ym2
+    __m256 lo = _mm256_permute2f128_ps(e, e, 0x00); // [0 1 2 3 0 1 2 3]
+    __m256 hi = _mm256_permute2f128_ps(e, e, 0x11); // [4 5 6 7 4 5 6 7]
+    __m256 f = _mm256_add_ps(
+        _mm256_mul_ps(_mm256_permute_ps(lo, _MM_SHUFFLE(0,0,0,0)), o->coeff_e[0]),
+        _mm256_mul_ps(_mm256_permute_ps(lo, _MM_SHUFFLE(1,1,1,1)), o->coeff_e[1]));
+    __m256 g = _mm256_add_ps(
+        _mm256_mul_ps(_mm256_permute_ps(lo, _MM_SHUFFLE(2,2,2,2)), o->coeff_e[2]),
+        _mm256_mul_ps(_mm256_permute_ps(lo, _MM_SHUFFLE(3,3,3,3)), o->coeff_e[3]));
+    __m256 h = _mm256_add_ps(
+        _mm256_mul_ps(_mm256_permute_ps(hi, _MM_SHUFFLE(0,0,0,0)), o->coeff_e[4]),
+        _mm256_mul_ps(_mm256_permute_ps(hi, _MM_SHUFFLE(1,1,1,1)), o->coeff_e[5]));
+    __m256 i = _mm256_add_ps(
+        _mm256_mul_ps(_mm256_permute_ps(hi, _MM_SHUFFLE(2,2,2,2)), o->coeff_e[6]),
+        _mm256_mul_ps(_mm256_permute_ps(hi, _MM_SHUFFLE(3,3,3,3)), o->coeff_e[7]));
+    __m256 j = _mm256_add_ps(
+        _mm256_mul_ps(_mm256_set1_ps(o->ym1), o->coeff_ym1),
+        _mm256_mul_ps(_mm256_set1_ps(o->ym2), o->coeff_ym2));
+    __m256 y = _mm256_add_ps(_mm256_add_ps(_mm256_add_ps(f, g), _mm256_add_ps(h, i)), j);
+
+    o->ym1 = y[7];
+    o->ym2 = y[6];
+
+    *bOut = y;
+  } else {
+    // the feedback coefficients vary over the block, run the recursion sample by sample
+    float y0 = e[0] - o->ym1*bY1[0] - o->ym2*bY2[0];
+    float y1 = e[1] - y0*bY1[1] - o->ym1*bY2[1];
+    float y2 = e[2] - y1*bY1[2] - y0*bY2[2];
+    float y3 = e[3] - y2*bY1[3] - y1*bY2[3];
+    float y4 = e[4] - y3*bY1[4] - y2*bY2[4];
+    float y5 = e[5] - y4*bY1[5] - y3*bY2[5];
+    float y6 = e[6] - y5*bY1[6] - y4*bY2[6];
+    float y7 = e[7] - y6*bY1[7] - y5*bY2[7];
+
+    o->ym1 = y7;
+    o->ym2 = y6;
 
-  *bOut = _mm256_set_ps(y7, y6, y5, y4, y3, y2, y1, y0);
+    *bOut = _mm256_set_ps(y7, y6, y5, y4, y3, y2, y1, y0);
+  }
+
+  o->x = bIn;
 #elif HV_SIMD_SSE
   __m128 n = _mm_blend_ps(o->x, bIn, 0x7); // [a b c d] [e f g h] = [e f g d]
   __m128 xm1 = _mm_shuffle_ps(n, n, _MM_SHUFFLE(2,1,0,3)); // [d e f g]
@@ -88,20 +171,44 @@ void __hv_biquad_f(SignalBiquad *o, hv_bInf_t bIn, hv_bInf_t bX0, hv_bInf_t bX1,
   __m128 d = _mm_add_ps(a, b);
   __m128 e = _mm_add_ps(c, d);
 
-  const float *const bbe = (float *) &e;
-  const float *const bbY1 = (float *) &bY1;
-  const float *const bbY2 = (float *) &bY2;
+  float a1, a2;
+  if (__hv_uniform_f(bY1, &a1) && __hv_uniform_f(bY2, &a2)) {
+    if (a1 != o->a1 || a2 != o->a2) sBiquad_updateCoefficients(o, a1, a2);
 
-  float y0 = bbe[0] - o->ym1*bbY1[0] - o->ym2*bbY2[0];
-  float y1 = bbe[1] - y0*bbY1[1] - o->ym1*bbY2[1];
-  float y2 = bbe[2] - y1*bbY1[2] - y0*bbY2[2];
-  float y3 = bbe[3] - y2*bbY1[3] - y1*bbY2[3];
+    // the whole block at once, y = M*e + coeff_ym1*ym1 + coeff_ym2*ym2
+    __m128 f = _mm_add_ps(
+        _mm_mul_ps(_mm_shuffle_ps(e, e, _MM_SHUFFLE(0,0,0,0)), o->coeff_e[0]),
+        _mm_mul_ps(_mm_shuffle_ps(e, e, _MM_SHUFFLE(1,1,1,1)), o->coeff_e[1]));
+    __m128 g = _mm_add_ps(
+        _mm_mul_ps(_mm_shuffle_ps(e, e, _MM_SHUFFLE(2,2,2,2)), o->coeff_e[2]),
+        _mm_mul_ps(_mm_shuffle_ps(e, e, _MM_SHUFFLE(3,3,3,3)), o->coeff_e[3]));
+    __m128 h = _mm_add_ps(
+        _mm_mul_ps(_mm_set1_ps(o->ym1), o->coeff_ym1),
+        _mm_mul_ps(_mm_set1_ps(o->ym2), o->coeff_ym2));
+    __m128 y = _mm_add_ps(_mm_add_ps(f, g), h);
 
-  o->x = bIn;
-  o->ym1 = y3;
-  o->ym2 = y2;
+    o->ym1 = _mm_cvtss_f32(_mm_shuffle_ps(y, y, _MM_SHUFFLE(3,3,3,3)));
+    o->ym2 = _mm_cvtss_f32(_mm_shuffle_ps(y, y, _MM_SHUFFLE(2,2,2,2)));
+
+    *bOut = y;
+  } else {
+    // the feedback coefficients vary over the block, run the recursion sample by sample
+    const float *const bbe = (float *) &e;
+    const float *const bbY1 = (float *) &bY1;
+    const float *const bbY2 = (float *) &bY2;
 
-  *bOut = _mm_set_ps(y3, y2, y1, y0);
+    float y0 = bbe[0] - o->ym1*bbY1[0] - o->ym2*bbY2[0];
+    float y1 = bbe[1] - y0*bbY1[1] - o->ym1*bbY2[1];
+    float y2 = bbe[2] - y1*bbY1[2] - y0*bbY2[2];
+    float y3 = bbe[3] - y2*bbY1[3] - y1*bbY2[3];
+
+    o->ym1 = y3;
+    o->ym2 = y2;
+
+    *bOut = _mm_set_ps(y3, y2, y1, y0);
+  }
+
+  o->x = bIn;
 #elif HV_SIMD_NEON
   float32x4_t xm1 = vextq_f32(o->x, bIn, 3);
   float32x4_t xm2 = vextq_f32(o->x, bIn, 2);
@@ -33,6 +33,15 @@ typedef struct SignalBiquad {
 #endif
   float ym1;
   float ym2;
+#if HV_SIMD_AVX || HV_SIMD_SSE
+  // response of one block to each feed-forward sample and to the filter state,
+  // valid while the feedback coefficients are uniform and equal to a1 and a2
+  hv_bufferf_t coeff_e[HV_N_SIMD];
+  hv_bufferf_t coeff_ym1;
+  hv_bufferf_t coeff_ym2;
+  float a1;
+  float a2;
+#endif
 } SignalBiquad;
 
 hv_size_t sBiquad_init(SignalBiquad *o);
@@ -16,7 +16,8 @@
 
 #include "HvSignalLine.h"
 
-hv_size_t sLine_init(SignalLine *o) {
+hv_size_t sLine_init(SignalLine *o, double sampleRate) {
+  o->sampleRate = sampleRate;
 #if HV_SIMD_AVX
   o->n = _mm_setzero_si128();
   o->x = _mm256_setzero_ps();
@@ -46,7 +47,7 @@ void sLine_onMessage(HeavyContextInterface *_c, SignalLine *o, int letIn,
   if (msg_isFloat(m,0)) {
     if (msg_isFloat(m,1)) {
       // new ramp
-      int n = (int) hv_millisecondsToSamples(_c, msg_getFloat(m,1));
+      int n = (int) hv_millisecondsToSamples_r(o->sampleRate, msg_getFloat(m,1));
 #if HV_SIMD_AVX
       float x = (o->n[1] > 0) ? (o->x[7] + (o->m[7]/8.0f)) : o->t[7]; // current output value
       float s = (msg_getFloat(m,0) - x) / ((float) n); // slope per sample
@@ -103,7 +104,7 @@ void sLine_onMessage(HeavyContextInterface *_c, SignalLine *o, int letIn,
       o->t = msg_getFloat(m,0);
 #endif
     }
-  } else if (msg_compareSymbol(m,0,"stop")) {
+  } else if (msg_compareHash(m,0,HV_MSG_HASH_STOP)) {
     // Stop line at current position
 #if HV_SIMD_AVX
     // note o->n[1] is a 64-bit integer; two packed 32-bit ints. We only want to know if the high int is positive,
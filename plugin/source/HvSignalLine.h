@@ -32,9 +32,10 @@ typedef struct SignalLine {
   hv_bufferf_t x; // current output
   hv_bufferf_t m; // increment
   hv_bufferf_t t; // target value
+  double sampleRate;
 } SignalLine;
 
-hv_size_t sLine_init(SignalLine *o);
+hv_size_t sLine_init(SignalLine *o, double sampleRate);
 
 static inline void __hv_line_f(SignalLine *o, hv_bOutf_t bOut) {
 #if HV_SIMD_AVX
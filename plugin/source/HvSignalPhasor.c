@@ -43,8 +43,7 @@ static void sPhasor_k_updatePhase(SignalPhasor *o, float p) {
       p+1.0f+o->step.f2sc,      p+1.0f);
 
   // ensure that o->phase is still in range [1,2]
-  o->phase = _mm256_or_ps(_mm256_andnot_ps(
-      _mm256_set1_ps(-INFINITY), o->phase), _mm256_set1_ps(1.0f));
+  o->phase = __hv_phasor_wrap_f(o->phase);
 #elif HV_SIMD_SSE
 static void sPhasor_k_updatePhase(SignalPhasor *o, hv_uint32_t p) {
   o->phase = _mm_set_epi32(3*o->step.s+p, 2*o->step.s+p, o->step.s+p, p);
@@ -57,22 +56,24 @@ static void sPhasor_k_updatePhase(SignalPhasor *o, hv_uint32_t p) {
 #endif
 }
 
-static void sPhasor_k_updateFrequency(SignalPhasor *o, float f, double r) {
+// f2s is 1/samplerate for AVX, and 2^32/samplerate otherwise, see sPhasor_k_init()
+static void sPhasor_k_updateFrequency(SignalPhasor *o, float f, double f2s) {
 #if HV_SIMD_AVX
-  o->step.f2sc = (float) (f/r);
-  o->inc = _mm256_set1_ps((float) (8.0f*f/r));
-  sPhasor_k_updatePhase(o, o->phase[0]);
+  const double k = f*f2s; // 8*k is exact
+  o->step.f2sc = (float) k;
+  o->inc = _mm256_set1_ps((float) (8.0*k));
+  sPhasor_k_updatePhase(o, o->phase[0]-1.0f); // o->phase is in range [1,2]
 #elif HV_SIMD_SSE
-  o->step.s = (hv_int32_t) (f*(HV_PHASOR_2_32/r));
+  o->step.s = (hv_int32_t) (f*f2s);
   o->inc = _mm_set1_epi32(4*o->step.s);
   const hv_uint32_t *const p = (hv_uint32_t *) &o->phase;
   sPhasor_k_updatePhase(o, p[0]);
 #elif HV_SIMD_NEON
-  o->step.s = (hv_int32_t) (f*(HV_PHASOR_2_32/r));
+  o->step.s = (hv_int32_t) (f*f2s);
   o->inc = vdupq_n_s32(4*o->step.s);
   sPhasor_k_updatePhase(o, vgetq_lane_u32(o->phase, 0));
 #else // HV_SIMD_NONE
-  o->step.s = (hv_int32_t) (f*(HV_PHASOR_2_32/r));
+  o->step.s = (hv_int32_t) (f*f2s);
   o->inc = o->step.s;
   // no need to update phase
 #endif
@@ -116,14 +117,19 @@ void sPhasor_onMessage(HeavyContextInterface *_c, SignalPhasor *o, int letIn, co
 
 hv_size_t sPhasor_k_init(SignalPhasor *o, float frequency, double samplerate) {
   __hv_zero_i((hv_bOuti_t) &o->phase);
-  sPhasor_k_updateFrequency(o, frequency, samplerate);
+#if HV_SIMD_AVX
+  o->f2s = 1.0/samplerate;
+#else // HV_SIMD_SSE || HV_SIMD_NEON || HV_SIMD_NONE
+  o->f2s = HV_PHASOR_2_32/samplerate;
+#endif
+  sPhasor_k_updateFrequency(o, frequency, o->f2s);
   return 0;
 }
 
 void sPhasor_k_onMessage(HeavyContextInterface *_c, SignalPhasor *o, int letIn, const HvMessage *m) {
   if (msg_isFloat(m,0)) {
     switch (letIn) {
-      case 0: sPhasor_k_updateFrequency(o, msg_getFloat(m,0), hv_getSampleRate(_c)); break;
+      case 0: sPhasor_k_updateFrequency(o, msg_getFloat(m,0), o->f2s); break;
       case 1: {
         float p = msg_getFloat(m,0);
         while (p < 0.0f) p += 1.0f; // wrap phase to [0,1]
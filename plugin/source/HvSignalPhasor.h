@@ -41,6 +41,7 @@ typedef struct SignalPhasor {
     float f2sc; // float to step conversion (used for __phasor~f)
     hv_int32_t s; // step value (used for __phasor_k~f)
   } step;
+  double f2s; // frequency to step conversion (used for __phasor_k~f)
 } SignalPhasor;
 
 hv_size_t sPhasor_init(SignalPhasor *o, double samplerate);
@@ -51,6 +52,14 @@ void sPhasor_k_onMessage(HeavyContextInterface *_c, SignalPhasor *o, int letIn,
 
 void sPhasor_onMessage(HeavyContextInterface *_c, SignalPhasor *o, int letIn, const HvMessage *m);
 
+#if HV_SIMD_AVX
+// Wraps a float phase into [1,2). Masking out the exponent only does so below 2,
+// above it the phase would be halved rather than reduced by one.
+static inline __m256 __hv_phasor_wrap_f(__m256 x) {
+  return _mm256_add_ps(_mm256_sub_ps(x, _mm256_floor_ps(x)), _mm256_set1_ps(1.0f));
+}
+#endif
+
 static inline void __hv_phasor_f(SignalPhasor *o, hv_bInf_t bIn, hv_bOutf_t bOut) {
 #if HV_SIMD_AVX
   __m256 p = _mm256_mul_ps(bIn, _mm256_set1_ps(o->step.f2sc)); // a b c d e f g h
@@ -73,10 +82,7 @@ static inline void __hv_phasor_f(SignalPhasor *o, hv_bInf_t bIn, hv_bOutf_t bOut
   __m256 k = _mm256_permute2f128_ps(j, z, 0x02);         // 0 0 0 0 a (a+b) (a+b+c) (a+b+c+d) (b+c+d+e)
   __m256 m = _mm256_add_ps(j, k); // a (a+b) (a+b+c) (a+b+c+d) (a+b+c+d+e) (a+b+c+d+e+f) (a+b+c+d+e+f+g) (a+b+c+d+e+f+g+h)
 
-  __m256 n = _mm256_or_ps(_mm256_andnot_ps(
-      _mm256_set1_ps(-INFINITY),
-      _mm256_add_ps(o->phase, m)),
-      _mm256_set1_ps(1.0f));
+  __m256 n = __hv_phasor_wrap_f(_mm256_add_ps(o->phase, m));
 
   *bOut = _mm256_sub_ps(n, _mm256_set1_ps(1.0f));
 
@@ -109,10 +115,7 @@ static inline void __hv_phasor_f(SignalPhasor *o, hv_bInf_t bIn, hv_bOutf_t bOut
 static inline void __hv_phasor_k_f(SignalPhasor *o, hv_bOutf_t bOut) {
 #if HV_SIMD_AVX
   *bOut = _mm256_sub_ps(o->phase, _mm256_set1_ps(1.0f));
-  o->phase = _mm256_or_ps(_mm256_andnot_ps(
-      _mm256_set1_ps(-INFINITY),
-      _mm256_add_ps(o->phase, o->inc)),
-      _mm256_set1_ps(1.0f));
+  o->phase = __hv_phasor_wrap_f(_mm256_add_ps(o->phase, o->inc));
 #elif HV_SIMD_SSE
   *bOut = _mm_sub_ps(_mm_castsi128_ps(
       _mm_or_si128(_mm_srli_epi32(o->phase, 9),
@@ -17,23 +17,10 @@
 #include "HvSignalRPole.h"
 
 hv_size_t sRPole_init(SignalRPole *o) {
-#if HV_SIMD_AVX
-  sDel1_init(&o->sDel1_fxiLN);
-  sDel1_init(&o->sDel1_kjkpV);
-  sDel1_init(&o->sDel1_dkIWc);
-  sDel1_init(&o->sDel1_bVeoW);
-  sDel1_init(&o->sDel1_PulZn);
-  sDel1_init(&o->sDel1_yTFig);
-  sDel1_init(&o->sDel1_Is9Qf);
-  sDel1_init(&o->sDel1_LIyNt);
-  sDel1_init(&o->sDel1_VqpU3);
-  sDel1_init(&o->sDel1_ZVYeg);
-  sDel1_init(&o->sDel1_IVAZh);
-  sDel1_init(&o->sDel1_F8WrY);
-  sDel1_init(&o->sDel1_rkFMy);
-  sDel1_init(&o->sDel1_BeqSK);
-  __hv_zero_f(&o->ym);
-#elif HV_SIMD_SSE || HV_SIMD_NEON
+#if HV_SIMD_AVX || HV_SIMD_SSE
+  o->ym = 0.0f;
+  sRPole_updateCoefficients(o, 0.0f);
+#elif HV_SIMD_NEON
   sDel1_init(&o->sDel1_i8Twk);
   sDel1_init(&o->sDel1_KYibU);
   sDel1_init(&o->sDel1_spa5V);
@@ -47,6 +34,35 @@ hv_size_t sRPole_init(SignalRPole *o) {
   return 0;
 }
 
+#if HV_SIMD_AVX || HV_SIMD_SSE
+// The recursion is solved for a whole block as y = M*x + coeff_ym*y[-1], where
+// column j of the lower triangular matrix M holds the powers of -a starting at sample j.
+void sRPole_updateCoefficients(SignalRPole *o, float a) {
+  // calculate all filter coefficients in the double domain
+  double p[HV_N_SIMD+1];
+  p[0] = 1.0;
+  for (int i = 1; i <= HV_N_SIMD; i++) p[i] = -((double) a) * p[i-1];
+
+  float c[HV_N_SIMD];
+  for (int j = 0; j < HV_N_SIMD; j++) {
+    for (int i = 0; i < HV_N_SIMD; i++) c[i] = (i < j) ? 0.0f : (float) p[i-j];
+#if HV_SIMD_AVX
+    o->coeff_x[j] = _mm256_loadu_ps(c);
+#else // HV_SIMD_SSE
+    o->coeff_x[j] = _mm_loadu_ps(c);
+#endif
+  }
+  for (int i = 0; i < HV_N_SIMD; i++) c[i] = (float) p[i+1];
+#if HV_SIMD_AVX
+  o->coeff_ym = _mm256_loadu_ps(c);
+#else // HV_SIMD_SSE
+  o->coeff_ym = _mm_loadu_ps(c);
+#endif
+
+  o->a = a;
+}
+#endif
+
 void sRPole_onMessage(HeavyContextInterface *_c, SignalRPole *o, int letIn, const HvMessage *m) {
   // TODO
 }
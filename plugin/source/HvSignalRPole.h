@@ -27,23 +27,14 @@ extern "C" {
 // implements y[n] = x[n] - a*y[n-1]
 // H(z) = 1/(1+a*z^-1)
 typedef struct SignalRPole {
-#if HV_SIMD_AVX
-  SignalDel1 sDel1_fxiLN;
-  SignalDel1 sDel1_kjkpV;
-  SignalDel1 sDel1_dkIWc;
-  SignalDel1 sDel1_bVeoW;
-  SignalDel1 sDel1_PulZn;
-  SignalDel1 sDel1_yTFig;
-  SignalDel1 sDel1_Is9Qf;
-  SignalDel1 sDel1_LIyNt;
-  SignalDel1 sDel1_VqpU3;
-  SignalDel1 sDel1_ZVYeg;
-  SignalDel1 sDel1_IVAZh;
-  SignalDel1 sDel1_F8WrY;
-  SignalDel1 sDel1_rkFMy;
-  SignalDel1 sDel1_BeqSK;
-  hv_bufferf_t ym;
-#elif HV_SIMD_SSE || HV_SIMD_NEON
+#if HV_SIMD_AVX || HV_SIMD_SSE
+  // response of one block to each input sample and to the filter state,
+  // valid while the coefficient is uniform and equal to a
+  hv_bufferf_t coeff_x[HV_N_SIMD];
+  hv_bufferf_t coeff_ym;
+  float a;
+  float ym;
+#elif HV_SIMD_NEON
   SignalDel1 sDel1_i8Twk;
   SignalDel1 sDel1_KYibU;
   SignalDel1 sDel1_spa5V;
@@ -60,45 +51,81 @@ hv_size_t sRPole_init(SignalRPole *o);
 
 void sRPole_onMessage(HeavyContextInterface *_c, SignalRPole *o, int letIn, const HvMessage *m);
 
+#if HV_SIMD_AVX || HV_SIMD_SSE
+void sRPole_updateCoefficients(SignalRPole *o, float a);
+#endif
+
 static inline void __hv_rpole_f(SignalRPole *o, hv_bInf_t bIn0, hv_bInf_t bIn1, hv_bOutf_t bOut) {
 #if HV_SIMD_AVX
-  hv_bufferf_t a, b, c, d, e, f, g, i, j, k, l, m, n;
-  __hv_del1_f(&o->sDel1_fxiLN, bIn1, &a);
-  __hv_mul_f(bIn1, a, &b);
-  __hv_del1_f(&o->sDel1_kjkpV, a, &a);
-  __hv_mul_f(b, a, &c);
-  __hv_del1_f(&o->sDel1_dkIWc, a, &a);
-  __hv_mul_f(c, a, &d);
-  __hv_del1_f(&o->sDel1_bVeoW, a, &a);
-  __hv_mul_f(d, a, &e);
-  __hv_del1_f(&o->sDel1_PulZn, a, &a);
-  __hv_mul_f(e, a, &f);
-  __hv_del1_f(&o->sDel1_yTFig, a, &a);
-  __hv_mul_f(f, a, &g);
-  __hv_del1_f(&o->sDel1_Is9Qf, a, &a);
-  __hv_mul_f(g, a, &a);
-  __hv_del1_f(&o->sDel1_LIyNt, bIn0, &i);
-  __hv_del1_f(&o->sDel1_VqpU3, i, &j);
-  __hv_del1_f(&o->sDel1_ZVYeg, j, &k);
-  __hv_del1_f(&o->sDel1_IVAZh, k, &l);
-  __hv_del1_f(&o->sDel1_F8WrY, l, &m);
-  __hv_del1_f(&o->sDel1_rkFMy, m, &n);
-  __hv_mul_f(i, bIn1, &i);
-  __hv_sub_f(bIn0, i, &i);
-  __hv_fma_f(j, b, i, &i);
-  __hv_mul_f(k, c, &c);
-  __hv_sub_f(i, c, &c);
-  __hv_fma_f(l, d, c, &c);
-  __hv_mul_f(m, e, &e);
-  __hv_sub_f(c, e, &e);
-  __hv_fma_f(n, f, e, &e);
-  __hv_del1_f(&o->sDel1_BeqSK, n, &n);
-  __hv_mul_f(n, g, &g);
-  __hv_sub_f(e, g, &g);
-  __hv_fma_f(a, o->ym, g, &g);
-  o->ym = g;
-  *bOut = g;
-#elif HV_SIMD_SSE || HV_SIMD_NEON
+  float a;
+  if (__hv_uniform_f(bIn1, &a)) {
+    if (a != o->a) sRPole_updateCoefficients(o, a);
+
+    // the whole block at once, y = M*x + coeff_ym*ym
+    __m256 lo = _mm256_permute2f128_ps(bIn0, bIn0, 0x00); // [0 1 2 3 0 1 2 3]
+    __m256 hi = _mm256_permute2f128_ps(bIn0, bIn0, 0x11); // [4 5 6 7 4 5 6 7]
+    __m256 f = _mm256_add_ps(
+        _mm256_mul_ps(_mm256_permute_ps(lo, _MM_SHUFFLE(0,0,0,0)), o->coeff_x[0]),
+        _mm256_mul_ps(_mm256_permute_ps(lo, _MM_SHUFFLE(1,1,1,1)), o->coeff_x[1]));
+    __m256 g = _mm256_add_ps(
+        _mm256_mul_ps(_mm256_permute_ps(lo, _MM_SHUFFLE(2,2,2,2)), o->coeff_x[2]),
+        _mm256_mul_ps(_mm256_permute_ps(lo, _MM_SHUFFLE(3,3,3,3)), o->coeff_x[3]));
+    __m256 h = _mm256_add_ps(
+        _mm256_mul_ps(_mm256_permute_ps(hi, _MM_SHUFFLE(0,0,0,0)), o->coeff_x[4]),
+        _mm256_mul_ps(_mm256_permute_ps(hi, _MM_SHUFFLE(1,1,1,1)), o->coeff_x[5]));
+    __m256 i = _mm256_add_ps(
+        _mm256_mul_ps(_mm256_permute_ps(hi, _MM_SHUFFLE(2,2,2,2)), o->coeff_x[6]),
+        _mm256_mul_ps(_mm256_permute_ps(hi, _MM_SHUFFLE(3,3,3,3)), o->coeff_x[7]));
+    __m256 j = _mm256_mul_ps(_mm256_set1_ps(o->ym), o->coeff_ym);
+    __m256 y = _mm256_add_ps(_mm256_add_ps(_mm256_add_ps(f, g), _mm256_add_ps(h, i)), j);
+
+    o->ym = y[7];
+    *bOut = y;
+  } else {
+    // the coefficient varies over the block, run the recursion sample by sample
+    float y0 = bIn0[0] - bIn1[0]*o->ym;
+    float y1 = bIn0[1] - bIn1[1]*y0;
+    float y2 = bIn0[2] - bIn1[2]*y1;
+    float y3 = bIn0[3] - bIn1[3]*y2;
+    float y4 = bIn0[4] - bIn1[4]*y3;
+    float y5 = bIn0[5] - bIn1[5]*y4;
+    float y6 = bIn0[6] - bIn1[6]*y5;
+    float y7 = bIn0[7] - bIn1[7]*y6;
+
+    o->ym = y7;
+    *bOut = _mm256_set_ps(y7, y6, y5, y4, y3, y2, y1, y0);
+  }
+#elif HV_SIMD_SSE
+  float a;
+  if (__hv_uniform_f(bIn1, &a)) {
+    if (a != o->a) sRPole_updateCoefficients(o, a);
+
+    // the whole block at once, y = M*x + coeff_ym*ym
+    __m128 f = _mm_add_ps(
+        _mm_mul_ps(_mm_shuffle_ps(bIn0, bIn0, _MM_SHUFFLE(0,0,0,0)), o->coeff_x[0]),
+        _mm_mul_ps(_mm_shuffle_ps(bIn0, bIn0, _MM_SHUFFLE(1,1,1,1)), o->coeff_x[1]));
+    __m128 g = _mm_add_ps(
+        _mm_mul_ps(_mm_shuffle_ps(bIn0, bIn0, _MM_SHUFFLE(2,2,2,2)), o->coeff_x[2]),
+        _mm_mul_ps(_mm_shuffle_ps(bIn0, bIn0, _MM_SHUFFLE(3,3,3,3)), o->coeff_x[3]));
+    __m128 h = _mm_mul_ps(_mm_set1_ps(o->ym), o->coeff_ym);
+    __m128 y = _mm_add_ps(_mm_add_ps(f, g), h);
+
+    o->ym = _mm_cvtss_f32(_mm_shuffle_ps(y, y, _MM_SHUFFLE(3,3,3,3)));
+    *bOut = y;
+  } else {
+    // the coefficient varies over the block, run the recursion sample by sample
+    const float *const bbx = (float *) &bIn0;
+    const float *const bba = (float *) &bIn1;
+
+    float y0 = bbx[0] - bba[0]*o->ym;
+    float y1 = bbx[1] - bba[1]*y0;
+    float y2 = bbx[2] - bba[2]*y1;
+    float y3 = bbx[3] - bba[3]*y2;
+
+    o->ym = y3;
+    *bOut = _mm_set_ps(y3, y2, y1, y0);
+  }
+#elif HV_SIMD_NEON
   hv_bufferf_t a, b, c, e, f;
   __hv_del1_f(&o->sDel1_i8Twk, bIn1, &a);
   __hv_mul_f(bIn1, a, &b);
@@ -17,6 +17,36 @@
 #include "HvTable.h"
 #include "HvMessage.h"
 
+static void hTable_initUpdates(HvTable *o) {
+  o->prepared = NULL;
+  o->pending = NULL;
+  o->retired = NULL;
+  o->published.buffer = o->buffer;
+  o->published.length = o->length;
+  o->published.size = o->size;
+  o->published.allocated = o->allocated;
+  o->published.resize = false;
+  o->published.next = NULL;
+}
+
+static void hTable_freeBuffer(HvTable *o, float *buffer) {
+  if (buffer != o->finalData) hv_free(buffer);
+}
+
+static void hTable_freeUpdate(HvTable *o, HvTableUpdate *u) {
+  hTable_freeBuffer(o, u->buffer);
+  hv_free(u);
+}
+
+// frees all updates, which the audio thread must not be applying
+static void hTable_freeUpdates(HvTable *o) {
+  hTable_collectUpdates(o);
+  if (o->prepared != NULL) hTable_freeUpdate(o, o->prepared);
+  if (o->pending != NULL) hTable_freeUpdate(o, o->pending);
+  o->prepared = NULL;
+  o->pending = NULL;
+}
+
 hv_size_t hTable_init(HvTable *o, int length) {
   o->length = length;
   // true size of the table is always an integer multple of HV_N_SIMD
@@ -24,10 +54,12 @@ hv_size_t hTable_init(HvTable *o, int length) {
   // add an extra length for mirroring
   o->allocated = o->size + HV_N_SIMD;
   o->head = 0;
+  o->finalData = NULL;
   hv_size_t numBytes = o->allocated * sizeof(float);
   o->buffer = (float *) hv_malloc(numBytes);
   hv_assert(o->buffer != NULL);
   hv_memclear(o->buffer, numBytes);
+  hTable_initUpdates(o);
   return numBytes;
 }
 
@@ -36,11 +68,13 @@ hv_size_t hTable_initWithData(HvTable *o, int length, const float *data) {
   o->size = (length + HV_N_SIMD_MASK) & ~HV_N_SIMD_MASK;
   o->allocated = o->size + HV_N_SIMD;
   o->head = 0;
+  o->finalData = NULL;
   hv_size_t numBytes = o->size * sizeof(float);
   o->buffer = (float *) hv_malloc(numBytes);
   hv_assert(o->buffer != NULL);
   hv_memclear(o->buffer, numBytes);
   hv_memcpy(o->buffer, data, length*sizeof(float));
+  hTable_initUpdates(o);
   return numBytes;
 }
 
@@ -50,11 +84,14 @@ hv_size_t hTable_initWithFinalData(HvTable *o, int length, float *data) {
   o->allocated = length;
   o->buffer = data;
   o->head = 0;
+  o->finalData = data;
+  hTable_initUpdates(o);
   return 0;
 }
 
 void hTable_free(HvTable *o) {
-  hv_free(o->buffer);
+  hTable_freeUpdates(o);
+  hTable_freeBuffer(o, o->buffer);
 }
 
 int hTable_resize(HvTable *o, hv_uint32_t newLength) {
@@ -66,10 +103,12 @@ int hTable_resize(HvTable *o, hv_uint32_t newLength) {
   const hv_uint32_t newAllocated = newSize + HV_N_SIMD;
   const hv_uint32_t newAllocatedBytes = (hv_uint32_t) (newAllocated * sizeof(float));
 
-  float *b = (float *) hv_realloc(o->buffer, newAllocatedBytes);
+  // the caller's data of hTable_initWithFinalData() is copied rather than reallocated
+  const bool isFinal = (o->buffer == o->finalData);
+  float *b = isFinal ? o->buffer : (float *) hv_realloc(o->buffer, newAllocatedBytes);
   hv_assert(b != NULL); // error while reallocing!
   // ensure that hv_realloc has given us a correctly aligned buffer
-  if ((((hv_uintptr_t) (const void *) b) & ((0x1<<HV_N_SIMD)-1)) == 0) {
+  if (!isFinal && (((hv_uintptr_t) (const void *) b) & ((0x1<<HV_N_SIMD)-1)) == 0) {
     if (newSize > o->size) {
       hv_memclear(b + o->size, (newAllocated - o->size) * sizeof(float)); // clear new parts of the buffer
     }
@@ -84,18 +123,109 @@ int hTable_resize(HvTable *o, hv_uint32_t newLength) {
     } else {
       hv_memcpy(c, b, newAllocatedBytes);
     }
-    hv_free(b);
+    if (!isFinal) hv_free(b);
     o->buffer = (float *) c;
   }
   o->length = newLength;
   o->size = newSize;
   o->allocated = newAllocated;
+  // resizing in place must not be mixed with updates from another thread, drop any left over
+  hTable_freeUpdates(o);
+  hTable_initUpdates(o);
   return (int) (newAllocated - oldSizeBytes - (HV_N_SIMD*sizeof(float)));
 }
 
+float *hTable_prepareUpdate(HvTable *o, hv_uint32_t newLength) {
+  hTable_collectUpdates(o);
+  if (o->prepared == NULL) {
+    o->prepared = (HvTableUpdate *) hv_malloc(sizeof(HvTableUpdate));
+    hv_assert(o->prepared != NULL);
+  } else {
+    hTable_freeBuffer(o, o->prepared->buffer); // prepared again before it was published
+  }
+
+  // the buffer is laid out as by hTable_init(), and starts as a copy of the published one
+  HvTableUpdate *const u = o->prepared;
+  u->length = newLength;
+  u->size = (newLength + HV_N_SIMD_MASK) & ~HV_N_SIMD_MASK;
+  u->allocated = u->size + HV_N_SIMD;
+  u->resize = false;
+  u->next = NULL;
+  const hv_size_t numBytes = u->allocated * sizeof(float);
+  u->buffer = (float *) hv_malloc(numBytes);
+  hv_assert(u->buffer != NULL);
+  const hv_uint32_t n = hv_min_ui(newLength, o->published.length);
+  hv_memcpy(u->buffer, o->published.buffer, n*sizeof(float));
+  hv_memclear(u->buffer+n, numBytes - n*sizeof(float));
+  return u->buffer;
+}
+
+bool hTable_publishResize(HvTable *o, hv_uint32_t newLength) {
+  if (hTable_prepareUpdate(o, newLength) == NULL) return false;
+  // contents published by hTable_publishUpdate() but not swapped in yet replace the live ones,
+  // they are already in the prepared buffer. The writer only frees retired updates itself.
+  const HvTableUpdate *const p = (const HvTableUpdate *) hv_atomic_load_ptr(&o->pending);
+  o->prepared->resize = (p == NULL || p->resize);
+  return hTable_publishUpdate(o);
+}
+
+bool hTable_publishUpdate(HvTable *o) {
+  HvTableUpdate *const u = o->prepared;
+  if (u == NULL) return false;
+  o->prepared = NULL;
+  o->published = *u;
+
+  // an update that the audio thread has not taken yet belongs to the writer again
+  HvTableUpdate *const superseded = (HvTableUpdate *) hv_atomic_exchange_ptr(&o->pending, u);
+  if (superseded != NULL) hTable_freeUpdate(o, superseded);
+  hTable_collectUpdates(o);
+  return true;
+}
+
+void hTable_collectUpdates(HvTable *o) {
+  HvTableUpdate *u = (HvTableUpdate *) hv_atomic_exchange_ptr(&o->retired, NULL);
+  while (u != NULL) {
+    HvTableUpdate *const next = u->next;
+    hTable_freeUpdate(o, u);
+    u = next;
+  }
+}
+
+bool hTable_applyUpdate(HvTable *o) {
+  if (hv_atomic_load_ptr(&o->pending) == NULL) return false;
+  HvTableUpdate *const u = (HvTableUpdate *) hv_atomic_exchange_ptr(&o->pending, NULL);
+  if (u == NULL) return false;
+
+  // a resize keeps what the graph has written since the update was prepared
+  if (u->resize) hv_memcpy(u->buffer, o->buffer, hv_min_ui(o->length, u->length)*sizeof(float));
+
+  // swap the buffers, the update then holds the replaced one
+  float *const buffer = o->buffer;
+  const hv_uint32_t length = o->length;
+  const hv_uint32_t size = o->size;
+  const hv_uint32_t allocated = o->allocated;
+  o->buffer = u->buffer;
+  o->length = u->length;
+  o->size = u->size;
+  o->allocated = u->allocated;
+  if (o->head >= o->size) o->head = 0;
+  u->buffer = buffer;
+  u->length = length;
+  u->size = size;
+  u->allocated = allocated;
+
+  // push it onto the retired list, which the writer only ever empties
+  HvTableUpdate *r;
+  do {
+    r = (HvTableUpdate *) hv_atomic_load_ptr(&o->retired);
+    u->next = r;
+  } while (!hv_atomic_cas_ptr(&o->retired, r, u));
+  return true;
+}
+
 void hTable_onMessage(HeavyContextInterface *_c, HvTable *o, int letIn, const HvMessage *m,
     void (*sendMessage)(HeavyContextInterface *, int, const HvMessage *)) {
-  if (msg_compareSymbol(m,0,"resize") && msg_isFloat(m,1) && msg_getFloat(m,1) >= 0.0f) {
+  if (msg_compareHash(m,0,HV_MSG_HASH_RESIZE) && msg_isFloat(m,1) && msg_getFloat(m,1) >= 0.0f) {
     hTable_resize(o, (int) hv_ceil_f(msg_getFloat(m,1))); // apply ceil to ensure that tables always have enough space
 
     // send out the new size of the table
@@ -104,7 +234,7 @@ void hTable_onMessage(HeavyContextInterface *_c, HvTable *o, int letIn, const Hv
     sendMessage(_c, 0, n);
   }
 
-  else if (msg_compareSymbol(m,0,"mirror")) {
+  else if (msg_compareHash(m,0,HV_MSG_HASH_MIRROR)) {
     hv_memcpy(o->buffer+o->size, o->buffer, HV_N_SIMD*sizeof(float));
   }
 }
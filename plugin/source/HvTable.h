@@ -24,6 +24,16 @@
 extern "C" {
 #endif
 
+// A buffer that replaces the one of a table, see hTable_prepareUpdate()
+typedef struct HvTableUpdate {
+  float *buffer;
+  hv_uint32_t length;
+  hv_uint32_t size;
+  hv_uint32_t allocated;
+  bool resize; // takes over the live contents when applied, see hTable_publishResize()
+  struct HvTableUpdate *next; // in the list of retired updates
+} HvTableUpdate;
+
 typedef struct HvTable {
   float *buffer;
   // the number of values that the table is requested to have
@@ -39,6 +49,16 @@ typedef struct HvTable {
   hv_uint32_t allocated;
 
   hv_uint32_t head; // the most recently written point
+
+  // the caller's buffer of hTable_initWithFinalData(), which is never freed or reallocated
+  float *finalData;
+
+  // Updates from a writer thread. The audio thread takes the pending update at the start of
+  // a block and retires the buffer that it replaced, which the writer frees later.
+  HvTableUpdate *prepared; // being filled by the writer
+  HvTableUpdate *volatile pending; // published by the writer, not yet taken
+  HvTableUpdate *volatile retired; // list of replaced buffers
+  HvTableUpdate published; // the latest buffer published by the writer, or the initial one
 } HvTable;
 
 hv_size_t hTable_init(HvTable *o, int length);
@@ -51,6 +71,37 @@ void hTable_free(HvTable *o);
 
 int hTable_resize(HvTable *o, hv_uint32_t newLength);
 
+/**
+ * Returns a new buffer of the given length for the table, holding the contents that it had when
+ * last published, that the writer thread may fill before publishing it with hTable_publishUpdate().
+ * Values written by the audio thread since then are not carried over. Must only be called by one
+ * writer thread at a time, and never by the audio thread.
+ */
+float *hTable_prepareUpdate(HvTable *o, hv_uint32_t newLength);
+
+/**
+ * Publishes a buffer of the new length that takes over the contents of the table when the audio
+ * thread picks it up, as hTable_resize() would, including values it has written since the last
+ * publish. The remaining values are cleared. Returns false if no buffer could be prepared.
+ */
+bool hTable_publishResize(HvTable *o, hv_uint32_t newLength);
+
+/**
+ * Publishes the prepared buffer, which the audio thread picks up at the start of its next block.
+ * A buffer published before and not yet picked up is discarded. Returns false if no buffer
+ * was prepared.
+ */
+bool hTable_publishUpdate(HvTable *o);
+
+/** Frees the buffers replaced by published updates. Only called by the writer thread. */
+void hTable_collectUpdates(HvTable *o);
+
+/**
+ * Swaps in the buffer of a pending update, without allocating or freeing.
+ * Only called by the audio thread, between blocks. Returns true if the table changed.
+ */
+bool hTable_applyUpdate(HvTable *o);
+
 void hTable_onMessage(HeavyContextInterface *_c, HvTable *o, int letIn, const HvMessage *m,
     void (*sendMessage)(HeavyContextInterface *, int, const HvMessage *));
 
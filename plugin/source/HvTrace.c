@@ -0,0 +1,96 @@
+/**
+ * Copyright (c) 2014-2018 Enzien Audio Ltd.
+ *
+ * Permission to use, copy, modify, and/or distribute this software for any
+ * purpose with or without fee is hereby granted, provided that the above
+ * copyright notice and this permission notice appear in all copies.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL WARRANTIES WITH
+ * REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED WARRANTIES OF MERCHANTABILITY
+ * AND FITNESS. IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR ANY SPECIAL, DIRECT,
+ * INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES WHATSOEVER RESULTING FROM
+ * LOSS OF USE, DATA OR PROFITS, WHETHER IN AN ACTION OF CONTRACT, NEGLIGENCE OR
+ * OTHER TORTIOUS ACTION, ARISING OUT OF OR IN CONNECTION WITH THE USE OR
+ * PERFORMANCE OF THIS SOFTWARE.
+ */
+
+#include "HvTrace.h"
+
+#if HV_WIN
+#include <windows.h>
+#else
+#include <time.h>
+#endif
+
+static hv_uint64_t hTr_getClockNs(void) {
+#if HV_WIN
+  LARGE_INTEGER f, t;
+  QueryPerformanceFrequency(&f);
+  QueryPerformanceCounter(&t);
+  return (hv_uint64_t) ((double) t.QuadPart * 1.0e9 / (double) f.QuadPart);
+#else
+  struct timespec t;
+  clock_gettime(CLOCK_MONOTONIC, &t);
+  return (hv_uint64_t) t.tv_sec*1000000000 + (hv_uint64_t) t.tv_nsec;
+#endif
+}
+
+hv_size_t hTr_init(HvTrace *o, int numIds, hv_uint32_t capacity) {
+  hv_assert(capacity > 0 && !(capacity & (capacity-1)));
+  hv_assert(numIds > 0 && numIds <= 0x10000);
+  o->events = (HvTraceEvent *) hv_malloc(capacity*sizeof(HvTraceEvent));
+  hv_assert(o->events != NULL);
+  o->capacity = capacity;
+  o->writeIndex = 0;
+  o->readIndex = 0;
+  o->numDropped = 0;
+  o->counters = (HvTraceCounter *) hv_malloc(numIds*sizeof(HvTraceCounter));
+  hv_assert(o->counters != NULL);
+  hv_memclear(o->counters, numIds*sizeof(HvTraceCounter));
+  o->numIds = numIds;
+  o->startNs = hTr_getClockNs();
+  return capacity*sizeof(HvTraceEvent) + numIds*sizeof(HvTraceCounter);
+}
+
+void hTr_free(HvTrace *o) {
+  hv_free(o->events);
+  hv_free(o->counters);
+}
+
+hv_uint64_t hTr_now(const HvTrace *o) {
+  return hTr_getClockNs() - o->startNs;
+}
+
+bool hTr_writeJson(HvTrace *o, const char *path, const char *processName, const char *const *names) {
+  FILE *f = fopen(path, "w");
+  if (f == NULL) return false;
+
+  fprintf(f, "{\"traceEvents\":[\n");
+  fprintf(f, "{\"name\":\"process_name\",\"ph\":\"M\",\"pid\":1,\"args\":{\"name\":\"%s\"}}", processName);
+
+  // all events up to the write index are complete, see hTr_record()
+  const hv_uint32_t w = o->writeIndex;
+  for (hv_uint32_t r = o->readIndex; r != w; ++r) {
+    const HvTraceEvent *const e = o->events + (r & (o->capacity-1));
+    if (e->type == HV_TRACE_SCOPE) {
+      fprintf(f, ",\n{\"name\":\"%s\",\"cat\":\"message\",\"ph\":\"X\",\"ts\":%.3f,\"dur\":%.3f,\"pid\":1,\"tid\":1}",
+          names[e->id], e->start*1.0e-3, e->duration*1.0e-3);
+    } else {
+      fprintf(f, ",\n{\"name\":\"%s\",\"cat\":\"receiver\",\"ph\":\"i\",\"s\":\"t\",\"ts\":%.3f,\"pid\":1,\"tid\":1,"
+          "\"args\":{\"hash\":\"0x%X\"}}",
+          names[e->id], e->start*1.0e-3, e->arg);
+    }
+  }
+  o->readIndex = w;
+
+  // the counters, ordered by id, with the number of messages and their total inclusive time
+  fprintf(f, "\n],\n\"otherData\":{\n\"dropped events\":\"%u\"", o->numDropped);
+  for (int i = 0; i < o->numIds; ++i) {
+    const HvTraceCounter *const c = o->counters+i;
+    if (c->count > 0) {
+      fprintf(f, ",\n\"%s\":\"%llu messages, %.3f us\"", names[i], (unsigned long long) c->count, c->ns*1.0e-3);
+    }
+  }
+  fprintf(f, "\n}}\n");
+  return (fclose(f) == 0);
+}
@@ -0,0 +1,134 @@
+/**
+ * Copyright (c) 2014-2018 Enzien Audio Ltd.
+ *
+ * Permission to use, copy, modify, and/or distribute this software for any
+ * purpose with or without fee is hereby granted, provided that the above
+ * copyright notice and this permission notice appear in all copies.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL WARRANTIES WITH
+ * REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED WARRANTIES OF MERCHANTABILITY
+ * AND FITNESS. IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR ANY SPECIAL, DIRECT,
+ * INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES WHATSOEVER RESULTING FROM
+ * LOSS OF USE, DATA OR PROFITS, WHETHER IN AN ACTION OF CONTRACT, NEGLIGENCE OR
+ * OTHER TORTIOUS ACTION, ARISING OUT OF OR IN CONNECTION WITH THE USE OR
+ * PERFORMANCE OF THIS SOFTWARE.
+ */
+
+#ifndef _HEAVY_TRACE_H_
+#define _HEAVY_TRACE_H_
+
+#include "HvUtils.h"
+
+/**
+ * A trace of the message graph, enabled by building with HV_TRACE=1.
+ *
+ * The audio thread records a scope event for every traced message function, with its start
+ * and inclusive duration, and an instant event for every message scheduled for a receiver.
+ * Events go into a fixed ring that another thread drains with hTr_writeJson(), which writes
+ * them in the Chrome trace event format, readable by chrome://tracing and Perfetto. Events
+ * are dropped while the ring is full. The message count and total time of every id are kept
+ * regardless, and are written with each export.
+ */
+
+#ifndef HV_TRACE
+#define HV_TRACE 0
+#endif
+
+// number of events held by the ring, a power of two
+#ifndef HV_TRACE_CAPACITY
+#define HV_TRACE_CAPACITY 65536
+#endif
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+typedef enum HvTraceEventType {
+  HV_TRACE_SCOPE,
+  HV_TRACE_INSTANT
+} HvTraceEventType;
+
+typedef struct HvTraceEvent {
+  hv_uint64_t start; // ns since the trace was initialised
+  hv_uint32_t duration; // ns
+  hv_uint16_t id;
+  hv_uint16_t type; // HvTraceEventType
+  hv_uint32_t arg; // the receiver hash of instant events
+} HvTraceEvent;
+
+typedef struct HvTraceCounter {
+  hv_uint64_t count;
+  hv_uint64_t ns;
+} HvTraceCounter;
+
+/*
+ * The ring assumes a single producer thread and a single consumer thread, see HvLightPipe.
+ */
+typedef struct HvTrace {
+  HvTraceEvent *events;
+  hv_uint32_t capacity;
+  volatile hv_uint32_t writeIndex; // only advanced by the producer
+  volatile hv_uint32_t readIndex; // only advanced by the consumer
+  hv_uint32_t numDropped; // events not recorded because the ring was full
+  HvTraceCounter *counters; // per id, only written by the producer
+  int numIds;
+  hv_uint64_t startNs;
+} HvTrace;
+
+hv_size_t hTr_init(HvTrace *o, int numIds, hv_uint32_t capacity);
+
+void hTr_free(HvTrace *o);
+
+/** Returns the current time in ns since the trace was initialised. */
+hv_uint64_t hTr_now(const HvTrace *o);
+
+static inline void hTr_record(HvTrace *o, int id, HvTraceEventType type, hv_uint64_t start, hv_uint64_t end, hv_uint32_t arg) {
+  hv_assert(id >= 0 && id < o->numIds);
+  HvTraceCounter *const c = o->counters+id;
+  ++c->count;
+  c->ns += end-start;
+
+  const hv_uint32_t w = o->writeIndex;
+  if (w - o->readIndex < o->capacity) {
+    HvTraceEvent *const e = o->events + (w & (o->capacity-1));
+    e->start = start;
+    e->duration = (hv_uint32_t) (end-start);
+    e->id = (hv_uint16_t) id;
+    e->type = (hv_uint16_t) type;
+    e->arg = arg;
+    hv_sfence(); // the event must be complete before the consumer can see it
+    o->writeIndex = w+1;
+  } else {
+    ++o->numDropped;
+  }
+}
+
+static inline void hTr_instant(HvTrace *o, int id, hv_uint32_t arg) {
+  const hv_uint64_t now = hTr_now(o);
+  hTr_record(o, id, HV_TRACE_INSTANT, now, now, arg);
+}
+
+/**
+ * Drains the recorded events into a Chrome trace JSON file, followed by the counters of all
+ * ids that have been recorded at least once. names holds the name of every id.
+ * Returns false if the file could not be written.
+ */
+bool hTr_writeJson(HvTrace *o, const char *path, const char *processName, const char *const *names);
+
+#ifdef __cplusplus
+} // extern "C"
+
+/** Records a scope event from its construction to its destruction. */
+class HvTraceScope {
+ public:
+  HvTraceScope(HvTrace *trace, int id) : trace(trace), id(id), start(hTr_now(trace)) {}
+  ~HvTraceScope() { hTr_record(trace, id, HV_TRACE_SCOPE, start, hTr_now(trace), 0); }
+
+ private:
+  HvTrace *const trace;
+  const int id;
+  const hv_uint64_t start;
+};
+#endif
+
+#endif // _HEAVY_TRACE_H_
@@ -52,3 +52,12 @@ hv_uint32_t hv_string_to_hash(const char *str) {
   x ^= (x >> 15);
   return x;
 }
+
+void hv_prefault(void *p, hv_size_t numBytes) {
+  // 4 KB is the smallest page size of the supported platforms
+  volatile char *const c = (volatile char *) p;
+  for (hv_size_t i = 0; i < numBytes; i += 4096) {
+    c[i] = c[i];
+  }
+  if (numBytes > 0) c[numBytes-1] = c[numBytes-1];
+}
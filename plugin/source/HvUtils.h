@@ -213,8 +213,49 @@ extern "C" {
 #endif
   // Returns a 32-bit hash of any string. Returns 0 if string is NULL.
   hv_uint32_t hv_string_to_hash(const char *str);
+
+  // Writes to every page of a buffer, such that they are mapped now rather than on first use.
+  void hv_prefault(void *p, hv_size_t numBytes);
 #ifdef __cplusplus
 }
+
+// A constexpr equivalent of hv_string_to_hash(), such that literals can be hashed at compile time.
+// Written as single-expression recursion so that it remains valid C++11.
+// Blocks are read little-endian and tail bytes are sign-extended, exactly as the runtime does.
+static constexpr hv_uint32_t __hv_hash_n = 0x5bd1e995;
+static constexpr hv_uint32_t __hv_hash_length(const char *s, hv_uint32_t i) {
+  return (s[i] == '\0') ? i : __hv_hash_length(s, i+1);
+}
+static constexpr hv_uint32_t __hv_hash_byte(const char *s, int i) {
+  return (hv_uint32_t) (hv_int32_t) s[i];
+}
+static constexpr hv_uint32_t __hv_hash_mix_k(hv_uint32_t k) {
+  return ((k ^ (k >> 24)) * __hv_hash_n);
+}
+static constexpr hv_uint32_t __hv_hash_block(const char *s) {
+  return __hv_hash_mix_k(((hv_uint32_t) (hv_uint8_t) s[0] | ((hv_uint32_t) (hv_uint8_t) s[1] << 8) |
+      ((hv_uint32_t) (hv_uint8_t) s[2] << 16) | ((hv_uint32_t) (hv_uint8_t) s[3] << 24)) * __hv_hash_n);
+}
+static constexpr hv_uint32_t __hv_hash_tail(const char *s, hv_uint32_t len, hv_uint32_t x) {
+  return (len == 3) ? (x ^ (__hv_hash_byte(s,2) << 16) ^ (__hv_hash_byte(s,1) << 8) ^ __hv_hash_byte(s,0)) * __hv_hash_n
+       : (len == 2) ? (x ^ (__hv_hash_byte(s,1) << 8) ^ __hv_hash_byte(s,0)) * __hv_hash_n
+       : (len == 1) ? (x ^ __hv_hash_byte(s,0)) * __hv_hash_n
+       : x;
+}
+static constexpr hv_uint32_t __hv_hash_body(const char *s, hv_uint32_t len, hv_uint32_t x) {
+  return (len >= 4) ? __hv_hash_body(s+4, len-4, (x * __hv_hash_n) ^ __hv_hash_block(s))
+                    : __hv_hash_tail(s, len, x);
+}
+static constexpr hv_uint32_t __hv_hash_final(hv_uint32_t x) {
+  return x ^ (x >> 15);
+}
+static constexpr hv_uint32_t __hv_hash_avalanche(hv_uint32_t x) {
+  return __hv_hash_final((x ^ (x >> 13)) * __hv_hash_n);
+}
+static constexpr hv_uint32_t hv_string_to_hash_k(const char *str) {
+  return (str == nullptr) ? 0 : __hv_hash_avalanche(
+      __hv_hash_body(str, __hv_hash_length(str, 0), __hv_hash_length(str, 0)));
+}
 #endif
 
 // Math
@@ -272,6 +313,29 @@ static inline hv_int32_t __hv_utils_min_i(hv_int32_t x, hv_int32_t y) { return (
 #endif
 #define hv_min_max_log2(a) __hv_utils_min_max_log2(a)
 
+// Memory Barrier
+#if __SSE__ || HV_SIMD_SSE
+#include <xmmintrin.h>
+#define hv_sfence() _mm_sfence()
+#elif __arm__ || HV_SIMD_NEON
+  #if __ARM_ACLE
+    #include <arm_acle.h>
+    // https://msdn.microsoft.com/en-us/library/hh875058.aspx#BarrierRestrictions
+    // http://doxygen.reactos.org/d8/d47/armintr_8h_a02be7ec76ca51842bc90d9b466b54752.html
+    #define hv_sfence() __dmb(0xE) /* _ARM_BARRIER_ST */
+  #elif defined(__GNUC__)
+    #define hv_sfence() __asm__ volatile ("dmb 0xE":::"memory")
+  #else
+    // http://stackoverflow.com/questions/19965076/gcc-memory-barrier-sync-synchronize-vs-asm-volatile-memory
+    #define hv_sfence() __sync_synchronize()
+  #endif
+#elif HV_WIN
+// https://msdn.microsoft.com/en-us/library/windows/desktop/ms684208(v=vs.85).aspx
+#define hv_sfence() _WriteBarrier()
+#else
+#define hv_sfence() __asm__ volatile("" : : : "memory")
+#endif
+
 // Atomics
 #if HV_WIN
   #include <windows.h>
@@ -298,7 +362,7 @@ static inline hv_int32_t __hv_utils_min_i(hv_int32_t x, hv_int32_t y) { return (
     #define hv_atomic_bool atomic_flag
     #define HV_SPINLOCK_ACQUIRE(_x) while (atomic_flag_test_and_set_explicit(&_x, memory_order_acquire))
     #define HV_SPINLOCK_TRY(_x) return !atomic_flag_test_and_set_explicit(&_x, memory_order_acquire)
-    #define HV_SPINLOCK_RELEASE(_x) atomic_flag_clear_explicit(memory_order_release)
+    #define HV_SPINLOCK_RELEASE(_x) atomic_flag_clear_explicit(&_x, memory_order_release)
   #endif
 #endif
 #ifndef hv_atomic_bool
@@ -314,4 +378,17 @@ static inline hv_int32_t __hv_utils_min_i(hv_int32_t x, hv_int32_t y) { return (
   #define HV_SPINLOCK_RELEASE(_x) (_x = false)
 #endif
 
+// Atomic pointer operations, for handing buffers between threads without locks
+#if HV_WIN
+  #define hv_atomic_load_ptr(_p) (*(_p)) // volatile reads acquire on MSVC
+  #define hv_atomic_exchange_ptr(_p, _v) InterlockedExchangePointer((PVOID volatile *) (_p), (_v))
+  #define hv_atomic_cas_ptr(_p, _expected, _v) \
+      (InterlockedCompareExchangePointer((PVOID volatile *) (_p), (_v), (_expected)) == (_expected))
+#else
+  #define hv_atomic_load_ptr(_p) __atomic_load_n(_p, __ATOMIC_ACQUIRE)
+  #define hv_atomic_exchange_ptr(_p, _v) __atomic_exchange_n(_p, _v, __ATOMIC_ACQ_REL)
+  #define hv_atomic_cas_ptr(_p, _expected, _v) \
+      __sync_bool_compare_and_swap(_p, _expected, _v)
+#endif
+
 #endif // _HEAVY_UTILS_H_
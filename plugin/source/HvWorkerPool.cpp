@@ -0,0 +1,84 @@
+/**
+ * Copyright (c) 2014-2018 Enzien Audio Ltd.
+ *
+ * Permission to use, copy, modify, and/or distribute this software for any
+ * purpose with or without fee is hereby granted, provided that the above
+ * copyright notice and this permission notice appear in all copies.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL WARRANTIES WITH
+ * REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED WARRANTIES OF MERCHANTABILITY
+ * AND FITNESS. IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR ANY SPECIAL, DIRECT,
+ * INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES WHATSOEVER RESULTING FROM
+ * LOSS OF USE, DATA OR PROFITS, WHETHER IN AN ACTION OF CONTRACT, NEGLIGENCE OR
+ * OTHER TORTIOUS ACTION, ARISING OUT OF OR IN CONNECTION WITH THE USE OR
+ * PERFORMANCE OF THIS SOFTWARE.
+ */
+
+#include "HvWorkerPool.hpp"
+
+HvWorkerPool::HvWorkerPool(int numThreads) :
+    job(nullptr), userData(nullptr), numJobs(0), nextJob(0),
+    numActiveThreads(0), batch(0), isRunning(true) {
+  hv_assert(numThreads > 0);
+  for (int i = 0; i < numThreads; ++i) {
+    threads.push_back(std::thread(&HvWorkerPool::work, this));
+  }
+}
+
+HvWorkerPool::~HvWorkerPool() {
+  {
+    std::lock_guard<std::mutex> lock(mutex);
+    isRunning = false;
+  }
+  startCondition.notify_all();
+  for (std::thread &t : threads) t.join();
+}
+
+void HvWorkerPool::run(int numJobs, void (*job)(void *, int), void *userData) {
+  if (numJobs <= 0) return;
+  {
+    std::lock_guard<std::mutex> lock(mutex);
+    this->job = job;
+    this->userData = userData;
+    this->numJobs = numJobs;
+    nextJob = 0;
+    numActiveThreads = (int) threads.size();
+    ++batch;
+  }
+  startCondition.notify_all();
+
+  runJobs();
+
+  // wait until every worker has left the batch, such that none of them can touch the next one early
+  std::unique_lock<std::mutex> lock(mutex);
+  doneCondition.wait(lock, [this] { return numActiveThreads == 0; });
+}
+
+void HvWorkerPool::runJobs() {
+  for (;;) {
+    int i;
+    {
+      std::lock_guard<std::mutex> lock(mutex);
+      if (nextJob >= numJobs) return;
+      i = nextJob++;
+    }
+    job(userData, i);
+  }
+}
+
+void HvWorkerPool::work() {
+  hv_uint32_t lastBatch = 0;
+  for (;;) {
+    {
+      std::unique_lock<std::mutex> lock(mutex);
+      startCondition.wait(lock, [&] { return !isRunning || (batch != lastBatch); });
+      if (!isRunning) return;
+      lastBatch = batch;
+    }
+
+    runJobs();
+
+    std::lock_guard<std::mutex> lock(mutex);
+    if (--numActiveThreads == 0) doneCondition.notify_all();
+  }
+}
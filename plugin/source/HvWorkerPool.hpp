@@ -0,0 +1,63 @@
+/**
+ * Copyright (c) 2014-2018 Enzien Audio Ltd.
+ *
+ * Permission to use, copy, modify, and/or distribute this software for any
+ * purpose with or without fee is hereby granted, provided that the above
+ * copyright notice and this permission notice appear in all copies.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL WARRANTIES WITH
+ * REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED WARRANTIES OF MERCHANTABILITY
+ * AND FITNESS. IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR ANY SPECIAL, DIRECT,
+ * INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES WHATSOEVER RESULTING FROM
+ * LOSS OF USE, DATA OR PROFITS, WHETHER IN AN ACTION OF CONTRACT, NEGLIGENCE OR
+ * OTHER TORTIOUS ACTION, ARISING OUT OF OR IN CONNECTION WITH THE USE OR
+ * PERFORMANCE OF THIS SOFTWARE.
+ */
+
+#ifndef _HEAVY_WORKER_POOL_H_
+#define _HEAVY_WORKER_POOL_H_
+
+#include "HvUtils.h"
+
+#include <condition_variable>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+/**
+ * A fixed set of threads that run batches of independent jobs. The calling thread takes part
+ * in every batch, so a pool of n threads computes on n+1 cores.
+ * Synchronisation is blocking. The pool is meant for offline rendering, not for realtime threads.
+ */
+class HvWorkerPool {
+
+ public:
+  HvWorkerPool(int numThreads);
+  ~HvWorkerPool();
+
+  int getNumThreads() const { return (int) threads.size(); }
+
+  /** Calls job(userData, i) for every i in [0, numJobs) and returns once all of them have completed. */
+  void run(int numJobs, void (*job)(void *, int), void *userData);
+
+ private:
+  void work();
+  void runJobs();
+
+  std::vector<std::thread> threads;
+  std::mutex mutex;
+  std::condition_variable startCondition;
+  std::condition_variable doneCondition;
+
+  // the current batch, only written while all workers are idle
+  void (*job)(void *, int);
+  void *userData;
+  int numJobs;
+  int nextJob;
+
+  int numActiveThreads;
+  hv_uint32_t batch; // incremented for every batch
+  bool isRunning;
+};
+
+#endif // _HEAVY_WORKER_POOL_H_
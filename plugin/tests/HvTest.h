@@ -0,0 +1,40 @@
+/**
+ * Copyright (c) 2014-2018 Enzien Audio Ltd.
+ *
+ * Permission to use, copy, modify, and/or distribute this software for any
+ * purpose with or without fee is hereby granted, provided that the above
+ * copyright notice and this permission notice appear in all copies.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL WARRANTIES WITH
+ * REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED WARRANTIES OF MERCHANTABILITY
+ * AND FITNESS. IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR ANY SPECIAL, DIRECT,
+ * INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES WHATSOEVER RESULTING FROM
+ * LOSS OF USE, DATA OR PROFITS, WHETHER IN AN ACTION OF CONTRACT, NEGLIGENCE OR
+ * OTHER TORTIOUS ACTION, ARISING OUT OF OR IN CONNECTION WITH THE USE OR
+ * PERFORMANCE OF THIS SOFTWARE.
+ */
+
+#ifndef _HEAVY_TEST_H_
+#define _HEAVY_TEST_H_
+
+#include <stdio.h>
+
+/**
+ * A minimal check for the tests in this directory. A failed check is reported with its
+ * location and the test carries on, HV_TEST_RESULT() is the exit status of main().
+ */
+static int hvTestNumFailures = 0;
+
+#define HV_TEST_CHECK(_x) \
+  do { \
+    if (!(_x)) { \
+      fprintf(stderr, "%s:%d: check failed: %s\n", __FILE__, __LINE__, #_x); \
+      ++hvTestNumFailures; \
+    } \
+  } while (0)
+
+#define HV_TEST_RESULT() \
+  (printf("%s: %s\n", __FILE__, (hvTestNumFailures == 0) ? "passed" : "FAILED"), \
+   (hvTestNumFailures == 0) ? 0 : 1)
+
+#endif // _HEAVY_TEST_H_
@@ -0,0 +1,88 @@
+/**
+ * Copyright (c) 2014-2018 Enzien Audio Ltd.
+ *
+ * Permission to use, copy, modify, and/or distribute this software for any
+ * purpose with or without fee is hereby granted, provided that the above
+ * copyright notice and this permission notice appear in all copies.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL WARRANTIES WITH
+ * REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED WARRANTIES OF MERCHANTABILITY
+ * AND FITNESS. IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR ANY SPECIAL, DIRECT,
+ * INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES WHATSOEVER RESULTING FROM
+ * LOSS OF USE, DATA OR PROFITS, WHETHER IN AN ACTION OF CONTRACT, NEGLIGENCE OR
+ * OTHER TORTIOUS ACTION, ARISING OUT OF OR IN CONNECTION WITH THE USE OR
+ * PERFORMANCE OF THIS SOFTWARE.
+ */
+
+
+/**
+ * The attack cache, see hv_EP_MK1_setAttackCache(). A note of a cached key and velocity must sound
+ * the same as without the cache, to within MAX_ERROR as its attack is played from the cached frames.
+ * Any other velocity must not be played at that of a cached layer, and must sound exactly as
+ * without the cache.
+ */
+
+#include "Heavy_EP_MK1.h"
+#include "HvTest.h"
+
+#include <math.h>
+#include <stdlib.h>
+#include <unistd.h>
+#include <vector>
+
+#define SAMPLE_RATE 48000.0
+#define BLOCK_SIZE 256
+#define SETTLE_BLOCKS 200 // about a second, for the loadbangs as when the cache is rendered
+#define NUM_BLOCKS 64
+#define ATTACK_MS 50.0f
+
+#define MAX_ERROR 1.0e-4f
+
+#define HASH_NOTEIN 0x67E37CA3 // __hv_notein
+
+static float getMaxError(const std::vector<float> &x, const std::vector<float> &y) {
+  float e = 0.0f;
+  for (size_t i = 0; i < x.size() && i < y.size(); ++i) e = fmaxf(e, fabsf(x[i] - y[i]));
+  return e;
+}
+
+static void render(const char *cachePath, float pitch, float velocity, std::vector<float> &out) {
+  HeavyContextInterface *context = hv_EP_MK1_new(SAMPLE_RATE);
+  if (cachePath != nullptr) HV_TEST_CHECK(hv_EP_MK1_setAttackCache(context, cachePath));
+  float *outputs[2] = {(float *) hv_malloc(BLOCK_SIZE*sizeof(float)), (float *) hv_malloc(BLOCK_SIZE*sizeof(float))};
+  for (int b = 0; b < SETTLE_BLOCKS; ++b) hv_process(context, nullptr, outputs, BLOCK_SIZE);
+  hv_sendFloats3(context, HASH_NOTEIN, 0, pitch, velocity, 0.0f);
+  for (int b = 0; b < NUM_BLOCKS; ++b) {
+    hv_process(context, nullptr, outputs, BLOCK_SIZE);
+    out.insert(out.end(), outputs[0], outputs[0]+BLOCK_SIZE);
+  }
+  hv_free(outputs[0]);
+  hv_free(outputs[1]);
+  hv_delete(context);
+}
+
+int main(int argc, char **argv) {
+  char path[] = "/tmp/EP_MK1-test-attack-XXXXXX";
+  const int fd = mkstemp(path);
+  HV_TEST_CHECK(fd >= 0);
+  if (fd < 0) return HV_TEST_RESULT();
+  close(fd);
+
+  const float velocities[2] = {64.0f, 100.0f};
+  HV_TEST_CHECK(hv_EP_MK1_renderAttackCache(path, SAMPLE_RATE, 60, 2, velocities, 2, ATTACK_MS));
+
+  for (float velocity : {100.0f, 90.0f, 64.0f, 20.0f}) {
+    std::vector<float> live, cached;
+    render(nullptr, 60.0f, velocity, live);
+    render(path, 60.0f, velocity, cached);
+    const float error = getMaxError(live, cached);
+    if (velocity == 64.0f || velocity == 100.0f) {
+      HV_TEST_CHECK(error < MAX_ERROR);
+    } else {
+      HV_TEST_CHECK(error == 0.0f);
+    }
+  }
+
+  unlink(path);
+  return HV_TEST_RESULT();
+}
@@ -0,0 +1,136 @@
+/**
+ * Copyright (c) 2014-2018 Enzien Audio Ltd.
+ *
+ * Permission to use, copy, modify, and/or distribute this software for any
+ * purpose with or without fee is hereby granted, provided that the above
+ * copyright notice and this permission notice appear in all copies.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL WARRANTIES WITH
+ * REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED WARRANTIES OF MERCHANTABILITY
+ * AND FITNESS. IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR ANY SPECIAL, DIRECT,
+ * INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES WHATSOEVER RESULTING FROM
+ * LOSS OF USE, DATA OR PROFITS, WHETHER IN AN ACTION OF CONTRACT, NEGLIGENCE OR
+ * OTHER TORTIOUS ACTION, ARISING OUT OF OR IN CONNECTION WITH THE USE OR
+ * PERFORMANCE OF THIS SOFTWARE.
+ */
+
+/**
+ * Stress test of [delay], see HvControlDelay.h. A delay is retriggered, flushed and cleared at
+ * random several thousand times per second, with the message queue cleared now and then, and
+ * each message must arrive exactly when and as often as a simple model of the pending list says.
+ */
+
+#include "Heavy_EP_MK1.h"
+#include "HeavyContext.hpp"
+#include "HvControlDelay.h"
+#include "HvTest.h"
+
+#include <algorithm>
+#include <vector>
+
+#define SAMPLE_RATE 48000.0
+#define BLOCK_SIZE 64
+#define NUM_BLOCKS 22500 // 30 seconds
+#define OPS_PER_BLOCK 8 // about 6000 per second
+
+struct Event {
+  hv_uint32_t timestamp;
+  float id;
+  bool operator==(const Event &e) const { return timestamp == e.timestamp && id == e.id; }
+};
+
+static ControlDelay delay;
+static std::vector<Event> pending; // the model, in the order the messages are due
+static std::vector<Event> expected;
+static std::vector<Event> received;
+
+static hv_uint32_t seed = 1;
+
+static hv_uint32_t nextRandom() {
+  seed = seed*1664525 + 1013904223;
+  return seed >> 8;
+}
+
+static void delay_sendMessage(HeavyContextInterface *_c, int letIn, const HvMessage *m) {
+  cDelay_clearExecutingMessage(&delay, m);
+  received.push_back({msg_getTimestamp(m), msg_getFloat(m,0)});
+}
+
+static void sendSymbol(HeavyContextInterface *context, hv_uint32_t timestamp, const char *s) {
+  cDelay_onMessage(context, &delay, 0, msg_initWithSymbol(HV_MESSAGE_ON_STACK(1), timestamp, s),
+      &delay_sendMessage);
+}
+
+// the pending nodes must be chained both ways, in the order of the model
+static bool isChainValid() {
+  size_t i = 0;
+  MessageNode *prev = NULL;
+  for (MessageNode *n = delay.head; n != NULL; prev = n, n = n->objNext, ++i) {
+    if (n->objPrev != prev || i >= pending.size()) return false;
+    const HvMessage *const m = mq_node_getMessage(n);
+    if (!(Event{msg_getTimestamp(m), msg_getFloat(m,0)} == pending[i])) return false;
+  }
+  return delay.tail == prev && i == pending.size();
+}
+
+int main(int argc, char **argv) {
+  HeavyContextInterface *context = hv_EP_MK1_new(SAMPLE_RATE);
+  float *outputs[2] = {(float *) hv_malloc(BLOCK_SIZE*sizeof(float)), (float *) hv_malloc(BLOCK_SIZE*sizeof(float))};
+  hv_process(context, nullptr, outputs, BLOCK_SIZE); // such that the queue can be cleared
+  cDelay_init(&delay, static_cast<HeavyContext *>(context)->getMessageQueue(), SAMPLE_RATE, 0.0f);
+
+  float nextId = 0.0f;
+  int numInvalidChains = 0;
+  for (int b = 0; b < NUM_BLOCKS; ++b) {
+    const hv_uint32_t now = hv_getCurrentSample(context);
+    for (int i = 0; i < OPS_PER_BLOCK; ++i) {
+      const hv_uint32_t op = nextRandom() % 100;
+      if (op < 60) {
+        // retrigger, i.e. schedule another message
+        const hv_uint32_t ts = now + nextRandom() % BLOCK_SIZE;
+        const Event e = {ts + delay.delay, nextId};
+        cDelay_onMessage(context, &delay, 0, msg_initWithFloat(HV_MESSAGE_ON_STACK(1), ts, nextId),
+            &delay_sendMessage);
+        pending.insert(std::upper_bound(pending.begin(), pending.end(), e,
+            [](const Event &x, const Event &y) { return x.timestamp < y.timestamp; }), e);
+        nextId += 1.0f;
+      } else if (op < 75) {
+        // a new delay of up to 4 blocks only applies to the messages scheduled from now on
+        cDelay_onMessage(context, &delay, 2,
+            msg_initWithFloat(HV_MESSAGE_ON_STACK(1), now, (float) (nextRandom() % (4*BLOCK_SIZE))),
+            &delay_sendMessage);
+      } else if (op < 85) {
+        sendSymbol(context, now, "clear");
+        pending.clear();
+      } else if (op < 90) {
+        sendSymbol(context, now, "flush");
+        for (const Event &e : pending) expected.push_back({now, e.id});
+        pending.clear();
+      } else if (op < 92) {
+        // as the generated context does for its own delays
+        hv_clearMessages(context);
+        cDelay_forgetPending(&delay);
+        pending.clear();
+      }
+    }
+    if (!isChainValid()) ++numInvalidChains;
+
+    hv_process(context, nullptr, outputs, BLOCK_SIZE);
+    const hv_uint32_t end = hv_getCurrentSample(context);
+    while (!pending.empty() && pending.front().timestamp < end) {
+      expected.push_back(pending.front());
+      pending.erase(pending.begin());
+    }
+  }
+
+  printf("%.0f messages scheduled, %zu received\n", nextId, received.size());
+  HV_TEST_CHECK(numInvalidChains == 0);
+  HV_TEST_CHECK(isChainValid());
+  HV_TEST_CHECK(received.size() == expected.size());
+  HV_TEST_CHECK(received == expected);
+
+  hv_free(outputs[0]);
+  hv_free(outputs[1]);
+  hv_delete(context);
+  return HV_TEST_RESULT();
+}
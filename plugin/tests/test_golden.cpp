@@ -0,0 +1,170 @@
+/**
+ * Copyright (c) 2014-2018 Enzien Audio Ltd.
+ *
+ * Permission to use, copy, modify, and/or distribute this software for any
+ * purpose with or without fee is hereby granted, provided that the above
+ * copyright notice and this permission notice appear in all copies.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL WARRANTIES WITH
+ * REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED WARRANTIES OF MERCHANTABILITY
+ * AND FITNESS. IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR ANY SPECIAL, DIRECT,
+ * INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES WHATSOEVER RESULTING FROM
+ * LOSS OF USE, DATA OR PROFITS, WHETHER IN AN ACTION OF CONTRACT, NEGLIGENCE OR
+ * OTHER TORTIOUS ACTION, ARISING OUT OF OR IN CONNECTION WITH THE USE OR
+ * PERFORMANCE OF THIS SOFTWARE.
+ */
+
+/**
+ * Golden output. Four scenarios, single notes across the keyboard, chords, voice stealing and a
+ * long release, are rendered and compared with the reference in EP_MK1-golden.f32, which is
+ * rendered by the scalar backend (-DHV_SIMD_NONE) with `make golden`. The SIMD backends do not
+ * compute the oscillator phases with the same precision, so each backend has its own tolerance,
+ * as a minimum signal-to-noise ratio and a maximum absolute error. Each note starts and stops on
+ * a multiple of 8 samples, where every backend processes its messages.
+ *
+ * Usage: EP_MK1-test-golden-<backend> [-w] [reference]
+ *   -w  writes the reference instead of comparing with it
+ */
+
+#include "Heavy_EP_MK1.h"
+#include "HvTest.h"
+
+#include <math.h>
+#include <string.h>
+#include <vector>
+
+#define SAMPLE_RATE 48000.0
+#define BLOCK_SIZE 128
+
+#define HASH_NOTEIN 0x67E37CA3 // __hv_notein
+
+#if HV_SIMD_AVX
+  #if HV_SIMD_FMA
+    #define BACKEND_NAME "fma"
+  #else
+    #define BACKEND_NAME "avx"
+  #endif
+  #define MIN_SNR_DB 60.0
+  #define MAX_ERROR 2.0e-3
+#elif HV_SIMD_SSE
+  #define BACKEND_NAME "sse"
+  #define MIN_SNR_DB 85.0
+  #define MAX_ERROR 1.0e-4
+#elif HV_SIMD_NEON
+  #define BACKEND_NAME "neon"
+  #define MIN_SNR_DB 60.0
+  #define MAX_ERROR 2.0e-3
+#else
+  #define BACKEND_NAME "none"
+  #define MIN_SNR_DB 110.0
+  #define MAX_ERROR 1.0e-5
+#endif
+
+struct Note {
+  int start; // in samples
+  int length; // in samples
+  float pitch;
+  float velocity;
+};
+
+struct Scenario {
+  const char *name;
+  int length; // in samples
+  std::vector<Note> notes;
+};
+
+static std::vector<Scenario> makeScenarios() {
+  std::vector<Scenario> scenarios(4);
+
+  // one note at a time, every fifth from A0 up to A7
+  scenarios[0].name = "keys";
+  scenarios[0].length = 36000;
+  for (int i = 0; i < 13; ++i) {
+    scenarios[0].notes.push_back({i*2400, 2000, (float) (21 + i*7), (float) (40 + i*6)});
+  }
+
+  // three chords of six notes
+  scenarios[1].name = "chords";
+  scenarios[1].length = 36000;
+  for (int c = 0; c < 3; ++c) {
+    for (int i = 0; i < 6; ++i) {
+      scenarios[1].notes.push_back({c*9600 + i*8, 7200, (float) (36 + c*5 + i*7), (float) (50 + i*10)});
+    }
+  }
+
+  // a run of held notes, more than there are voices
+  scenarios[2].name = "stealing";
+  scenarios[2].length = 36000;
+  for (int i = 0; i < 24; ++i) {
+    scenarios[2].notes.push_back({i*800, 9600, (float) (48 + (i*5) % 31), (float) (60 + (i*13) % 60)});
+  }
+
+  // a short chord that rings out
+  scenarios[3].name = "release";
+  scenarios[3].length = 48000;
+  for (int i = 0; i < 3; ++i) {
+    scenarios[3].notes.push_back({0, 4800, (float) (45 + i*4), 100.0f});
+  }
+
+  return scenarios;
+}
+
+// renders the left channel of a scenario, the right one is identical
+static void render(const Scenario &scenario, std::vector<float> &out) {
+  HeavyContextInterface *context = hv_EP_MK1_new(SAMPLE_RATE);
+  float *outputs[2] = {(float *) hv_malloc(BLOCK_SIZE*sizeof(float)), (float *) hv_malloc(BLOCK_SIZE*sizeof(float))};
+
+  for (const Note &n : scenario.notes) {
+    hv_sendFloats3(context, HASH_NOTEIN, (hv_uint32_t) n.start, n.pitch, n.velocity, 0.0f);
+    hv_sendFloats3(context, HASH_NOTEIN, (hv_uint32_t) (n.start + n.length), n.pitch, 0.0f, 0.0f);
+  }
+  for (int i = 0; i < scenario.length; i += BLOCK_SIZE) {
+    hv_process(context, nullptr, outputs, BLOCK_SIZE);
+    HV_TEST_CHECK(!memcmp(outputs[0], outputs[1], BLOCK_SIZE*sizeof(float)));
+    out.insert(out.end(), outputs[0], outputs[0] + hv_min_i(BLOCK_SIZE, scenario.length-i));
+  }
+
+  hv_free(outputs[0]);
+  hv_free(outputs[1]);
+  hv_delete(context);
+}
+
+int main(int argc, char **argv) {
+  const bool write = (argc > 1 && !strcmp(argv[1], "-w"));
+  const char *path = (argc > (write ? 2 : 1)) ? argv[argc-1] : "EP_MK1-golden.f32";
+  const std::vector<Scenario> scenarios = makeScenarios();
+
+  std::vector<float> out;
+  for (const Scenario &s : scenarios) render(s, out);
+
+  FILE *f = fopen(path, write ? "wb" : "rb");
+  HV_TEST_CHECK(f != nullptr);
+  if (f == nullptr) return HV_TEST_RESULT();
+  if (write) {
+    HV_TEST_CHECK(fwrite(out.data(), sizeof(float), out.size(), f) == out.size());
+    fclose(f);
+    printf("wrote %d samples to %s\n", (int) out.size(), path);
+    return HV_TEST_RESULT();
+  }
+  std::vector<float> ref(out.size());
+  HV_TEST_CHECK(fread(ref.data(), sizeof(float), ref.size(), f) == ref.size() && fgetc(f) == EOF);
+  fclose(f);
+
+  size_t offset = 0;
+  for (const Scenario &s : scenarios) {
+    double signal = 0.0, noise = 0.0, error = 0.0;
+    for (size_t i = offset; i < offset + s.length; ++i) {
+      const double d = (double) out[i] - (double) ref[i];
+      signal += (double) ref[i] * (double) ref[i];
+      noise += d*d;
+      error = fmax(error, fabs(d));
+    }
+    offset += s.length;
+    const double snr = (noise > 0.0) ? 10.0*log10(signal/noise) : INFINITY;
+    printf("%s %-8s differs from none by %.3g, %.1f dB\n", BACKEND_NAME, s.name, error, snr);
+    HV_TEST_CHECK(signal > 0.0);
+    HV_TEST_CHECK(snr >= MIN_SNR_DB);
+    HV_TEST_CHECK(error <= MAX_ERROR);
+  }
+  return HV_TEST_RESULT();
+}
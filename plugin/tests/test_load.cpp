@@ -0,0 +1,131 @@
+/**
+ * Copyright (c) 2014-2018 Enzien Audio Ltd.
+ *
+ * Permission to use, copy, modify, and/or distribute this software for any
+ * purpose with or without fee is hereby granted, provided that the above
+ * copyright notice and this permission notice appear in all copies.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL WARRANTIES WITH
+ * REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED WARRANTIES OF MERCHANTABILITY
+ * AND FITNESS. IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR ANY SPECIAL, DIRECT,
+ * INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES WHATSOEVER RESULTING FROM
+ * LOSS OF USE, DATA OR PROFITS, WHETHER IN AN ACTION OF CONTRACT, NEGLIGENCE OR
+ * OTHER TORTIOUS ACTION, ARISING OUT OF OR IN CONNECTION WITH THE USE OR
+ * PERFORMANCE OF THIS SOFTWARE.
+ */
+
+/**
+ * Load shedding, see HeavyContext.hpp. A budget no block can meet raises the load tier every
+ * HV_LOAD_BLOCKS_BETWEEN_RAISES blocks up to the voice cap, each change is reported to the send
+ * hook, and rendering the voices on worker threads must park the same voices and sound the same
+ * as rendering them on the calling thread. The compiler may contract or reorder the arithmetic
+ * of the voices differently on both paths with -ffast-math, so they are compared to within
+ * MAX_ERROR, far below the level of a single voice that is or is not rendered. The voices shed by
+ * the cap must be released to the allocator, and stay released once the load tier drops again.
+ */
+
+#include "Heavy_EP_MK1.h"
+#include "HvTest.h"
+
+#include <math.h>
+#include <string.h>
+#include <vector>
+
+#define SAMPLE_RATE 48000.0
+#define BLOCK_SIZE 1024
+#define NUM_BLOCKS 200
+
+#define MAX_ERROR 1.0e-4f
+
+#define HASH_NOTEIN 0x67E37CA3 // __hv_notein
+#define HASH_USED 0xFA0C1E3F // 1148-used
+
+#define CAPPED_VOICES 4 // HV_EP_MK1_CAPPED_VOICES
+
+static std::vector<float> tiers;
+
+static float getMaxError(const std::vector<float> &x, const std::vector<float> &y) {
+  float e = 0.0f;
+  for (size_t i = 0; i < x.size() && i < y.size(); ++i) e = fmaxf(e, fabsf(x[i] - y[i]));
+  return e;
+}
+
+static void onSend(HeavyContextInterface *context, const char *sendName, hv_uint32_t sendHash, const HvMessage *m) {
+  if (sendHash == HV_LOAD_TIER_SEND_HASH && !strcmp(sendName, HV_LOAD_TIER_SEND_NAME)
+      && hv_msg_getNumElements(m) == 2) {
+    tiers.push_back(hv_msg_getFloat(m, 0));
+  }
+}
+
+// plays chords of eight notes on every voice, under an impossible budget unless full quality
+static void render(int numThreads, bool fullQuality, std::vector<float> &out) {
+  HeavyContextInterface *context = hv_EP_MK1_new(SAMPLE_RATE);
+  float *outputs[2] = {(float *) hv_malloc(BLOCK_SIZE*sizeof(float)), (float *) hv_malloc(BLOCK_SIZE*sizeof(float))};
+  if (numThreads > 0) HV_TEST_CHECK(hv_setRenderThreads(context, numThreads, BLOCK_SIZE));
+  hv_setSendHook(context, &onSend);
+  hv_setCpuBudget(context, fullQuality ? 0.0f : 1.0e-6f);
+
+  for (int b = 0; b < NUM_BLOCKS; ++b) {
+    if (b % 16 == 0) {
+      for (int i = 0; i < 8; ++i) {
+        const float pitch = (float) (40 + (b/16 + i*5) % 40);
+        hv_sendFloats3(context, HASH_NOTEIN, (hv_uint32_t) (i*100), pitch, (float) (30 + i*12), 0.0f);
+        hv_sendFloats3(context, HASH_NOTEIN, (hv_uint32_t) (i*100 + 700), pitch, 0.0f, 0.0f);
+      }
+    }
+    hv_process(context, nullptr, outputs, BLOCK_SIZE);
+    out.insert(out.end(), outputs[0], outputs[0]+BLOCK_SIZE);
+    out.insert(out.end(), outputs[1], outputs[1]+BLOCK_SIZE);
+  }
+  HV_TEST_CHECK(hv_getLoadTier(context) == (fullQuality ? 0 : 3));
+
+  hv_free(outputs[0]);
+  hv_free(outputs[1]);
+  hv_delete(context);
+}
+
+static int getNumUsedVoices(HeavyContextInterface *context) {
+  const float *const used = hv_table_getBuffer(context, HASH_USED);
+  int n = 0;
+  for (hv_uint32_t i = 0; i < hv_table_getLength(context, HASH_USED); ++i) n += (used[i] != 0.0f);
+  return n;
+}
+
+// holds a chord of eight notes on every voice through the voice cap, then lifts the budget
+static void renderHeld() {
+  HeavyContextInterface *context = hv_EP_MK1_new(SAMPLE_RATE);
+  float *outputs[2] = {(float *) hv_malloc(BLOCK_SIZE*sizeof(float)), (float *) hv_malloc(BLOCK_SIZE*sizeof(float))};
+  hv_setCpuBudget(context, 1.0e-6f);
+  for (int i = 0; i < 8; ++i) hv_sendFloats3(context, HASH_NOTEIN, 0, (float) (40 + i*5), 100.0f, 0.0f);
+  for (int b = 0; b < NUM_BLOCKS; ++b) hv_process(context, nullptr, outputs, BLOCK_SIZE);
+  HV_TEST_CHECK(hv_getLoadTier(context) == 3);
+  HV_TEST_CHECK(getNumUsedVoices(context) == CAPPED_VOICES);
+
+  hv_setCpuBudget(context, 0.0f);
+  for (int b = 0; b < 16; ++b) hv_process(context, nullptr, outputs, BLOCK_SIZE);
+  HV_TEST_CHECK(hv_getLoadTier(context) == 0);
+  HV_TEST_CHECK(getNumUsedVoices(context) == CAPPED_VOICES);
+
+  hv_free(outputs[0]);
+  hv_free(outputs[1]);
+  hv_delete(context);
+}
+
+int main(int argc, char **argv) {
+  std::vector<float> full, serial, parallel;
+  render(0, true, full);
+  HV_TEST_CHECK(tiers.empty());
+  render(0, false, serial);
+  HV_TEST_CHECK(tiers == std::vector<float>({1.0f, 2.0f, 3.0f}));
+  tiers.clear();
+  render(2, false, parallel);
+  HV_TEST_CHECK(tiers == std::vector<float>({1.0f, 2.0f, 3.0f}));
+  HV_TEST_CHECK(serial.size() == parallel.size());
+  const float error = getMaxError(serial, parallel);
+  const float shed = getMaxError(full, serial);
+  printf("parallel differs by %g, shedding changes the output by %g\n", error, shed);
+  HV_TEST_CHECK(error < MAX_ERROR);
+  HV_TEST_CHECK(shed > 100.0f*MAX_ERROR);
+  renderHeld();
+  return HV_TEST_RESULT();
+}
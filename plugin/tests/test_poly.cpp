@@ -0,0 +1,123 @@
+/**
+ * Copyright (c) 2014-2018 Enzien Audio Ltd.
+ *
+ * Permission to use, copy, modify, and/or distribute this software for any
+ * purpose with or without fee is hereby granted, provided that the above
+ * copyright notice and this permission notice appear in all copies.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL WARRANTIES WITH
+ * REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED WARRANTIES OF MERCHANTABILITY
+ * AND FITNESS. IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR ANY SPECIAL, DIRECT,
+ * INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES WHATSOEVER RESULTING FROM
+ * LOSS OF USE, DATA OR PROFITS, WHETHER IN AN ACTION OF CONTRACT, NEGLIGENCE OR
+ * OTHER TORTIOUS ACTION, ARISING OUT OF OR IN CONNECTION WITH THE USE OR
+ * PERFORMANCE OF THIS SOFTWARE.
+ */
+
+/**
+ * Differential test of the native voice allocator and note path, see HvControlPoly.h and
+ * Heavy_EP_MK1::onNote(). The same random MIDI is
+ * rendered by a build with HV_EP_MK1_GENERIC_NOTEIN, which writes its output and the state of
+ * the [poly] tables with -w, and by the default build, which compares its own with -c. Both must
+ * be bit-identical.
+ */
+
+#include "Heavy_EP_MK1.h"
+#include "HvTest.h"
+
+#include <stdlib.h>
+#include <string.h>
+#include <vector>
+
+#define SAMPLE_RATE 48000.0
+#define BLOCK_SIZE 256
+#define NUM_BLOCKS 750 // 4 seconds
+
+#define HASH_NOTEIN 0x67E37CA3 // __hv_notein
+#define HASH_SHOULD_STEAL 0x9D529A37 // 1148-shouldSteal
+#define HASH_PITCHES 0x15539905 // 1148-pitches
+#define HASH_USED 0xFA0C1E3F // 1148-used
+#define HASH_IDS 0x6C694DF7 // 1148-ids
+
+enum Stealing {
+  STEALING_ON,
+  STEALING_OFF,
+  STEALING_TOGGLED // switched every second
+};
+
+static hv_uint32_t seed = 1;
+
+static hv_uint32_t nextRandom() {
+  seed = seed*1664525 + 1013904223;
+  return seed >> 8;
+}
+
+// renders random notes, with the given number of pitches per semitone, and appends the output and
+// the tables of each block
+static void render(Stealing stealing, int notesPerBlock, int numPitches, int divisions, std::vector<float> &out) {
+  HeavyContextInterface *context = hv_EP_MK1_new(SAMPLE_RATE);
+  float *outputs[2] = {(float *) hv_malloc(BLOCK_SIZE*sizeof(float)), (float *) hv_malloc(BLOCK_SIZE*sizeof(float))};
+  hv_sendFloatToReceiver(context, HASH_SHOULD_STEAL, (stealing == STEALING_OFF) ? 0.0f : 1.0f);
+
+  for (int b = 0; b < NUM_BLOCKS; ++b) {
+    if (stealing == STEALING_TOGGLED && b % 187 == 0) {
+      hv_sendFloatToReceiver(context, HASH_SHOULD_STEAL, (float) ((b/187) & 1));
+    }
+    const int numNotes = (int) (nextRandom() % (notesPerBlock+1));
+    for (int i = 0; i < numNotes; ++i) {
+      const float pitch = 48.0f + (float) (nextRandom() % (numPitches*divisions)) / (float) divisions;
+      const float velocity = (nextRandom() % 5 < 2) ? 0.0f : (float) (1 + nextRandom() % 127);
+      const float channel = (float) (nextRandom() % 16);
+      const double delayMs = 1000.0*(nextRandom() % BLOCK_SIZE)/SAMPLE_RATE;
+      hv_sendMessageToReceiverV(context, HASH_NOTEIN, delayMs, "fff", pitch, velocity, channel);
+    }
+    hv_process(context, nullptr, outputs, BLOCK_SIZE);
+    out.insert(out.end(), outputs[0], outputs[0]+BLOCK_SIZE);
+    out.insert(out.end(), outputs[1], outputs[1]+BLOCK_SIZE);
+    const hv_uint32_t tables[3] = {HASH_PITCHES, HASH_USED, HASH_IDS};
+    for (hv_uint32_t t : tables) {
+      const float *const buffer = hv_table_getBuffer(context, t);
+      out.insert(out.end(), buffer, buffer+hv_table_getLength(context, t));
+    }
+  }
+
+  hv_free(outputs[0]);
+  hv_free(outputs[1]);
+  hv_delete(context);
+}
+
+int main(int argc, char **argv) {
+  if (argc != 3 || (strcmp(argv[1], "-w") && strcmp(argv[1], "-c"))) {
+    fprintf(stderr, "usage: %s -w|-c <file>\n", argv[0]);
+    return 2;
+  }
+
+  std::vector<float> out;
+  render(STEALING_ON, 2, 24, 1, out); // about as many notes as voices
+  render(STEALING_ON, 12, 12, 1, out); // note storms on few pitches, repeated note-offs
+  render(STEALING_OFF, 4, 24, 1, out); // notes are dropped when all voices sound
+  render(STEALING_TOGGLED, 6, 16, 1, out);
+  render(STEALING_ON, 3, 24, 4, out); // quarter tones miss the note cache
+
+  if (!strcmp(argv[1], "-w")) {
+    FILE *f = fopen(argv[2], "wb");
+    HV_TEST_CHECK(f != nullptr && fwrite(out.data(), sizeof(float), out.size(), f) == out.size());
+    if (f != nullptr) fclose(f);
+  } else {
+    std::vector<float> ref(out.size()+1);
+    FILE *f = fopen(argv[2], "rb");
+    HV_TEST_CHECK(f != nullptr);
+    if (f != nullptr) {
+      HV_TEST_CHECK(fread(ref.data(), sizeof(float), ref.size(), f) == out.size());
+      fclose(f);
+      size_t numDiffs = 0, firstDiff = 0;
+      for (size_t i = 0; i < out.size(); ++i) {
+        if (memcmp(&out[i], &ref[i], sizeof(float)) && numDiffs++ == 0) firstDiff = i;
+      }
+      if (numDiffs > 0) printf("%zu of %zu values differ, the first at %zu\n", numDiffs, out.size(), firstDiff);
+      HV_TEST_CHECK(numDiffs == 0);
+    }
+  }
+
+  return HV_TEST_RESULT();
+}
@@ -0,0 +1,144 @@
+/**
+ * Copyright (c) 2014-2018 Enzien Audio Ltd.
+ *
+ * Permission to use, copy, modify, and/or distribute this software for any
+ * purpose with or without fee is hereby granted, provided that the above
+ * copyright notice and this permission notice appear in all copies.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL WARRANTIES WITH
+ * REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED WARRANTIES OF MERCHANTABILITY
+ * AND FITNESS. IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR ANY SPECIAL, DIRECT,
+ * INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES WHATSOEVER RESULTING FROM
+ * LOSS OF USE, DATA OR PROFITS, WHETHER IN AN ACTION OF CONTRACT, NEGLIGENCE OR
+ * OTHER TORTIOUS ACTION, ARISING OUT OF OR IN CONNECTION WITH THE USE OR
+ * PERFORMANCE OF THIS SOFTWARE.
+ */
+
+/**
+ * The global symbol table, see HvMessage.h. Concurrent interning must agree on every index, and
+ * a full table must be reported rather than turning new symbols into empty ones. The hashes that
+ * hv_string_to_hash_k() computes at compile time must also equal hv_string_to_hash() at runtime,
+ * for every symbol of the patch and for the tails of 1 to 3 bytes and bytes above 0x7F.
+ */
+
+#include "Heavy_EP_MK1.h"
+#include "HvMessage.h"
+#include "HvTest.h"
+
+#include <string.h>
+#include <thread>
+#include <type_traits>
+#include <vector>
+
+#define NUM_THREADS 4
+#define NUM_SHARED_SYMBOLS 128
+
+static hv_uint32_t sharedIndex[NUM_THREADS][NUM_SHARED_SYMBOLS];
+
+struct KnownHash {
+  const char *str;
+  hv_uint32_t hash;
+};
+
+// the hash is a template argument, such that it can only be computed by the compiler
+#define KNOWN_HASH(_s) {_s, std::integral_constant<hv_uint32_t, hv_string_to_hash_k(_s)>::value}
+
+static const KnownHash knownHashes[] = {
+  // receivers, sends and tables of the patch
+  KNOWN_HASH("__hv_init"), KNOWN_HASH("__hv_notein"), KNOWN_HASH("__hv_loadtier"),
+  KNOWN_HASH("1001-buz-pha"), KNOWN_HASH("1001-poly"),
+  KNOWN_HASH("1148-currentVoiceId"), KNOWN_HASH("1148-ids"), KNOWN_HASH("1148-indexOff"),
+  KNOWN_HASH("1148-indexOn"), KNOWN_HASH("1148-isFirstOff"), KNOWN_HASH("1148-isFirstOn"),
+  KNOWN_HASH("1148-maxVoiceId"), KNOWN_HASH("1148-pitches"), KNOWN_HASH("1148-shouldSteal"),
+  KNOWN_HASH("1148-used"), KNOWN_HASH("1148-voiceId++"),
+  // symbols in its messages
+  KNOWN_HASH("bang"), KNOWN_HASH("float"), KNOWN_HASH("symbol"), KNOWN_HASH("set"),
+  KNOWN_HASH("clear"), KNOWN_HASH("flush"), KNOWN_HASH("stop"), KNOWN_HASH("resize"),
+  KNOWN_HASH("mirror"), KNOWN_HASH("samplerate"), KNOWN_HASH("numInputChannels"),
+  KNOWN_HASH("numOutputChannels"), KNOWN_HASH("currentTime"), KNOWN_HASH("table"),
+  KNOWN_HASH("length"), KNOWN_HASH("size"), KNOWN_HASH("head"),
+  // every tail length, and bytes with the high bit set in the blocks and in the tails
+  KNOWN_HASH(""), KNOWN_HASH("a"), KNOWN_HASH("ab"), KNOWN_HASH("abc"), KNOWN_HASH("abcd"),
+  KNOWN_HASH("abcde"), KNOWN_HASH("abcdef"), KNOWN_HASH("abcdefg"), KNOWN_HASH("abcdefgh"),
+  KNOWN_HASH("\x80"), KNOWN_HASH("\xFF\xFE"), KNOWN_HASH("\xC3\xA9t\xE9"), KNOWN_HASH("\xE2\x82\xAC"),
+  KNOWN_HASH("abcd\xE9"), KNOWN_HASH("abcd\x7F\x80"), KNOWN_HASH("abcd\xF0\x9F\x8E"),
+  KNOWN_HASH("\xF0\x9F\x8E\xB9 piano"),
+};
+
+static void internShared(int t) {
+  char s[32];
+  for (int i = 0; i < NUM_SHARED_SYMBOLS; ++i) {
+    const int k = (t & 1) ? (NUM_SHARED_SYMBOLS-1-i) : i; // half of the threads go backwards
+    snprintf(s, sizeof(s), "shared-%d", k);
+    if (!msg_internSymbol(s, &sharedIndex[t][k])) sharedIndex[t][k] = HV_MSG_SYMBOL_TABLE_SIZE;
+  }
+}
+
+int main(int argc, char **argv) {
+  for (const KnownHash &k : knownHashes) {
+    const hv_uint32_t hash = hv_string_to_hash(k.str);
+    if (hash != k.hash) printf("\"%s\" hashes to 0x%08X at compile time, 0x%08X at runtime\n", k.str, k.hash, hash);
+    HV_TEST_CHECK(hash == k.hash);
+  }
+  HV_TEST_CHECK(knownHashes[1].hash == 0x67E37CA3); // as the generated receiver switch has it
+
+  // a context interns the symbols of its graph when it is created
+  HeavyContextInterface *context = hv_EP_MK1_new(48000.0);
+  hv_uint32_t index = 0;
+  HV_TEST_CHECK(msg_internSymbol("clear", &index));
+  HV_TEST_CHECK(!strcmp(msg_getInternedSymbol(index)->str, "clear"));
+
+  // concurrent interning of the same symbols
+  std::vector<std::thread> threads;
+  for (int t = 0; t < NUM_THREADS; ++t) threads.emplace_back(internShared, t);
+  for (std::thread &t : threads) t.join();
+  for (int k = 0; k < NUM_SHARED_SYMBOLS; ++k) {
+    char s[32];
+    snprintf(s, sizeof(s), "shared-%d", k);
+    HV_TEST_CHECK(sharedIndex[0][k] < HV_MSG_SYMBOL_TABLE_SIZE);
+    for (int t = 1; t < NUM_THREADS; ++t) HV_TEST_CHECK(sharedIndex[t][k] == sharedIndex[0][k]);
+    HV_TEST_CHECK(!strcmp(msg_getInternedSymbol(sharedIndex[0][k])->str, s));
+  }
+
+  // fill the table, entries are never removed
+  int numInterned = 0;
+  char s[32];
+  for (;;) {
+    snprintf(s, sizeof(s), "fill-%d", numInterned);
+    if (!msg_internSymbol(s, &index)) break;
+    HV_TEST_CHECK(!strcmp(msg_getInternedSymbol(index)->str, s));
+    ++numInterned;
+    if (numInterned > HV_MSG_SYMBOL_TABLE_SIZE) break;
+  }
+  HV_TEST_CHECK(numInterned < HV_MSG_SYMBOL_TABLE_SIZE);
+  HV_TEST_CHECK(numInterned + NUM_SHARED_SYMBOLS > HV_MSG_SYMBOL_TABLE_SIZE/2); // the documented capacity
+  HV_TEST_CHECK(msg_getNumSymbolOverflows() == 1);
+  printf("%d symbols of up to %d interned, %d KB of storage\n",
+      numInterned + NUM_SHARED_SYMBOLS, HV_MSG_SYMBOL_TABLE_SIZE, HV_MSG_SYMBOL_TABLE_KB);
+
+  // known symbols are still found
+  for (int k = 0; k < numInterned; k += 7) {
+    snprintf(s, sizeof(s), "fill-%d", k);
+    HV_TEST_CHECK(msg_internSymbol(s, &index));
+    HV_TEST_CHECK(!strcmp(msg_getInternedSymbol(index)->str, s));
+  }
+
+  // a new symbol falls back to its hash and is counted
+  HvMessage *m = HV_MESSAGE_ON_STACK(1);
+  msg_initWithSymbol(m, 0, "overflow");
+  HV_TEST_CHECK(!msg_isSymbol(m, 0));
+  HV_TEST_CHECK(msg_isHashLike(m, 0));
+  HV_TEST_CHECK(msg_getHash(m, 0) == hv_string_to_hash("overflow"));
+  HV_TEST_CHECK(msg_compareSymbol(m, 0, "overflow"));
+  HV_TEST_CHECK(msg_getNumSymbolOverflows() == 2);
+
+  // the context still works with a full table
+  HV_TEST_CHECK(hv_sendMessageToReceiverV(context, 0x67E37CA3, 0.0, "fff", 60.0f, 100.0f, 0.0f)); // notein
+  float *outputs[2] = {(float *) hv_malloc(256*sizeof(float)), (float *) hv_malloc(256*sizeof(float))};
+  HV_TEST_CHECK(hv_process(context, nullptr, outputs, 256) == 256);
+  hv_free(outputs[0]);
+  hv_free(outputs[1]);
+  hv_delete(context);
+
+  return HV_TEST_RESULT();
+}
@@ -0,0 +1,129 @@
+/**
+ * Copyright (c) 2014-2018 Enzien Audio Ltd.
+ *
+ * Permission to use, copy, modify, and/or distribute this software for any
+ * purpose with or without fee is hereby granted, provided that the above
+ * copyright notice and this permission notice appear in all copies.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL WARRANTIES WITH
+ * REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED WARRANTIES OF MERCHANTABILITY
+ * AND FITNESS. IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR ANY SPECIAL, DIRECT,
+ * INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES WHATSOEVER RESULTING FROM
+ * LOSS OF USE, DATA OR PROFITS, WHETHER IN AN ACTION OF CONTRACT, NEGLIGENCE OR
+ * OTHER TORTIOUS ACTION, ARISING OUT OF OR IN CONNECTION WITH THE USE OR
+ * PERFORMANCE OF THIS SOFTWARE.
+ */
+
+/**
+ * The 64-bit timeline, see HeavyContext.hpp. Message timestamps are its low 32 bits and wrap
+ * around after 2^32 samples, about 24.8 hours at 48 kHz. The same note storm, with the releases
+ * scheduled by the [del] objects of the voices, must sound the same across the wrap as just after
+ * start-up, sent by delay or at a sample.
+ */
+
+#include "Heavy_EP_MK1.h"
+#include "HvTest.h"
+
+#include <string.h>
+#include <vector>
+
+#define SAMPLE_RATE 48000.0
+#define BLOCK_SIZE 64
+#define SLEEP_BLOCK_SIZE 8192
+#define LEAD_FRAMES (12*SLEEP_BLOCK_SIZE) // the storm starts this long before the wrap
+#define NUM_BLOCKS 3000 // 4 seconds, half of them after the wrap
+
+#define HASH_NOTEIN 0x67E37CA3 // __hv_notein
+
+static hv_uint32_t seed = 1;
+
+static hv_uint32_t nextRandom() {
+  seed = seed*1664525 + 1013904223;
+  return seed >> 8;
+}
+
+// sleeps through silent blocks up to the given sample, then plays the storm from there
+static void render(hv_uint64_t start, bool atSample, std::vector<float> &out) {
+  HeavyContextInterface *context = hv_EP_MK1_new(SAMPLE_RATE);
+  float *outputs[2] = {(float *) hv_malloc(SLEEP_BLOCK_SIZE*sizeof(float)), (float *) hv_malloc(SLEEP_BLOCK_SIZE*sizeof(float))};
+  hv_setSilentBlocksBeforeSleep(context, 1);
+  while (hv_getCurrentSample64(context) < start) hv_process(context, nullptr, outputs, SLEEP_BLOCK_SIZE);
+  HV_TEST_CHECK(hv_getCurrentSample64(context) == start);
+
+  seed = 1;
+  for (int b = 0; b < NUM_BLOCKS; ++b) {
+    const int numNotes = (int) (nextRandom() % 7);
+    for (int i = 0; i < numNotes; ++i) {
+      const float pitch = (float) (48 + nextRandom() % 16);
+      const float velocity = (nextRandom() % 5 < 2) ? 0.0f : (float) (1 + nextRandom() % 127);
+      const hv_uint32_t offset = nextRandom() % (4*BLOCK_SIZE); // up to the third next block
+      if (atSample) {
+        hv_sendMessageAtSampleV(context, HASH_NOTEIN, hv_getCurrentSample64(context) + offset, "fff",
+            pitch, velocity, 0.0f);
+      } else {
+        hv_sendMessageToReceiverV(context, HASH_NOTEIN, 1000.0*(offset + 0.5)/SAMPLE_RATE, "fff",
+            pitch, velocity, 0.0f);
+      }
+    }
+    hv_process(context, nullptr, outputs, BLOCK_SIZE);
+    out.insert(out.end(), outputs[0], outputs[0]+BLOCK_SIZE);
+    out.insert(out.end(), outputs[1], outputs[1]+BLOCK_SIZE);
+  }
+  HV_TEST_CHECK(hv_getCurrentSample64(context) == start + NUM_BLOCKS*BLOCK_SIZE);
+
+  hv_free(outputs[0]);
+  hv_free(outputs[1]);
+  hv_delete(context);
+}
+
+static bool isSilent(const std::vector<float> &x) {
+  for (float f : x) if (f != 0.0f) return false;
+  return true;
+}
+
+// notes due past the 2^31 sample window of the queue are clamped to it, so they neither wrap into
+// the next blocks nor hold back the notes due before them
+static void renderFarAhead(hv_uint64_t start, bool farAhead, std::vector<float> &out) {
+  HeavyContextInterface *context = hv_EP_MK1_new(SAMPLE_RATE);
+  float *outputs[2] = {(float *) hv_malloc(SLEEP_BLOCK_SIZE*sizeof(float)), (float *) hv_malloc(SLEEP_BLOCK_SIZE*sizeof(float))};
+  hv_setSilentBlocksBeforeSleep(context, 1);
+  while (hv_getCurrentSample64(context) < start) hv_process(context, nullptr, outputs, SLEEP_BLOCK_SIZE);
+
+  const hv_uint64_t now = hv_getCurrentSample64(context);
+  if (farAhead) {
+    HV_TEST_CHECK(hv_sendMessageAtSampleV(context, HASH_NOTEIN, now + ((hv_uint64_t) 1 << 32) + 16, "fff",
+        60.0f, 100.0f, 0.0f));
+    HV_TEST_CHECK(hv_sendMessageAtSampleV(context, HASH_NOTEIN, now + 0x80000000ULL, "fff", 62.0f, 100.0f, 0.0f));
+    HV_TEST_CHECK(hv_sendFloats3(context, HASH_NOTEIN, 0x80000010U, 64.0f, 100.0f, 0.0f));
+    HV_TEST_CHECK(hv_sendFloats3(context, HASH_NOTEIN, 0xFFFFFFF0U, 65.0f, 100.0f, 0.0f));
+  }
+  HV_TEST_CHECK(hv_sendFloats3(context, HASH_NOTEIN, 4*BLOCK_SIZE, 67.0f, 100.0f, 0.0f));
+  for (int b = 0; b < 16; ++b) {
+    hv_process(context, nullptr, outputs, BLOCK_SIZE);
+    out.insert(out.end(), outputs[0], outputs[0]+BLOCK_SIZE);
+  }
+
+  hv_free(outputs[0]);
+  hv_free(outputs[1]);
+  hv_delete(context);
+}
+
+int main(int argc, char **argv) {
+  const hv_uint64_t wrap = (hv_uint64_t) 1 << 32;
+  for (int atSample = 0; atSample < 2; ++atSample) {
+    std::vector<float> early, late;
+    render(LEAD_FRAMES, atSample != 0, early);
+    render(wrap - LEAD_FRAMES, atSample != 0, late);
+    HV_TEST_CHECK(!isSilent(early));
+    HV_TEST_CHECK(early.size() == late.size());
+    HV_TEST_CHECK(!memcmp(early.data(), late.data(), early.size()*sizeof(float)));
+  }
+  for (hv_uint64_t start : {(hv_uint64_t) LEAD_FRAMES, wrap - LEAD_FRAMES}) {
+    std::vector<float> near, far;
+    renderFarAhead(start, false, near);
+    renderFarAhead(start, true, far);
+    HV_TEST_CHECK(!isSilent(near));
+    HV_TEST_CHECK(!memcmp(near.data(), far.data(), near.size()*sizeof(float)));
+  }
+  return HV_TEST_RESULT();
+}